@@ -0,0 +1,493 @@
+/**
+ * Benchmark Suite - Performance regression harness for evocore
+ *
+ * Run via `make bench`. Writes one JSON document to bench_results.json
+ * (or the path given as the first argument) so CI can archive results
+ * and diff them between releases; human-readable progress goes to
+ * stderr.
+ *
+ * Coverage:
+ * 1. Microbenchmarks: mempool_alloc, context_learn, population_sort,
+ *    genome_clone
+ * 2. Macrobenchmarks: sphere, TSP and trading domains evolved
+ *    end-to-end with fixed seeds
+ *
+ * Every benchmark reports ops/sec plus p50/p99 latency in nanoseconds
+ * (per operation for micro, per generation for macro).
+ */
+
+#define _GNU_SOURCE
+#include "evocore/evocore.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+/*========================================================================
+ * Timing and Reporting
+ *========================================================================*/
+
+#define MAX_SAMPLES 262144
+
+static uint64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+static int cmp_u64(const void *a, const void *b) {
+    uint64_t x = *(const uint64_t*)a;
+    uint64_t y = *(const uint64_t*)b;
+    return (x > y) - (x < y);
+}
+
+static FILE *g_json = NULL;
+static int g_emitted = 0;
+
+/**
+ * Emit one benchmark result as a JSON object
+ *
+ * Sorts the latency samples to extract percentiles; ops_per_sec counts
+ * ops (which may exceed the sample count for macro benchmarks where one
+ * sample covers a whole generation).
+ */
+static void report(
+    const char *name,
+    const char *kind,
+    uint64_t *samples,
+    size_t sample_count,
+    uint64_t ops,
+    uint64_t total_ns
+) {
+    qsort(samples, sample_count, sizeof(uint64_t), cmp_u64);
+
+    uint64_t p50 = samples[sample_count / 2];
+    uint64_t p99 = samples[(sample_count * 99) / 100];
+    double ops_per_sec = (double)ops / ((double)total_ns / 1e9);
+
+    fprintf(g_json,
+            "%s\n    {\"name\": \"%s\", \"kind\": \"%s\", \"ops\": %llu, "
+            "\"ops_per_sec\": %.1f, \"p50_ns\": %llu, \"p99_ns\": %llu}",
+            g_emitted ? "," : "",
+            name, kind,
+            (unsigned long long)ops, ops_per_sec,
+            (unsigned long long)p50, (unsigned long long)p99);
+    g_emitted = 1;
+
+    fprintf(stderr, "  %-24s %12.0f ops/sec  p50=%8llu ns  p99=%8llu ns\n",
+            name, ops_per_sec,
+            (unsigned long long)p50, (unsigned long long)p99);
+}
+
+/*========================================================================
+ * Microbenchmarks
+ *========================================================================*/
+
+static void bench_mempool_alloc(uint64_t *samples) {
+    const size_t iters = 100000;
+    const size_t genome_size = 256;
+
+    evocore_mempool_t *pool = evocore_mempool_create(genome_size, 1024);
+    if (!pool) return;
+
+    uint64_t total = 0;
+    for (size_t i = 0; i < iters; i++) {
+        evocore_genome_t genome;
+        memset(&genome, 0, sizeof(genome));
+
+        uint64_t t0 = now_ns();
+        evocore_mempool_alloc(pool, &genome);
+        uint64_t dt = now_ns() - t0;
+
+        samples[i] = dt;
+        total += dt;
+        evocore_mempool_free(pool, &genome);
+    }
+
+    report("mempool_alloc", "micro", samples, iters, iters, total);
+    evocore_mempool_destroy(pool);
+}
+
+static void bench_context_learn(uint64_t *samples) {
+    const size_t iters = 100000;
+    static const char *regimes[] = {"bull", "bear", "flat", "choppy"};
+    static const char *vols[] = {"low", "mid", "high"};
+
+    evocore_context_dimension_t dims[2] = {
+        {.name = "regime", .values = (char**)regimes, .value_count = 4},
+        {.name = "vol", .values = (char**)vols, .value_count = 3},
+    };
+    evocore_context_system_t *sys = evocore_context_system_create(dims, 2, 4);
+    if (!sys) return;
+
+    unsigned seed = 101;
+    uint64_t total = 0;
+    for (size_t i = 0; i < iters; i++) {
+        const char *values[2] = {
+            regimes[rand_r(&seed) % 4],
+            vols[rand_r(&seed) % 3]
+        };
+        double params[4] = {0.1, 0.2, 0.3, (double)(rand_r(&seed) % 100) / 100.0};
+
+        uint64_t t0 = now_ns();
+        evocore_context_learn(sys, values, params, 4, params[3]);
+        uint64_t dt = now_ns() - t0;
+
+        samples[i] = dt;
+        total += dt;
+    }
+
+    report("context_learn", "micro", samples, iters, iters, total);
+    evocore_context_system_free(sys);
+}
+
+static void bench_population_sort(uint64_t *samples) {
+    const size_t iters = 2000;
+    const size_t pop_size = 1024;
+
+    evocore_population_t pop;
+    evocore_population_init(&pop, pop_size);
+
+    unsigned seed = 202;
+    for (size_t i = 0; i < pop_size; i++) {
+        evocore_genome_t genome;
+        evocore_genome_init(&genome, 64);
+        genome.size = genome.capacity;
+        evocore_population_add(&pop, &genome, 0.0);
+        evocore_genome_cleanup(&genome);
+    }
+
+    uint64_t total = 0;
+    for (size_t i = 0; i < iters; i++) {
+        /* Re-randomize fitness outside the timed region */
+        for (size_t j = 0; j < pop.size; j++) {
+            pop.individuals[j].fitness = (double)rand_r(&seed) / RAND_MAX;
+        }
+
+        uint64_t t0 = now_ns();
+        evocore_population_sort(&pop);
+        uint64_t dt = now_ns() - t0;
+
+        samples[i] = dt;
+        total += dt;
+    }
+
+    report("population_sort", "micro", samples, iters, iters, total);
+    evocore_population_cleanup(&pop);
+}
+
+static void bench_genome_clone(uint64_t *samples) {
+    const size_t iters = 100000;
+    const size_t genome_size = 1024;
+
+    evocore_genome_t src;
+    evocore_genome_init(&src, genome_size);
+    src.size = src.capacity;
+
+    unsigned seed = 303;
+    unsigned char *data = (unsigned char*)src.data;
+    for (size_t i = 0; i < genome_size; i++) {
+        data[i] = rand_r(&seed) & 0xFF;
+    }
+
+    uint64_t total = 0;
+    for (size_t i = 0; i < iters; i++) {
+        evocore_genome_t dst;
+        memset(&dst, 0, sizeof(dst));
+
+        uint64_t t0 = now_ns();
+        evocore_genome_clone(&src, &dst);
+        uint64_t dt = now_ns() - t0;
+
+        samples[i] = dt;
+        total += dt;
+        evocore_genome_cleanup(&dst);
+    }
+
+    report("genome_clone", "micro", samples, iters, iters, total);
+    evocore_genome_cleanup(&src);
+}
+
+/*========================================================================
+ * Macrobenchmark Harness
+ *========================================================================*/
+
+typedef double (*bench_fitness_fn)(const evocore_genome_t *genome, void *context);
+typedef void (*bench_mutate_fn)(evocore_genome_t *genome, unsigned *seed, void *context);
+typedef void (*bench_seed_fn)(evocore_genome_t *genome, unsigned *seed, void *context);
+
+/**
+ * Fixed-seed generational GA shared by the macro benchmarks
+ *
+ * Elitist tournament selection, the same shape as the example domains.
+ * One latency sample per generation; ops counted as fitness evaluations.
+ */
+static void run_macro(
+    const char *name,
+    size_t genome_size,
+    bench_fitness_fn fitness_fn,
+    bench_mutate_fn mutate_fn,
+    bench_seed_fn seed_fn,
+    void *context,
+    uint64_t *samples
+) {
+    const size_t pop_size = 64;
+    const size_t elite = 8;
+    const size_t generations = 150;
+    unsigned seed = 42;
+
+    evocore_population_t pop;
+    evocore_population_init(&pop, pop_size);
+
+    for (size_t i = 0; i < pop_size; i++) {
+        evocore_genome_t genome;
+        evocore_genome_init(&genome, genome_size);
+        genome.size = genome.capacity;
+        seed_fn(&genome, &seed, context);
+        evocore_population_add(&pop, &genome, fitness_fn(&genome, context));
+        evocore_genome_cleanup(&genome);
+    }
+
+    uint64_t total = 0;
+    uint64_t evaluations = 0;
+
+    for (size_t gen = 0; gen < generations; gen++) {
+        uint64_t t0 = now_ns();
+
+        evocore_population_sort(&pop);
+        for (size_t i = elite; i < pop.size; i++) {
+            size_t i1 = rand_r(&seed) % elite;
+            size_t i2 = rand_r(&seed) % elite;
+            size_t winner = (pop.individuals[i1].fitness >
+                             pop.individuals[i2].fitness) ? i1 : i2;
+
+            evocore_genome_t *parent = pop.individuals[winner].genome;
+            evocore_genome_t *child = pop.individuals[i].genome;
+            memcpy(child->data, parent->data, genome_size);
+            child->size = parent->size;
+
+            mutate_fn(child, &seed, context);
+            pop.individuals[i].fitness = fitness_fn(child, context);
+            evaluations++;
+        }
+        evocore_population_update_stats(&pop);
+
+        uint64_t dt = now_ns() - t0;
+        samples[gen] = dt;
+        total += dt;
+    }
+
+    report(name, "macro", samples, generations, evaluations, total);
+    evocore_population_cleanup(&pop);
+}
+
+/*========================================================================
+ * Sphere Domain
+ *========================================================================*/
+
+#define SPHERE_DIMS 16
+
+static double sphere_fitness(const evocore_genome_t *genome, void *context) {
+    (void)context;
+    const double *x = (const double*)genome->data;
+    double sum = 0.0;
+    for (int i = 0; i < SPHERE_DIMS; i++) {
+        sum += x[i] * x[i];
+    }
+    return -sum;
+}
+
+static void sphere_seed(evocore_genome_t *genome, unsigned *seed, void *context) {
+    (void)context;
+    double *x = (double*)genome->data;
+    for (int i = 0; i < SPHERE_DIMS; i++) {
+        x[i] = (double)rand_r(seed) / RAND_MAX * 10.0 - 5.0;
+    }
+}
+
+static void sphere_mutate(evocore_genome_t *genome, unsigned *seed, void *context) {
+    (void)context;
+    double *x = (double*)genome->data;
+    for (int i = 0; i < SPHERE_DIMS; i++) {
+        if (rand_r(seed) % 100 < 20) {
+            x[i] += ((double)rand_r(seed) / RAND_MAX - 0.5) * 0.5;
+        }
+    }
+}
+
+/*========================================================================
+ * TSP Domain
+ *========================================================================*/
+
+#define TSP_CITIES 48
+
+typedef struct {
+    double x[TSP_CITIES];
+    double y[TSP_CITIES];
+} tsp_context_t;
+
+static double tsp_fitness(const evocore_genome_t *genome, void *context) {
+    tsp_context_t *ctx = (tsp_context_t*)context;
+    const unsigned char *tour = (const unsigned char*)genome->data;
+
+    double length = 0.0;
+    for (int i = 0; i < TSP_CITIES; i++) {
+        int a = tour[i];
+        int b = tour[(i + 1) % TSP_CITIES];
+        double dx = ctx->x[a] - ctx->x[b];
+        double dy = ctx->y[a] - ctx->y[b];
+        length += sqrt(dx * dx + dy * dy);
+    }
+    return -length;
+}
+
+static void tsp_seed(evocore_genome_t *genome, unsigned *seed, void *context) {
+    (void)context;
+    unsigned char *tour = (unsigned char*)genome->data;
+    for (int i = 0; i < TSP_CITIES; i++) tour[i] = (unsigned char)i;
+
+    /* Fisher-Yates shuffle */
+    for (int i = TSP_CITIES - 1; i > 0; i--) {
+        int j = rand_r(seed) % (i + 1);
+        unsigned char tmp = tour[i];
+        tour[i] = tour[j];
+        tour[j] = tmp;
+    }
+}
+
+static void tsp_mutate(evocore_genome_t *genome, unsigned *seed, void *context) {
+    (void)context;
+    unsigned char *tour = (unsigned char*)genome->data;
+    int a = rand_r(seed) % TSP_CITIES;
+    int b = rand_r(seed) % TSP_CITIES;
+    unsigned char tmp = tour[a];
+    tour[a] = tour[b];
+    tour[b] = tmp;
+}
+
+/*========================================================================
+ * Trading Domain
+ *========================================================================*/
+
+#define TRADING_BARS 1000
+#define TRADING_PARAMS 4
+
+typedef struct {
+    double prices[TRADING_BARS];
+} trading_context_t;
+
+/**
+ * Moving-average crossover on a synthetic random-walk price series.
+ * Parameters: fast window, slow window (scaled to bar counts), entry
+ * threshold, position size.
+ */
+static double trading_fitness(const evocore_genome_t *genome, void *context) {
+    trading_context_t *ctx = (trading_context_t*)context;
+    const double *p = (const double*)genome->data;
+
+    int fast = 2 + (int)(fabs(p[0]) * 20.0) % 20;
+    int slow = fast + 1 + (int)(fabs(p[1]) * 50.0) % 50;
+    double threshold = fabs(p[2]) * 0.01;
+    double size = fmin(1.0, fabs(p[3]));
+
+    double pnl = 0.0;
+    double position = 0.0;
+
+    for (int i = slow; i < TRADING_BARS; i++) {
+        double fast_ma = 0.0, slow_ma = 0.0;
+        for (int j = i - fast; j < i; j++) fast_ma += ctx->prices[j];
+        for (int j = i - slow; j < i; j++) slow_ma += ctx->prices[j];
+        fast_ma /= fast;
+        slow_ma /= slow;
+
+        double signal = (fast_ma - slow_ma) / slow_ma;
+        double new_position = 0.0;
+        if (signal > threshold) new_position = size;
+        else if (signal < -threshold) new_position = -size;
+
+        pnl += position * (ctx->prices[i] - ctx->prices[i - 1]);
+        position = new_position;
+    }
+
+    return pnl;
+}
+
+static void trading_seed(evocore_genome_t *genome, unsigned *seed, void *context) {
+    (void)context;
+    double *p = (double*)genome->data;
+    for (int i = 0; i < TRADING_PARAMS; i++) {
+        p[i] = (double)rand_r(seed) / RAND_MAX;
+    }
+}
+
+static void trading_mutate(evocore_genome_t *genome, unsigned *seed, void *context) {
+    (void)context;
+    double *p = (double*)genome->data;
+    int i = rand_r(seed) % TRADING_PARAMS;
+    p[i] += ((double)rand_r(seed) / RAND_MAX - 0.5) * 0.2;
+}
+
+/*========================================================================
+ * Main
+ *========================================================================*/
+
+int main(int argc, char *argv[]) {
+    const char *output_path = (argc > 1) ? argv[1] : "bench_results.json";
+
+    g_json = fopen(output_path, "w");
+    if (!g_json) {
+        fprintf(stderr, "Failed to open %s for writing\n", output_path);
+        return 1;
+    }
+
+    uint64_t *samples = calloc(MAX_SAMPLES, sizeof(uint64_t));
+    if (!samples) {
+        fprintf(stderr, "Failed to allocate sample buffer\n");
+        fclose(g_json);
+        return 1;
+    }
+
+    fprintf(stderr, "evocore benchmark suite (%s)\n", EVOCORE_VERSION_STRING);
+    fprintf(stderr, "Microbenchmarks:\n");
+
+    fprintf(g_json, "{\n  \"version\": \"%s\",\n  \"benchmarks\": [",
+            EVOCORE_VERSION_STRING);
+
+    bench_mempool_alloc(samples);
+    bench_context_learn(samples);
+    bench_population_sort(samples);
+    bench_genome_clone(samples);
+
+    fprintf(stderr, "Macrobenchmarks (ops = fitness evaluations, "
+                    "latency = per generation):\n");
+
+    run_macro("sphere_evolution", SPHERE_DIMS * sizeof(double),
+              sphere_fitness, sphere_mutate, sphere_seed, NULL, samples);
+
+    tsp_context_t tsp_ctx;
+    unsigned tsp_seed_val = 7;
+    for (int i = 0; i < TSP_CITIES; i++) {
+        tsp_ctx.x[i] = (double)rand_r(&tsp_seed_val) / RAND_MAX * 100.0;
+        tsp_ctx.y[i] = (double)rand_r(&tsp_seed_val) / RAND_MAX * 100.0;
+    }
+    run_macro("tsp_evolution", TSP_CITIES,
+              tsp_fitness, tsp_mutate, tsp_seed, &tsp_ctx, samples);
+
+    trading_context_t trading_ctx;
+    unsigned trading_seed_val = 9;
+    trading_ctx.prices[0] = 100.0;
+    for (int i = 1; i < TRADING_BARS; i++) {
+        double step = ((double)rand_r(&trading_seed_val) / RAND_MAX - 0.5) * 0.5;
+        trading_ctx.prices[i] = trading_ctx.prices[i - 1] + step;
+    }
+    run_macro("trading_evolution", TRADING_PARAMS * sizeof(double),
+              trading_fitness, trading_mutate, trading_seed, &trading_ctx, samples);
+
+    fprintf(g_json, "\n  ]\n}\n");
+    fclose(g_json);
+    fprintf(stderr, "Results written to %s\n", output_path);
+
+    free(samples);
+    return 0;
+}
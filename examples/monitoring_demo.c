@@ -131,6 +131,18 @@ static int run_evolution_with_monitoring(void) {
                                   &verbose);
     reporter.report_every_n_generations = 5;
 
+    /* Async metrics: the exporter thread writes the CSV so the
+     * generation loop only pays for a ring push */
+    evocore_metrics_config_t metrics_config = EVOCORE_METRICS_DEFAULTS;
+    metrics_config.path = "monitoring_metrics.csv";
+    evocore_metrics_t *metrics = evocore_metrics_create(&metrics_config);
+
+    evocore_progress_reporter_t metrics_reporter;
+    evocore_progress_reporter_init(&metrics_reporter,
+                                  evocore_metrics_progress_callback,
+                                  metrics);
+    metrics_reporter.report_every_n_generations = 1;
+
     /* Initialize population */
     evocore_population_t pop;
     evocore_population_init(&pop, 100);
@@ -221,6 +233,9 @@ static int run_evolution_with_monitoring(void) {
 
         /* Report progress */
         evocore_progress_report(&reporter, stats);
+        if (metrics) {
+            evocore_progress_report(&metrics_reporter, stats);
+        }
 
         /* Check stagnation */
         if (evocore_stats_is_stagnant(stats)) {
@@ -253,6 +268,15 @@ static int run_evolution_with_monitoring(void) {
     double diversity = evocore_stats_diversity(&pop);
     printf("Population Diversity: %.4f (0=identical, 1=very diverse)\n", diversity);
 
+    if (metrics) {
+        uint64_t pushed, dropped, exported;
+        evocore_metrics_flush(metrics);
+        evocore_metrics_get_stats(metrics, &pushed, &dropped, &exported);
+        printf("Metrics: %llu exported, %llu dropped (monitoring_metrics.csv)\n",
+               (unsigned long long)exported, (unsigned long long)dropped);
+        evocore_metrics_destroy(metrics);
+    }
+
     /* Generate diagnostic report */
     printf("\n=== Diagnostic Report ===\n");
 
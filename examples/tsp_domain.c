@@ -21,12 +21,21 @@
 
 #define MAX_CITIES 50
 
+/* Nearest neighbors kept per city for candidate-guided 2-opt moves */
+#define TSP_NEIGHBORS 8
+
 typedef struct {
     int num_cities;
     double x[MAX_CITIES];
     double y[MAX_CITIES];
-    /* Precomputed distance matrix for efficiency */
-    double distances[MAX_CITIES][MAX_CITIES];
+    /* Precomputed distance matrix, row-major so tour evaluation
+     * streams one contiguous row per city. Stored as float: half the
+     * footprint of double, so larger instances stay cache-resident,
+     * and single precision is ample for ranking tours. */
+    float *distances;
+    /* neighbors[i*neighbor_count + k] = k-th nearest city to i */
+    int *neighbors;
+    int neighbor_count;
 } tsp_problem_t;
 
 typedef struct {
@@ -43,15 +52,69 @@ static double distance(double x1, double y1, double x2, double y2) {
     return sqrt(dx * dx + dy * dy);
 }
 
-static void precompute_distances(tsp_problem_t *problem) {
-    for (int i = 0; i < problem->num_cities; i++) {
-        for (int j = 0; j < problem->num_cities; j++) {
-            problem->distances[i][j] = distance(
+static float city_distance(const tsp_problem_t *problem, int i, int j) {
+    return problem->distances[(size_t)i * problem->num_cities + j];
+}
+
+/* Build the distance matrix and per-city nearest-neighbor lists once
+ * at problem setup. Returns false on allocation failure. */
+static bool tsp_problem_setup(tsp_problem_t *problem) {
+    int n = problem->num_cities;
+
+    problem->distances = malloc((size_t)n * n * sizeof(float));
+    if (!problem->distances) return false;
+
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            problem->distances[(size_t)i * n + j] = (float)distance(
                 problem->x[i], problem->y[i],
                 problem->x[j], problem->y[j]
             );
         }
     }
+
+    /* Candidate lists: the k nearest cities to each city, nearest
+     * first. Selection over each row is O(n*k) which is fine at
+     * setup time. */
+    int k = TSP_NEIGHBORS < n - 1 ? TSP_NEIGHBORS : n - 1;
+    problem->neighbor_count = k;
+    problem->neighbors = malloc((size_t)n * k * sizeof(int));
+    if (!problem->neighbors) {
+        free(problem->distances);
+        problem->distances = NULL;
+        return false;
+    }
+
+    for (int i = 0; i < n; i++) {
+        int *list = &problem->neighbors[(size_t)i * k];
+        for (int slot = 0; slot < k; slot++) {
+            int best = -1;
+            float best_dist = 0.0f;
+            for (int j = 0; j < n; j++) {
+                if (j == i) continue;
+                bool taken = false;
+                for (int s = 0; s < slot; s++) {
+                    if (list[s] == j) { taken = true; break; }
+                }
+                if (taken) continue;
+                float d = city_distance(problem, i, j);
+                if (best < 0 || d < best_dist) {
+                    best = j;
+                    best_dist = d;
+                }
+            }
+            list[slot] = best;
+        }
+    }
+
+    return true;
+}
+
+static void tsp_problem_cleanup(tsp_problem_t *problem) {
+    free(problem->distances);
+    free(problem->neighbors);
+    problem->distances = NULL;
+    problem->neighbors = NULL;
 }
 
 /* Calculate tour length for a permutation */
@@ -63,12 +126,13 @@ static double tour_length(const tsp_genome_t *genome,
     for (int i = 0; i < n - 1; i++) {
         int from = genome->permutation[i];
         int to = genome->permutation[i + 1];
-        total += problem->distances[from][to];
+        total += city_distance(problem, from, to);
     }
 
     /* Return to start */
-    total += problem->distances[genome->permutation[n - 1]]
-                               [genome->permutation[0]];
+    total += city_distance(problem,
+                           genome->permutation[n - 1],
+                           genome->permutation[0]);
 
     return total;
 }
@@ -105,6 +169,18 @@ static void tsp_random_init(evocore_genome_t *genome, void *context) {
     evocore_genome_set_size(genome, sizeof(int) * problem->num_cities);
 }
 
+/* Reverse the cyclic segment perm[i..j] in place */
+static void reverse_segment(int *perm, int i, int j, int n) {
+    int len = (j - i + n) % n + 1;
+    for (int k = 0; k < len / 2; k++) {
+        int a = (i + k) % n;
+        int b = (j - k + n) % n;
+        int temp = perm[a];
+        perm[a] = perm[b];
+        perm[b] = temp;
+    }
+}
+
 static void tsp_mutate(evocore_genome_t *genome, double rate, void *context) {
     tsp_problem_t *problem = (tsp_problem_t*)context;
     tsp_genome_t tsp_genome;
@@ -112,18 +188,47 @@ static void tsp_mutate(evocore_genome_t *genome, double rate, void *context) {
                       sizeof(int) * problem->num_cities);
 
     int n = problem->num_cities;
+    int *perm = tsp_genome.permutation;
     int num_mutations = (int)(n * rate);
 
     if (num_mutations < 1) num_mutations = 1;
 
+    int pos[MAX_CITIES];
+
     for (int m = 0; m < num_mutations; m++) {
-        /* 2-opt mutation: swap two random cities */
+        /* Candidate-guided 2-opt: break edge (a,b), reconnect a to one
+         * of its precomputed nearest neighbors c, and reverse the
+         * segment in between. Applied when it shortens the tour;
+         * otherwise fall back to a random swap for exploration. */
+        for (int i = 0; i < n; i++) {
+            pos[perm[i]] = i;
+        }
+
         int i = rand() % n;
-        int j = rand() % n;
+        int a = perm[i];
+        int b = perm[(i + 1) % n];
+        int c = problem->neighbors[(size_t)a * problem->neighbor_count
+                                   + rand() % problem->neighbor_count];
+        int j = pos[c];
+        int d = perm[(j + 1) % n];
+
+        if (c != b && d != a && c != a) {
+            double delta = (double)city_distance(problem, a, c)
+                         + (double)city_distance(problem, b, d)
+                         - (double)city_distance(problem, a, b)
+                         - (double)city_distance(problem, c, d);
+            if (delta < 0.0) {
+                reverse_segment(perm, (i + 1) % n, j, n);
+                continue;
+            }
+        }
 
-        int temp = tsp_genome.permutation[i];
-        tsp_genome.permutation[i] = tsp_genome.permutation[j];
-        tsp_genome.permutation[j] = temp;
+        /* Random swap fallback */
+        int u = rand() % n;
+        int v = rand() % n;
+        int temp = perm[u];
+        perm[u] = perm[v];
+        perm[v] = temp;
     }
 
     evocore_genome_write(genome, 0, &tsp_genome,
@@ -262,7 +367,10 @@ int main(void) {
         problem.y[i] = (double)rand() / RAND_MAX;
     }
 
-    precompute_distances(&problem);
+    if (!tsp_problem_setup(&problem)) {
+        printf("Failed to build distance matrix\n");
+        return 1;
+    }
 
     printf("City coordinates:\n");
     for (int i = 0; i < problem.num_cities; i++) {
@@ -388,6 +496,7 @@ int main(void) {
         evocore_genome_cleanup(&genomes[i]);
     }
     evocore_domain_registry_shutdown();
+    tsp_problem_cleanup(&problem);
 
     printf("\n=== Example Complete ===\n");
     return 0;
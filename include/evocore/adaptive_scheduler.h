@@ -95,6 +95,27 @@ typedef struct {
     /** Stagnation detection threshold (default: 20 generations) */
     size_t stagnation_threshold;
 
+    /* Rolling accumulators over the finite history entries, updated in
+     * O(1) as the circular buffer turns over; variance uses Welford
+     * with Chan-style downdating, trend keeps regression sums keyed by
+     * buffer position. Rebuilt from the buffer periodically to shed
+     * floating-point drift. */
+
+    /** Finite entries currently in the window */
+    size_t history_valid_count;
+
+    /** Welford mean of the finite entries */
+    double history_mean;
+
+    /** Welford sum of squared deviations */
+    double history_m2;
+
+    /** Regression sums for the improvement-rate slope */
+    double history_sum_x;
+    double history_sum_xx;
+    double history_sum_y;
+    double history_sum_xy;
+
     /* ========================================================================
      * Diversity Tracking
      * ======================================================================== */
@@ -2,6 +2,7 @@
 #define EVOCORE_ARENA_H
 
 #include "evocore/error.h"
+#include "evocore/genome.h"
 #include <stddef.h>
 #include <stdbool.h>
 
@@ -20,8 +21,16 @@
 
 /**
  * Arena alignment for allocations
+ *
+ * One cache line, so SIMD kernels can use aligned loads on
+ * arena-allocated genomes and adjacent allocations never share a line.
  */
-#define EVOCORE_ARENA_ALIGNMENT (2 * sizeof(void*))
+#define EVOCORE_ARENA_ALIGNMENT 64
+
+/**
+ * Arena init flags (evocore_arena_init_ex)
+ */
+#define EVOCORE_ARENA_HUGEPAGES (1u << 0)  /* Back the arena with 2MB pages */
 
 /**
  * Default arena capacity
@@ -40,6 +49,9 @@ typedef struct {
     size_t offset;
     size_t alignment;
     bool owns_buffer;  /* true if we allocated the buffer, false if external */
+    bool uses_mmap;    /* Buffer came from mmap; cleanup must munmap */
+    bool huge_pages;   /* Buffer is backed by 2MB pages */
+    size_t map_size;   /* Mapped length (may exceed capacity for huge pages) */
 } evocore_arena_t;
 
 /**
@@ -64,6 +76,24 @@ typedef struct {
  */
 evocore_error_t evocore_arena_init(evocore_arena_t *arena, size_t capacity);
 
+/**
+ * Initialize an arena allocator with backing options
+ *
+ * With EVOCORE_ARENA_HUGEPAGES the buffer is mmap'd and backed by 2MB
+ * pages: explicit MAP_HUGETLB first, then transparent huge pages via
+ * madvise(MADV_HUGEPAGE) if the hugetlb pool is empty. Falls back to a
+ * normal heap buffer when neither is available, so the flag is a hint,
+ * not a requirement; check arena->huge_pages to see what was granted.
+ * Multi-GB arenas see measurably fewer TLB misses on 2MB pages.
+ *
+ * @param arena    Arena to initialize
+ * @param capacity Initial capacity in bytes
+ * @param flags    Bitwise OR of EVOCORE_ARENA_* flags, or 0
+ * @return EVOCORE_OK on success, error code otherwise
+ */
+evocore_error_t evocore_arena_init_ex(evocore_arena_t *arena, size_t capacity,
+                                      unsigned int flags);
+
 /**
  * Initialize an arena with a specific buffer
  *
@@ -89,6 +119,9 @@ void evocore_arena_cleanup(evocore_arena_t *arena);
 /**
  * Allocate memory from arena
  *
+ * The returned pointer is aligned to EVOCORE_ARENA_ALIGNMENT (64 bytes)
+ * even when the arena wraps an unaligned external buffer.
+ *
  * @param arena    Arena to allocate from
  * @param size     Size to allocate
  * @return Allocated pointer, or NULL if out of space
@@ -166,6 +199,71 @@ size_t evocore_arena_snapshot(evocore_arena_t *arena);
  */
 void evocore_arena_rewind(evocore_arena_t *arena, size_t offset);
 
+/*========================================================================
+ * Generation Scopes
+ * ========================================================================
+ *
+ * Generation-scoped allocation for transient genomes. Offspring and
+ * temporaries created during selection/crossover live only until the
+ * end of the generation, so they allocate from an arena with pointer
+ * bumps instead of malloc/free pairs. Survivors are promoted into
+ * population storage by the existing clone-on-add semantics of
+ * evocore_population_add/replace; ending the scope rewinds the arena
+ * and invalidates everything that was not promoted.
+ */
+
+/**
+ * Generation allocation scope
+ *
+ * Marks an arena position at generation start and rewinds to it at
+ * generation end.
+ */
+typedef struct {
+    evocore_arena_t *arena;
+    size_t mark;               /* Arena offset at scope begin */
+    size_t genomes_allocated;  /* Genomes served from the arena */
+    size_t heap_fallbacks;     /* Genomes that fell back to malloc */
+} evocore_generation_scope_t;
+
+/**
+ * Begin a generation scope
+ *
+ * @param scope    Scope to initialize
+ * @param arena    Arena backing this generation's temporaries
+ * @return EVOCORE_OK on success, error code otherwise
+ */
+evocore_error_t evocore_generation_begin(evocore_generation_scope_t *scope,
+                                     evocore_arena_t *arena);
+
+/**
+ * Initialize a transient genome from the scope's arena
+ *
+ * The genome's bytes are bump-allocated and zeroed; owns_memory is
+ * false, so evocore_genome_cleanup is a no-op and the bytes are
+ * reclaimed when the scope ends. When the arena is out of space the
+ * genome falls back to a normal heap allocation (and cleanup frees it
+ * as usual), so callers treat scoped genomes exactly like heap ones.
+ *
+ * @param scope     Active generation scope
+ * @param genome    Genome to initialize
+ * @param capacity  Genome capacity in bytes
+ * @return EVOCORE_OK on success, error code otherwise
+ */
+evocore_error_t evocore_generation_genome(evocore_generation_scope_t *scope,
+                                      evocore_genome_t *genome,
+                                      size_t capacity);
+
+/**
+ * End a generation scope
+ *
+ * Rewinds the arena to the scope's mark. Every genome handed out by
+ * evocore_generation_genome is invalid afterwards; survivors must have
+ * been promoted (cloned into a population) first.
+ *
+ * @param scope    Scope to end
+ */
+void evocore_generation_end(evocore_generation_scope_t *scope);
+
 /**
  * Get arena statistics
  *
@@ -0,0 +1,134 @@
+#ifndef EVOCORE_COMPRESS_H
+#define EVOCORE_COMPRESS_H
+
+#include <stddef.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include "evocore/error.h"
+
+/**
+ * Block Compression
+ *
+ * Self-contained LZ77 byte codec (LZ4-class: token/literal/match
+ * sequences with 16-bit offsets, favoring speed over ratio) plus a
+ * block-based frame container. Frames compress the input in
+ * independent EVOCORE_COMPRESS_BLOCK_SIZE blocks with a size table up
+ * front, so a reader can locate and decompress only the blocks
+ * covering a byte range - random access into mmap'd checkpoints
+ * still works without inflating the whole file. Blocks that do not
+ * shrink are stored raw.
+ *
+ * Used by the persistence layer for transparent checkpoint
+ * compression; see evocore_serial_options_t.compression_level.
+ */
+
+/**
+ * Uncompressed bytes per frame block
+ */
+#define EVOCORE_COMPRESS_BLOCK_SIZE 65536
+
+/*========================================================================
+ * Block Codec
+ *========================================================================*/
+
+/**
+ * Worst-case compressed size for src_size input bytes
+ *
+ * @param src_size  Uncompressed size
+ * @return Upper bound on evocore_compress_block output
+ */
+size_t evocore_compress_bound(size_t src_size);
+
+/**
+ * Compress one block
+ *
+ * @param src       Input bytes
+ * @param src_size  Input size (at most EVOCORE_COMPRESS_BLOCK_SIZE)
+ * @param dst       Output buffer
+ * @param dst_cap   Output capacity (evocore_compress_bound bytes is
+ *                  always enough)
+ * @return Compressed size, or 0 if the input does not fit/shrink
+ */
+size_t evocore_compress_block(const unsigned char *src, size_t src_size,
+                            unsigned char *dst, size_t dst_cap);
+
+/**
+ * Decompress one block
+ *
+ * @param src       Compressed bytes from evocore_compress_block
+ * @param src_size  Compressed size
+ * @param dst       Output buffer
+ * @param dst_cap   Output capacity
+ * @return Decompressed size, or 0 on corrupt input or overflow
+ */
+size_t evocore_decompress_block(const unsigned char *src, size_t src_size,
+                              unsigned char *dst, size_t dst_cap);
+
+/*========================================================================
+ * Frame Container
+ *========================================================================*/
+
+/**
+ * Check whether a buffer starts with a compression frame header
+ *
+ * @param buffer    Candidate bytes
+ * @param size      Buffer size
+ * @return true if the frame magic is present
+ */
+bool evocore_compress_frame_detect(const void *buffer, size_t size);
+
+/**
+ * Compress a buffer into a block-based frame
+ *
+ * Allocates the output; the caller frees it with evocore_free.
+ *
+ * @param src       Input bytes
+ * @param src_size  Input size
+ * @param out       Receives the allocated frame
+ * @param out_size  Receives the frame size
+ * @return EVOCORE_OK on success, error code otherwise
+ */
+evocore_error_t evocore_compress_frame(const void *src, size_t src_size,
+                                   void **out, size_t *out_size);
+
+/**
+ * Decompress a whole frame
+ *
+ * Allocates the output; the caller frees it with evocore_free.
+ *
+ * @param frame       Frame from evocore_compress_frame
+ * @param frame_size  Frame size
+ * @param out         Receives the allocated uncompressed bytes
+ * @param out_size    Receives the uncompressed size
+ * @return EVOCORE_OK on success, error code otherwise
+ */
+evocore_error_t evocore_decompress_frame(const void *frame, size_t frame_size,
+                                     void **out, size_t *out_size);
+
+/**
+ * Read a byte range out of a frame without inflating the whole file
+ *
+ * Decompresses only the blocks covering [offset, offset + length).
+ * The frame may be an mmap'd checkpoint; it is not modified.
+ *
+ * @param frame       Frame from evocore_compress_frame
+ * @param frame_size  Frame size
+ * @param offset      Uncompressed byte offset to start at
+ * @param dst         Output buffer for length bytes
+ * @param length      Bytes to read
+ * @return EVOCORE_OK on success, error code otherwise
+ */
+evocore_error_t evocore_compress_frame_read(const void *frame, size_t frame_size,
+                                        size_t offset, void *dst,
+                                        size_t length);
+
+/**
+ * Uncompressed size recorded in a frame header
+ *
+ * @param frame       Frame bytes
+ * @param frame_size  Frame size
+ * @return Raw size, or 0 if the header is invalid
+ */
+size_t evocore_compress_frame_raw_size(const void *frame, size_t frame_size);
+
+#endif /* EVOCORE_COMPRESS_H */
@@ -445,6 +445,109 @@ bool evocore_context_export_csv(
     const char *filepath
 );
 
+/*========================================================================
+ * Write-Ahead Log
+ * ========================================================================
+ *
+ * evocore_context_save_binary rewrites the whole store, which only
+ * scales to occasional snapshots. The WAL makes every learn durable:
+ * with a log attached, evocore_context_learn appends one compact
+ * binary record per experience and fsyncs in groups, so a crash loses
+ * at most the last unsynced group instead of everything since the
+ * last snapshot. Replaying the log over the matching snapshot
+ * reproduces the learned state exactly, since learning is
+ * deterministic in the sequence of experiences. Compaction folds the
+ * current state into a fresh snapshot and truncates the log.
+ */
+
+/**
+ * Attach a write-ahead log to a context system
+ *
+ * Creates the log (or appends to an existing one) and makes every
+ * subsequent learn append a record. Records are buffered and the file
+ * is fsync'd after every `sync_interval` records (group commit);
+ * 0 syncs only on evocore_context_wal_sync/close/compact.
+ *
+ * @param system        Context system
+ * @param filepath      Log file path
+ * @param sync_interval Records per group commit (0 = manual sync only)
+ * @return true on success
+ */
+bool evocore_context_wal_open(
+    evocore_context_system_t *system,
+    const char *filepath,
+    size_t sync_interval
+);
+
+/**
+ * Force a group commit
+ *
+ * Flushes buffered records and fsyncs the log.
+ *
+ * @param system Context system with an attached log
+ * @return true on success
+ */
+bool evocore_context_wal_sync(evocore_context_system_t *system);
+
+/**
+ * Detach and close the write-ahead log
+ *
+ * Syncs outstanding records first. Learning continues without
+ * durability afterwards.
+ *
+ * @param system Context system
+ */
+void evocore_context_wal_close(evocore_context_system_t *system);
+
+/**
+ * Compact the log into a snapshot
+ *
+ * Writes the full store with evocore_context_save_binary, then
+ * truncates the attached log: the snapshot now covers everything the
+ * log recorded. Recovery = load the snapshot, replay the (short) log.
+ *
+ * @param system        Context system with an attached log
+ * @param snapshot_path Snapshot file path
+ * @return true on success
+ */
+bool evocore_context_compact(
+    evocore_context_system_t *system,
+    const char *snapshot_path
+);
+
+/**
+ * Replay a write-ahead log into a context system
+ *
+ * Re-applies every record as a learn. A torn record at the tail (from
+ * a crash mid-append) ends the replay cleanly.
+ *
+ * @param system   Context system (typically freshly loaded snapshot)
+ * @param filepath Log file path
+ * @return true on success (including an empty or absent log)
+ */
+bool evocore_context_replay_wal(
+    evocore_context_system_t *system,
+    const char *filepath
+);
+
+/**
+ * Load a snapshot and replay its write-ahead log
+ *
+ * Convenience recovery path: evocore_context_load_binary on the
+ * snapshot followed by evocore_context_replay_wal. The snapshot must
+ * exist; the log may be absent or empty.
+ *
+ * @param snapshot_path Snapshot file path
+ * @param wal_path      Log file path (may not exist)
+ * @param out_system    Output context system
+ * @return true on success
+ */
+bool evocore_context_load_binary_wal(
+    const char *snapshot_path,
+    const char *wal_path,
+    evocore_context_system_t **out_system
+);
+
 /*========================================================================
  * Negative Learning Integration
  *========================================================================*/
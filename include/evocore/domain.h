@@ -4,6 +4,8 @@
 #include "evocore/genome.h"
 #include "evocore/fitness.h"
 #include "evocore/error.h"
+#include "evocore/gpu.h"
+#include "evocore/optimize.h"
 
 /*========================================================================
  * Domain System
@@ -129,6 +131,29 @@ typedef struct {
                           char *buffer,
                           size_t size,
                           void *context);
+
+    /**
+     * Optional: GPU kernel launcher for batch fitness evaluation
+     *
+     * When set, batches bound through evocore_domain_bind_gpu_kernel
+     * run the domain's device-side fitness instead of falling back to
+     * the CPU fitness callback. The launcher is called with device
+     * pointers and receives user_context; it is typically implemented
+     * in the domain's .cu file next to src/cuda/fitness.cu.
+     */
+    evocore_gpu_kernel_launch_t gpu_fitness;
+
+    /**
+     * Optional: Batched CPU fitness evaluation
+     *
+     * When set, evocore_domain_evaluate_population and
+     * evocore_cpu_evaluate_batch hand the domain whole arrays of
+     * genomes instead of calling fitness per genome, so precomputed
+     * state (price series, distance matrices) is loaded once per batch
+     * and the domain picks its own parallelism granularity. The scalar
+     * fitness callback must still be provided as a fallback.
+     */
+    evocore_batch_fitness_func_t evaluate_batch;
 } evocore_domain_t;
 
 /*========================================================================
@@ -174,6 +199,11 @@ evocore_error_t evocore_unregister_domain(const char *name);
 /**
  * Get domain by name
  *
+ * Hash-indexed lookup. The returned pointer is a stable handle that
+ * stays valid until any domain is unregistered or the registry shuts
+ * down; resolve once and pass it to the handle-based helpers below
+ * instead of looking up by name per call.
+ *
  * @param name      Domain name to lookup
  * @return Domain pointer, or NULL if not found
  */
@@ -219,6 +249,21 @@ const char* evocore_domain_name(int index);
 evocore_error_t evocore_domain_create_genome(const char *domain_name,
                                          evocore_genome_t *genome);
 
+/**
+ * Create a random genome for an already-resolved domain
+ *
+ * Handle-based variant of evocore_domain_create_genome: resolve the
+ * domain once with evocore_get_domain and reuse the pointer in hot
+ * loops. The handle stays valid until any domain is unregistered or
+ * the registry shuts down.
+ *
+ * @param domain    Domain handle from evocore_get_domain
+ * @param genome    Genome to initialize
+ * @return EVOCORE_OK on success, error code otherwise
+ */
+evocore_error_t evocore_domain_create_genome_for(const evocore_domain_t *domain,
+                                             evocore_genome_t *genome);
+
 /**
  * Mutate a genome using its domain
  *
@@ -252,4 +297,70 @@ double evocore_domain_diversity(const evocore_genome_t *a,
                               const evocore_genome_t *b,
                               const evocore_domain_t *domain);
 
+/**
+ * Attach a domain's GPU kernel to an evaluation batch
+ *
+ * Copies the domain's gpu_fitness launcher and user_context into the
+ * batch so evocore_gpu_evaluate_batch dispatches to the domain kernel.
+ * Clears the batch kernel when the domain has none, which restores the
+ * CPU fallback behavior.
+ *
+ * @param domain    Domain providing the kernel (may have gpu_fitness = NULL)
+ * @param batch     Batch to bind
+ * @return EVOCORE_OK on success, error code otherwise
+ */
+evocore_error_t evocore_domain_bind_gpu_kernel(const evocore_domain_t *domain,
+                                           evocore_eval_batch_t *batch);
+
+/**
+ * Attach a domain's batch evaluator to an evaluation batch
+ *
+ * Copies the domain's evaluate_batch callback and user_context into
+ * the batch so evocore_cpu_evaluate_batch evaluates the whole batch in
+ * one call. Clears the batch evaluator when the domain has none, which
+ * restores per-genome evaluation.
+ *
+ * @param domain    Domain providing the evaluator (may have evaluate_batch = NULL)
+ * @param batch     Batch to bind
+ * @return EVOCORE_OK on success, error code otherwise
+ */
+evocore_error_t evocore_domain_bind_batch_eval(const evocore_domain_t *domain,
+                                           evocore_eval_batch_t *batch);
+
+/**
+ * Evaluate a population using a domain
+ *
+ * Prefers the domain's evaluate_batch callback, handing it the whole
+ * population in one call; falls back to the scalar fitness callback
+ * through evocore_parallel_evaluate_population (or a serial loop when
+ * ctx is NULL).
+ *
+ * @param ctx       Parallel context for the scalar fallback (can be NULL)
+ * @param pop       Population to evaluate
+ * @param domain    Domain providing the fitness callbacks
+ * @return EVOCORE_OK on success, error code otherwise
+ */
+evocore_error_t evocore_domain_evaluate_population(evocore_parallel_ctx_t *ctx,
+                                               evocore_population_t *pop,
+                                               const evocore_domain_t *domain);
+
+/**
+ * Replace duplicate genomes with fresh random ones
+ *
+ * Converged populations accumulate byte-identical genomes that waste
+ * evaluations and distort selection pressure. This finds duplicates in
+ * O(n) using cached genome fingerprints (confirming each fingerprint
+ * match with a byte compare), reinitializes them through the domain's
+ * random_init callback (evocore_genome_randomize when the domain has
+ * none), and resets their fitness so they are re-evaluated.
+ *
+ * @param pop       Population to deduplicate
+ * @param domain    Domain providing random_init
+ * @param replaced  Out: number of individuals replaced (can be NULL)
+ * @return EVOCORE_OK on success, error code otherwise
+ */
+evocore_error_t evocore_domain_dedup_population(evocore_population_t *pop,
+                                            const evocore_domain_t *domain,
+                                            size_t *replaced);
+
 #endif /* EVOCORE_DOMAIN_H */
@@ -41,7 +41,12 @@ typedef enum {
     /* File I/O errors */
     EVOCORE_ERR_FILE_NOT_FOUND = -40,
     EVOCORE_ERR_FILE_READ = -41,
-    EVOCORE_ERR_FILE_WRITE = -42
+    EVOCORE_ERR_FILE_WRITE = -42,
+
+    /* Network errors */
+    EVOCORE_ERR_NET = -50,            /* Socket operation failed */
+    EVOCORE_ERR_TIMEOUT = -51,        /* Deadline passed */
+    EVOCORE_ERR_PROTOCOL = -52        /* Peer sent a malformed message */
 } evocore_error_t;
 
 /**
@@ -20,6 +20,7 @@
 #include "evocore/population.h"
 #include "evocore/domain.h"
 #include "evocore/meta.h"
+#include "evocore/meta_dist.h"
 
 /* Acceleration */
 #include "evocore/gpu.h"
@@ -40,5 +41,12 @@
 #include "evocore/temporal.h"
 #include "evocore/exploration.h"
 #include "evocore/synthesis.h"
+#include "evocore/vector_ops.h"
+#include "evocore/island.h"
+#include "evocore/metrics.h"
+#include "evocore/vptree.h"
+#include "evocore/compress.h"
+#include "evocore/steady_state.h"
+#include "evocore/random.h"
 
 #endif /* EVOCORE_H */
@@ -87,6 +87,26 @@ typedef struct {
     double ucb_c;               /* Exploration constant */
 } evocore_bandit_t;
 
+/**
+ * Boltzmann alias sampler
+ *
+ * Precomputed alias table over the softmax distribution, so draws are
+ * O(1) instead of walking the cumulative distribution per selection.
+ * Intended for large action spaces sampled many times between weight
+ * updates; the table is only rebuilt when the weights or temperature
+ * have drifted materially since the last build.
+ */
+typedef struct {
+    size_t count;               /* Number of arms */
+    double *prob;               /* Alias acceptance probabilities */
+    size_t *alias;              /* Alias partner per slot */
+    double *last_values;        /* Values at last rebuild */
+    double last_temperature;    /* Temperature at last rebuild */
+    bool built;                 /* Table valid */
+    size_t rebuilds;            /* Total table rebuilds */
+    size_t updates;             /* Total update calls */
+} evocore_boltzmann_sampler_t;
+
 /*========================================================================
  * Exploration Management
  *========================================================================*/
@@ -317,6 +337,54 @@ size_t evocore_boltzmann_select(
  */
 double evocore_cool_temperature(double temperature, double cooling_rate);
 
+/**
+ * Create a Boltzmann alias sampler
+ *
+ * @param count Number of arms
+ * @return New sampler, or NULL on error
+ */
+evocore_boltzmann_sampler_t* evocore_boltzmann_sampler_create(size_t count);
+
+/**
+ * Free a Boltzmann alias sampler
+ *
+ * @param sampler Sampler to free
+ */
+void evocore_boltzmann_sampler_free(evocore_boltzmann_sampler_t *sampler);
+
+/**
+ * Update sampler weights, rebuilding the alias table if needed
+ *
+ * Call this wherever evocore_exploration_update refreshes the arm
+ * values. The O(n) rebuild (with table-approximated batch exp) is
+ * skipped when no weight moved by more than about 0.1% relative to
+ * the temperature scale since the last build.
+ *
+ * @param sampler Sampler to update
+ * @param values Array of count arm values
+ * @param count Number of values (must match the sampler)
+ * @param temperature Temperature parameter (higher = more exploration)
+ * @return true on success, false on error
+ */
+bool evocore_boltzmann_sampler_update(
+    evocore_boltzmann_sampler_t *sampler,
+    const double *values,
+    size_t count,
+    double temperature
+);
+
+/**
+ * Draw one arm from the sampler in O(1)
+ *
+ * @param sampler Sampler with a built table
+ * @param seed Random seed pointer
+ * @return Index of selected arm
+ */
+size_t evocore_boltzmann_sampler_select(
+    evocore_boltzmann_sampler_t *sampler,
+    unsigned int *seed
+);
+
 /*========================================================================
  * Adaptive Exploration
  *========================================================================*/
@@ -16,4 +16,23 @@
 typedef double (*evocore_fitness_func_t)(const evocore_genome_t *genome,
                                        void *context);
 
+/**
+ * Batched fitness evaluation callback
+ *
+ * Evaluates many genomes in one call so domains can amortize setup
+ * (loading data series, building lookup tables) and vectorize or
+ * parallelize internally at whatever granularity suits them.
+ * Implementations must write one fitness per genome; NaN marks an
+ * invalid individual.
+ *
+ * @param genomes    Array of genome pointers
+ * @param fitnesses  Output array, one fitness per genome
+ * @param count      Number of genomes
+ * @param context    User-provided context pointer
+ */
+typedef void (*evocore_batch_fitness_func_t)(const evocore_genome_t **genomes,
+                                           double *fitnesses,
+                                           size_t count,
+                                           void *context);
+
 #endif /* EVOCORE_FITNESS_H */
@@ -3,6 +3,7 @@
 
 #include <stddef.h>
 #include <stdbool.h>
+#include <stdint.h>
 #include "evocore/error.h"
 
 /**
@@ -17,6 +18,7 @@ typedef struct {
     size_t size;             /* Current size in bytes */
     size_t capacity;         /* Allocated capacity */
     bool owns_memory;        /* Whether we allocated the memory */
+    uint64_t fingerprint;    /* Cached content hash (0 = not computed) */
 } evocore_genome_t;
 
 /**
@@ -173,6 +175,39 @@ evocore_error_t evocore_genome_zero(evocore_genome_t *genome);
  */
 evocore_error_t evocore_genome_randomize(evocore_genome_t *genome);
 
+/**
+ * Hash genome contents (FNV-1a over the data bytes)
+ *
+ * Used for cheap change detection, e.g. delta checkpoints only
+ * persist individuals whose hash moved since the last base.
+ *
+ * @param genome    Genome to hash
+ * @return 64-bit hash, or 0 for NULL/empty genomes
+ */
+uint64_t evocore_genome_hash(const evocore_genome_t *genome);
+
+/**
+ * Content fingerprint, computed lazily and cached on the genome
+ *
+ * Same value as evocore_genome_hash, but stored in the genome so
+ * repeated identity checks (dedup, fitness caching, diversity
+ * estimation) hash the bytes at most once between mutations. Writes
+ * through the genome API invalidate the cache automatically; code
+ * that mutates genome->data directly must call
+ * evocore_genome_fingerprint_invalidate first.
+ *
+ * @param genome    Genome to fingerprint
+ * @return 64-bit fingerprint, or 0 for NULL/empty genomes
+ */
+uint64_t evocore_genome_fingerprint(evocore_genome_t *genome);
+
+/**
+ * Drop the cached fingerprint after an out-of-band mutation
+ *
+ * @param genome    Genome whose data was modified directly
+ */
+void evocore_genome_fingerprint_invalidate(evocore_genome_t *genome);
+
 /**
  * Check if genome is valid (non-null data and size > 0)
  *
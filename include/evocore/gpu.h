@@ -52,6 +52,22 @@ typedef struct {
  * Batch Evaluation
  *========================================================================*/
 
+/**
+ * Domain-supplied GPU kernel launcher
+ *
+ * Launches a device-side fitness kernel over a flattened genome
+ * buffer. Pointers are device pointers; stream is a cudaStream_t
+ * passed as void* so this header stays CUDA-free (NULL = default
+ * stream). The launcher must not synchronize - the caller owns
+ * completion. Returns the number of genomes submitted, or 0 on error.
+ */
+typedef int (*evocore_gpu_kernel_launch_t)(const void *d_genomes,
+                                           void *d_fitnesses,
+                                           size_t genome_size,
+                                           int count,
+                                           void *stream,
+                                           void *context);
+
 /**
  * Batch evaluation request
  */
@@ -60,6 +76,18 @@ typedef struct {
     double *fitnesses;                 /* Output fitness array */
     size_t count;                      /* Number of genomes */
     size_t genome_size;                /* Size of each genome in bytes */
+
+    /* Optional domain kernel; when NULL the built-in benchmark kernel
+     * is used (see evocore_domain_bind_gpu_kernel) */
+    evocore_gpu_kernel_launch_t gpu_kernel;
+    void *gpu_kernel_context;
+
+    /* Optional domain batch evaluator for CPU paths; when set,
+     * evocore_cpu_evaluate_batch makes one call for the whole batch
+     * instead of invoking fitness_func per genome (see
+     * evocore_domain_bind_batch_eval) */
+    evocore_batch_fitness_func_t batch_eval;
+    void *batch_eval_context;
 } evocore_eval_batch_t;
 
 /**
@@ -188,6 +216,141 @@ evocore_error_t evocore_cpu_evaluate_batch(const evocore_eval_batch_t *batch,
                                        int num_threads,
                                        evocore_eval_result_t *result);
 
+/*========================================================================
+ * Persistent Evaluation Sessions
+ *========================================================================*/
+
+/**
+ * Persistent GPU evaluation session
+ *
+ * Keeps device genome/fitness buffers and pinned staging buffers alive
+ * across generations, so repeated batch evaluation avoids per-batch
+ * cudaMalloc and pageable host-to-device copies. Batches are pipelined
+ * across multiple CUDA streams to overlap upload, kernel, and download.
+ * Falls back to evocore_gpu_evaluate_batch when no device is available.
+ */
+typedef struct evocore_gpu_eval_session_s evocore_gpu_eval_session_t;
+
+/**
+ * Create a persistent evaluation session
+ *
+ * Pre-allocates device and pinned staging buffers sized for
+ * max_batch_size genomes of genome_size bytes per stream.
+ *
+ * @param ctx             GPU context
+ * @param max_batch_size  Maximum genomes per pipelined chunk
+ * @param genome_size     Size of each genome in bytes
+ * @return New session, or NULL on failure
+ */
+evocore_gpu_eval_session_t* evocore_gpu_eval_session_create(
+    evocore_gpu_context_t *ctx,
+    size_t max_batch_size,
+    size_t genome_size);
+
+/**
+ * Evaluate a batch through the session
+ *
+ * Reuses the session's persistent buffers; large batches are split
+ * into chunks and overlapped across the session streams.
+ *
+ * @param session       Evaluation session
+ * @param batch         Batch evaluation request
+ * @param fitness_func  Fitness function (for CPU fallback)
+ * @param user_context  User context for fitness function
+ * @param result        Output: evaluation results
+ * @return EVOCORE_OK on success, error code otherwise
+ */
+evocore_error_t evocore_gpu_eval_session_evaluate(
+    evocore_gpu_eval_session_t *session,
+    const evocore_eval_batch_t *batch,
+    evocore_fitness_func_t fitness_func,
+    void *user_context,
+    evocore_eval_result_t *result);
+
+/**
+ * Destroy an evaluation session
+ *
+ * Releases device buffers, pinned staging memory, and streams.
+ *
+ * @param session       Session to destroy (can be NULL)
+ */
+void evocore_gpu_eval_session_destroy(evocore_gpu_eval_session_t *session);
+
+/*========================================================================
+ * Pipelined Generation Evaluation
+ *========================================================================*/
+
+/**
+ * Produce callback: fill a staging batch with the next sub-batch
+ *
+ * Runs on the caller's thread while the previous sub-batch is being
+ * evaluated, so this is where selection/mutation work belongs. The
+ * callback sets batch->genomes, batch->fitnesses, and batch->count.
+ *
+ * @param batch         Staging batch to fill
+ * @param batch_index   Sub-batch number (0-based)
+ * @param user_context  User context
+ * @return EVOCORE_OK to continue, error code to abort the pipeline
+ */
+typedef evocore_error_t (*evocore_pipeline_produce_func_t)(
+    evocore_eval_batch_t *batch,
+    size_t batch_index,
+    void *user_context);
+
+/**
+ * Consume callback: harvest an evaluated sub-batch
+ *
+ * Called in submission order once a sub-batch's fitnesses are ready,
+ * overlapped with the evaluation of the following sub-batch.
+ *
+ * @param batch         Evaluated batch (fitnesses filled in)
+ * @param batch_index   Sub-batch number (0-based)
+ * @param result        Per-batch evaluation result
+ * @param user_context  User context
+ * @return EVOCORE_OK to continue, error code to abort the pipeline
+ */
+typedef evocore_error_t (*evocore_pipeline_consume_func_t)(
+    evocore_eval_batch_t *batch,
+    size_t batch_index,
+    const evocore_eval_result_t *result,
+    void *user_context);
+
+/**
+ * Double-buffered pipelined evaluation
+ *
+ * Splits a generation into sub-batches and overlaps CPU variation with
+ * evaluation: while sub-batch i runs through
+ * evocore_gpu_evaluate_batch on a worker thread, the caller's thread
+ * produces sub-batch i+1 into the other staging buffer and consumes
+ * i-1's results. With a GPU this hides kernel time behind variation
+ * (and vice versa); on CPU-only builds the worker still overlaps
+ * evaluation with variation across cores. Falls back to a sequential
+ * produce/evaluate/consume loop when threads are unavailable.
+ *
+ * The two staging batches alternate between produce and evaluate, so
+ * the produce callback must not touch genomes it filled on the
+ * previous call.
+ *
+ * @param ctx           GPU context
+ * @param staging       Two caller-owned staging batches
+ * @param batch_count   Number of sub-batches to run
+ * @param produce       Fills the next sub-batch (required)
+ * @param consume       Harvests evaluated sub-batches (NULL to skip)
+ * @param fitness_func  Fitness function for CPU evaluation
+ * @param user_context  Context for the callbacks and fitness function
+ * @param result        Output: aggregate result (can be NULL)
+ * @return EVOCORE_OK on success, first callback/evaluation error otherwise
+ */
+evocore_error_t evocore_gpu_evaluate_pipelined(
+    evocore_gpu_context_t *ctx,
+    evocore_eval_batch_t *staging[2],
+    size_t batch_count,
+    evocore_pipeline_produce_func_t produce,
+    evocore_pipeline_consume_func_t consume,
+    evocore_fitness_func_t fitness_func,
+    void *user_context,
+    evocore_eval_result_t *result);
+
 /*========================================================================
  * Memory Management
  *========================================================================*/
@@ -270,6 +433,77 @@ bool evocore_gpu_batch_fits(const evocore_gpu_context_t *ctx,
                           size_t genome_count,
                           size_t genome_size);
 
+/*========================================================================
+ * Batch Size Autotuning
+ *========================================================================*/
+
+/**
+ * Get the autotuned batch size for a device/kernel pair
+ *
+ * evocore_gpu_recommend_batch_size is a static estimate from free
+ * memory; the optimum differs several-fold between device generations
+ * and depends on the kernel. This returns the current proposal of an
+ * online hill-climbing search instead: evocore_gpu_evaluate_batch
+ * measures achieved throughput (genomes/ms) for every batch it runs,
+ * and the tuner grows or shrinks the size between calls until
+ * throughput stops improving. Feed the returned size back as your
+ * batch size each generation; once converged it stays fixed unless
+ * throughput drifts.
+ *
+ * State is kept per (current device, kernel, genome_size) triple, so
+ * different kernels on the same device tune independently. The first
+ * call seeds the search from evocore_gpu_recommend_batch_size.
+ *
+ * @param ctx          GPU context
+ * @param kernel       Domain kernel the batches will use (NULL = built-in)
+ * @param genome_size  Size of each genome in bytes
+ * @return Batch size to use for the next batch (>= 1)
+ */
+size_t evocore_gpu_autotune_batch_size(evocore_gpu_context_t *ctx,
+                                     evocore_gpu_kernel_launch_t kernel,
+                                     size_t genome_size);
+
+/**
+ * Check whether the autotuner has converged for a device/kernel pair
+ *
+ * @param ctx          GPU context
+ * @param kernel       Domain kernel (NULL = built-in)
+ * @param genome_size  Size of each genome in bytes
+ * @return true once the hill-climbing step has shrunk below ~5%
+ */
+bool evocore_gpu_autotune_converged(const evocore_gpu_context_t *ctx,
+                                  evocore_gpu_kernel_launch_t kernel,
+                                  size_t genome_size);
+
+/**
+ * Persist tuned batch sizes to a file
+ *
+ * Writes one line per tuned entry keyed by device name and genome
+ * size. Kernel function pointers are not stable across runs, so
+ * entries for different kernels with the same device and genome size
+ * collapse to the best-throughput one on save.
+ *
+ * @param ctx   GPU context
+ * @param path  Output file path
+ * @return true on success
+ */
+bool evocore_gpu_autotune_save(const evocore_gpu_context_t *ctx,
+                             const char *path);
+
+/**
+ * Load previously tuned batch sizes
+ *
+ * Entries matching the current device name seed the search, so a
+ * fleet node starts from its own tuned value instead of the static
+ * estimate. Unmatched lines are ignored.
+ *
+ * @param ctx   GPU context
+ * @param path  File written by evocore_gpu_autotune_save
+ * @return true if the file was read (even if no entries matched)
+ */
+bool evocore_gpu_autotune_load(evocore_gpu_context_t *ctx,
+                             const char *path);
+
 /**
  * Synchronize GPU operations
  *
@@ -340,4 +574,25 @@ void evocore_gpu_set_enabled(evocore_gpu_context_t *ctx, bool enabled);
  */
 bool evocore_gpu_get_enabled(const evocore_gpu_context_t *ctx);
 
+/**
+ * Enable/disable multi-GPU batch sharding
+ *
+ * When enabled and more than one device is available,
+ * evocore_gpu_evaluate_batch splits each batch across all devices
+ * proportionally to their measured throughput, with one worker thread
+ * and stream per device. Has no effect with a single device.
+ *
+ * @param ctx       GPU context
+ * @param enabled   true to shard batches across devices
+ */
+void evocore_gpu_set_sharding(evocore_gpu_context_t *ctx, bool enabled);
+
+/**
+ * Check if multi-GPU batch sharding is enabled
+ *
+ * @param ctx       GPU context
+ * @return true if enabled, false otherwise
+ */
+bool evocore_gpu_get_sharding(const evocore_gpu_context_t *ctx);
+
 #endif /* EVOCORE_GPU_H */
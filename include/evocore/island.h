@@ -0,0 +1,131 @@
+#ifndef EVOCORE_ISLAND_H
+#define EVOCORE_ISLAND_H
+
+#include <stddef.h>
+#include <stdbool.h>
+#include "evocore/population.h"
+#include "evocore/error.h"
+
+/*========================================================================
+ * Island-Model Evolution
+ * ======================================================================
+ *
+ * Runs N independent populations ("islands") that exchange their best
+ * individuals through lock-free migration rings, so many cores can be
+ * used past the point where one population's parallel evaluation
+ * saturates.
+ *
+ * Threading model: each island is driven by exactly one caller-owned
+ * thread, which evolves the island's population however it likes and
+ * calls evocore_island_step once per generation. Migration uses one
+ * single-producer/single-consumer ring per island (written only by its
+ * upstream neighbor in the ring topology, read only by the island
+ * itself), so no locks are taken on the generation path.
+ */
+
+/**
+ * Island model configuration
+ */
+typedef struct {
+    size_t num_islands;          /* Number of islands (>= 1) */
+    size_t island_capacity;      /* Population capacity per island */
+    size_t migration_interval;   /* Emigrate every K generations */
+    size_t migration_count;      /* Individuals sent per migration */
+    size_t ring_capacity;        /* Migrant slots per inbox (rounded to power of two) */
+} evocore_island_config_t;
+
+/**
+ * Default island model configuration
+ */
+#define EVOCORE_ISLAND_DEFAULTS { .num_islands = 4, \
+                                 .island_capacity = 100, \
+                                 .migration_interval = 10, \
+                                 .migration_count = 2, \
+                                 .ring_capacity = 16 }
+
+/**
+ * Opaque island model handle
+ */
+typedef struct evocore_island_model_t evocore_island_model_t;
+
+/**
+ * Create an island model
+ *
+ * Initializes num_islands populations and the migration rings between
+ * them (ring topology: island i emigrates to island (i+1) mod N).
+ *
+ * @param config        Configuration (NULL for defaults)
+ * @return Model instance, or NULL on failure
+ */
+evocore_island_model_t* evocore_island_model_create(
+    const evocore_island_config_t *config);
+
+/**
+ * Destroy an island model
+ *
+ * Frees all island populations and any migrants still in flight.
+ * All island threads must have stopped first.
+ *
+ * @param model         Model to destroy (can be NULL)
+ */
+void evocore_island_model_destroy(evocore_island_model_t *model);
+
+/**
+ * Get an island's population
+ *
+ * The caller evolves this population directly from the island's
+ * thread.
+ *
+ * @param model         Island model
+ * @param island        Island index
+ * @return Population pointer, or NULL if invalid index
+ */
+evocore_population_t* evocore_island_population(evocore_island_model_t *model,
+                                             size_t island);
+
+/**
+ * Advance an island by one generation of migration bookkeeping
+ *
+ * Call once per generation from the island's thread, after evolving
+ * the population. Drains the island's inbox (immigrants replace the
+ * current worst individuals when they are fitter) and, every
+ * migration_interval generations, clones the island's top
+ * migration_count individuals into the downstream neighbor's inbox.
+ * Migrants are dropped when the neighbor's ring is full.
+ *
+ * @param model         Island model
+ * @param island        Island index
+ * @return EVOCORE_OK on success, error code otherwise
+ */
+evocore_error_t evocore_island_step(evocore_island_model_t *model,
+                                size_t island);
+
+/**
+ * Pin the calling thread to a core for an island
+ *
+ * Assigns cores round-robin by island index. Call from the island's
+ * thread before evolving.
+ *
+ * @param model         Island model
+ * @param island        Island index
+ * @return EVOCORE_OK on success, error code otherwise
+ */
+evocore_error_t evocore_island_pin_thread(evocore_island_model_t *model,
+                                      size_t island);
+
+/**
+ * Find the best individual across all islands
+ *
+ * Reads each island's cached best fitness; intended for monitoring
+ * from a coordinator thread, so values may lag the islands slightly.
+ *
+ * @param model         Island model
+ * @param out_fitness   Output: best fitness (can be NULL)
+ * @param out_island    Output: island holding it (can be NULL)
+ * @return EVOCORE_OK on success, error code otherwise
+ */
+evocore_error_t evocore_island_model_best(const evocore_island_model_t *model,
+                                      double *out_fitness,
+                                      size_t *out_island);
+
+#endif /* EVOCORE_ISLAND_H */
@@ -3,6 +3,7 @@
 
 #include <stddef.h>
 #include <stdbool.h>
+#include <stdint.h>
 
 /**
  * Log levels
@@ -46,6 +47,30 @@ void evocore_log_set_color(bool enabled);
  */
 evocore_log_level_t evocore_log_get_level(void);
 
+/**
+ * Enable/disable the asynchronous logging backend
+ *
+ * When enabled, evocore_log_message formats into a thread-local
+ * buffer and publishes to a lock-free ring; a dedicated thread
+ * flushes to stderr and the log file. Producers never block on I/O,
+ * so logging can stay on in the evaluation hot path. Under overload
+ * the oldest unread messages are discarded (drop-oldest) and counted
+ * by evocore_log_dropped. FATAL messages always bypass the ring and
+ * flush synchronously since the process exits immediately after.
+ *
+ * Disabling joins the flush thread after draining the ring.
+ * Requires EVOCORE_HAVE_PTHREADS; returns false otherwise.
+ *
+ * @param enabled   true to start the async backend, false to stop it
+ * @return true on success, false otherwise
+ */
+bool evocore_log_set_async(bool enabled);
+
+/**
+ * Number of messages discarded by the async backend under overload
+ */
+uint64_t evocore_log_dropped(void);
+
 /**
  * Close log file (if open)
  */
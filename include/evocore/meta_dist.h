@@ -0,0 +1,181 @@
+/**
+ * Evocore Distributed Meta-Evolution
+ *
+ * Shards meta-individual trials across worker nodes over TCP. Each
+ * trial is a whole evolution run scored with the candidate
+ * meta-parameters, so trials are embarrassingly parallel and the
+ * coordinator/worker split is a simple task queue:
+ *
+ *   - The coordinator owns the evocore_meta_population_t, hands out
+ *     (individual, trial) tasks to connected workers, and applies
+ *     results through evocore_meta_individual_record_fitness as they
+ *     stream in.
+ *   - Workers connect, receive meta-parameters, run the caller's
+ *     trial function, and report the fitness back.
+ *
+ * The wire format sends evocore_meta_params_t as raw bytes with a
+ * size check in the handshake, so coordinator and workers must be
+ * built for the same architecture — the same assumption the binary
+ * checkpoint format already makes.
+ */
+
+#ifndef EVOCORE_META_DIST_H
+#define EVOCORE_META_DIST_H
+
+#include "evocore/meta.h"
+#include "evocore/error.h"
+#include <stdint.h>
+
+/*========================================================================
+ * Coordinator
+ *========================================================================*/
+
+/**
+ * Opaque coordinator handle
+ */
+typedef struct evocore_meta_coordinator evocore_meta_coordinator_t;
+
+/**
+ * Coordinator progress counters
+ */
+typedef struct {
+    size_t workers_connected;   /* Currently connected workers */
+    size_t tasks_dispatched;    /* Tasks handed to workers */
+    size_t results_applied;     /* Fitness results recorded */
+    size_t tasks_requeued;      /* Tasks reissued after a worker dropped */
+} evocore_meta_coordinator_stats_t;
+
+/**
+ * Create a coordinator listening on the given TCP port
+ *
+ * The meta-population is borrowed, not copied: results are recorded
+ * directly into its individuals, and the caller keeps driving
+ * evocore_meta_population_evolve between generations.
+ *
+ * @param meta_pop      Meta-population to score (must stay valid)
+ * @param port          TCP port to listen on (0 for any free port)
+ * @return Coordinator handle, or NULL on error
+ */
+evocore_meta_coordinator_t* evocore_meta_coordinator_create(
+    evocore_meta_population_t *meta_pop,
+    uint16_t port);
+
+/**
+ * Get the port the coordinator is listening on
+ *
+ * Useful when created with port 0.
+ *
+ * @param coord     Coordinator
+ * @return Bound port, or 0 on error
+ */
+uint16_t evocore_meta_coordinator_port(const evocore_meta_coordinator_t *coord);
+
+/**
+ * Queue trials for every individual in the current generation
+ *
+ * Each individual is scheduled for trials_per_individual independent
+ * trials. Call once per generation, then drive the I/O with
+ * evocore_meta_coordinator_poll until it reports completion.
+ *
+ * @param coord                 Coordinator
+ * @param trials_per_individual Trials to run per meta-individual (>= 1)
+ * @return EVOCORE_OK on success, error code otherwise
+ */
+evocore_error_t evocore_meta_coordinator_dispatch(
+    evocore_meta_coordinator_t *coord,
+    int trials_per_individual);
+
+/**
+ * Process coordinator I/O, applying any results that arrived
+ *
+ * Accepts new workers, assigns queued tasks, and records streamed
+ * fitness results via evocore_meta_individual_record_fitness. Tasks
+ * held by a worker that disconnects are requeued. Returns after one
+ * poll round, so callers can interleave other work (including an
+ * early evocore_meta_population_evolve on partial results).
+ *
+ * @param coord         Coordinator
+ * @param timeout_ms    Max time to block waiting for activity
+ * @param out_pending   Out: tasks still queued or in flight (can be NULL)
+ * @return EVOCORE_OK on success, error code otherwise
+ */
+evocore_error_t evocore_meta_coordinator_poll(
+    evocore_meta_coordinator_t *coord,
+    int timeout_ms,
+    size_t *out_pending);
+
+/**
+ * Run the current dispatch to completion
+ *
+ * Convenience loop around evocore_meta_coordinator_poll; returns when
+ * every queued trial has reported or the deadline passes.
+ *
+ * @param coord         Coordinator
+ * @param timeout_ms    Overall deadline (< 0 to wait indefinitely)
+ * @return EVOCORE_OK when all trials completed, EVOCORE_ERR_TIMEOUT
+ *         if the deadline passed with tasks outstanding
+ */
+evocore_error_t evocore_meta_coordinator_wait(
+    evocore_meta_coordinator_t *coord,
+    int timeout_ms);
+
+/**
+ * Get coordinator progress counters
+ *
+ * @param coord     Coordinator
+ * @param stats     Output statistics
+ * @return EVOCORE_OK on success, error code otherwise
+ */
+evocore_error_t evocore_meta_coordinator_get_stats(
+    const evocore_meta_coordinator_t *coord,
+    evocore_meta_coordinator_stats_t *stats);
+
+/**
+ * Shut down the coordinator
+ *
+ * Sends shutdown to connected workers and closes all sockets. The
+ * meta-population is left untouched.
+ *
+ * @param coord     Coordinator to free
+ */
+void evocore_meta_coordinator_free(evocore_meta_coordinator_t *coord);
+
+/*========================================================================
+ * Worker
+ *========================================================================*/
+
+/**
+ * Trial function run by workers
+ *
+ * Runs one full evolution with the candidate meta-parameters and
+ * returns the score (typically best fitness achieved, normalized
+ * however the search defines quality).
+ *
+ * @param params    Candidate meta-parameters
+ * @param context   User-provided context
+ * @return Trial fitness
+ */
+typedef double (*evocore_meta_trial_func_t)(
+    const evocore_meta_params_t *params,
+    void *context);
+
+/**
+ * Run a worker loop against a coordinator
+ *
+ * Connects, then serves tasks until the coordinator sends shutdown or
+ * the connection drops. Blocking; run one per node (trials can use
+ * all local cores internally).
+ *
+ * @param host      Coordinator hostname or IPv4 address
+ * @param port      Coordinator port
+ * @param trial     Trial function
+ * @param context   Context passed to the trial function
+ * @return EVOCORE_OK on clean shutdown, error code otherwise
+ */
+evocore_error_t evocore_meta_worker_run(
+    const char *host,
+    uint16_t port,
+    evocore_meta_trial_func_t trial,
+    void *context);
+
+#endif /* EVOCORE_META_DIST_H */
@@ -0,0 +1,164 @@
+#ifndef EVOCORE_METRICS_H
+#define EVOCORE_METRICS_H
+
+#include "evocore/error.h"
+#include "evocore/stats.h"
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+/*========================================================================
+ * Asynchronous Metrics Export
+ * ========================================================================
+ *
+ * Decouples metrics reporting from the evolution loop. Hot paths push
+ * fixed-size samples into a lock-free single-producer/single-consumer
+ * ring; a background exporter thread drains the ring and writes
+ * CSV, JSON lines, or StatsD datagrams, so enabling monitoring costs
+ * the generation loop one ring push instead of synchronous file I/O.
+ *
+ * The producer side is wait-free and never blocks: when the ring is
+ * full the sample is dropped and counted, which is the right trade-off
+ * for telemetry. Pushes must come from a single thread (the evolution
+ * loop); the exporter thread is the single consumer.
+ */
+
+/**
+ * Maximum metric name length (including terminator)
+ */
+#define EVOCORE_METRIC_NAME_MAX 48
+
+/**
+ * One metric sample
+ *
+ * Fixed size so ring slots are copied by value with no allocation on
+ * the hot path.
+ */
+typedef struct {
+    uint64_t timestamp_ms;                /* Wall clock, ms since epoch */
+    uint64_t generation;                  /* Generation when recorded */
+    double value;                         /* Sample value */
+    char name[EVOCORE_METRIC_NAME_MAX];   /* Metric name */
+} evocore_metric_sample_t;
+
+/**
+ * Export format
+ */
+typedef enum {
+    EVOCORE_METRICS_CSV = 0,     /* timestamp_ms,generation,name,value */
+    EVOCORE_METRICS_JSON,        /* One JSON object per line */
+    EVOCORE_METRICS_STATSD       /* StatsD gauge datagrams over UDP */
+} evocore_metrics_format_t;
+
+/**
+ * Metrics pipeline configuration
+ */
+typedef struct {
+    size_t ring_capacity;        /* Ring slots (rounded up to power of 2) */
+    evocore_metrics_format_t format;
+    const char *path;            /* Output file for CSV/JSON */
+    const char *statsd_host;     /* StatsD host (dotted quad or name) */
+    int statsd_port;             /* StatsD UDP port */
+    const char *prefix;          /* Metric name prefix (NULL = "evocore") */
+    unsigned flush_interval_ms;  /* Exporter wake period */
+} evocore_metrics_config_t;
+
+/**
+ * Default metrics configuration
+ */
+#define EVOCORE_METRICS_DEFAULTS { \
+    .ring_capacity = 4096, \
+    .format = EVOCORE_METRICS_CSV, \
+    .path = "evocore_metrics.csv", \
+    .statsd_host = "127.0.0.1", \
+    .statsd_port = 8125, \
+    .prefix = NULL, \
+    .flush_interval_ms = 100 \
+}
+
+/**
+ * Opaque metrics pipeline handle
+ */
+typedef struct evocore_metrics_t evocore_metrics_t;
+
+/*========================================================================
+ * Pipeline Management
+ *========================================================================*/
+
+/**
+ * Create a metrics pipeline and start its exporter thread
+ *
+ * Opens the output file (or UDP socket for StatsD) and spawns the
+ * background exporter.
+ *
+ * @param config    Configuration (NULL for defaults)
+ * @return Pipeline handle, or NULL on failure
+ */
+evocore_metrics_t* evocore_metrics_create(const evocore_metrics_config_t *config);
+
+/**
+ * Stop the exporter, drain remaining samples, and free the pipeline
+ *
+ * @param metrics   Pipeline to destroy (NULL is a no-op)
+ */
+void evocore_metrics_destroy(evocore_metrics_t *metrics);
+
+/*========================================================================
+ * Producer API (hot path)
+ *========================================================================*/
+
+/**
+ * Push one sample into the ring
+ *
+ * Wait-free: one atomic load and one atomic store. When the ring is
+ * full the sample is dropped and the drop counter incremented.
+ *
+ * @param metrics     Pipeline handle
+ * @param name        Metric name (truncated to EVOCORE_METRIC_NAME_MAX-1)
+ * @param value       Sample value
+ * @param generation  Current generation
+ * @return true if enqueued, false if dropped or invalid args
+ */
+bool evocore_metrics_push(evocore_metrics_t *metrics,
+                          const char *name,
+                          double value,
+                          uint64_t generation);
+
+/**
+ * Progress callback that feeds stats into the pipeline
+ *
+ * Install as the evocore_progress_reporter_t callback with the
+ * pipeline handle as user_data; each report pushes best/avg/worst
+ * fitness, variance, and generation timing as individual samples.
+ *
+ * @param stats       Current statistics
+ * @param user_data   evocore_metrics_t* pipeline handle
+ */
+void evocore_metrics_progress_callback(const evocore_stats_t *stats,
+                                       void *user_data);
+
+/*========================================================================
+ * Introspection
+ *========================================================================*/
+
+/**
+ * Block until every sample pushed so far has been exported
+ *
+ * @param metrics   Pipeline handle
+ */
+void evocore_metrics_flush(evocore_metrics_t *metrics);
+
+/**
+ * Get pipeline counters
+ *
+ * @param metrics      Pipeline handle
+ * @param out_pushed   Output: samples accepted into the ring (can be NULL)
+ * @param out_dropped  Output: samples dropped on a full ring (can be NULL)
+ * @param out_exported Output: samples written by the exporter (can be NULL)
+ */
+void evocore_metrics_get_stats(const evocore_metrics_t *metrics,
+                               uint64_t *out_pushed,
+                               uint64_t *out_dropped,
+                               uint64_t *out_exported);
+
+#endif /* EVOCORE_METRICS_H */
@@ -23,6 +23,7 @@
 #include "evocore/error.h"
 #include <stdbool.h>
 #include <stddef.h>
+#include <stdint.h>
 #include <time.h>
 
 /*========================================================================
@@ -62,6 +63,16 @@ evocore_failure_severity_t evocore_classify_failure(
  * Data Structures
  *========================================================================*/
 
+/**
+ * Number of buckets in the per-record byte histogram sketch.
+ *
+ * Each bucket counts genome bytes by high nibble. Half the L1 distance
+ * between two sketches is a lower bound on the Hamming distance between
+ * the genomes, so most dissimilar records can be rejected from one
+ * cache line without touching their genome bytes.
+ */
+#define EVOCORE_NEGATIVE_SKETCH_BUCKETS 16
+
 /**
  * Failure record
  *
@@ -77,6 +88,7 @@ typedef struct {
     time_t first_seen;                   /* First occurrence timestamp */
     time_t last_seen;                    /* Most recent occurrence */
     bool is_active;                      /* Currently being penalized */
+    uint32_t sketch[EVOCORE_NEGATIVE_SKETCH_BUCKETS]; /* Byte histogram of genome */
 } evocore_failure_record_t;
 
 /**
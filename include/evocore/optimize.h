@@ -11,6 +11,7 @@
 #include "evocore/genome.h"
 #include "evocore/population.h"
 #include "evocore/fitness.h"
+#include "evocore/negative.h"
 #include "evocore/error.h"
 #include <stddef.h>
 #include <stdbool.h>
@@ -36,6 +37,21 @@ typedef struct evocore_mempool_t evocore_mempool_t;
  */
 evocore_mempool_t* evocore_mempool_create(size_t genome_size, size_t block_size);
 
+/**
+ * Create a size-class memory pool for variable-length genomes
+ *
+ * Builds power-of-two size classes (32, 64, 128, ...) up to the first
+ * class covering max_genome_size, each with its own freelist, so a
+ * single pool can serve genomes of mixed sizes without internal
+ * fragmentation beyond the class rounding.
+ *
+ * @param max_genome_size Largest genome the pool must serve, in bytes
+ * @param block_size      Number of chunks per block, per class
+ * @return New memory pool, or NULL on failure
+ */
+evocore_mempool_t* evocore_mempool_create_sized(size_t max_genome_size,
+                                                size_t block_size);
+
 /**
  * Destroy a memory pool
  *
@@ -55,6 +71,23 @@ void evocore_mempool_destroy(evocore_mempool_t *pool);
 evocore_error_t evocore_mempool_alloc(evocore_mempool_t *pool,
                                   evocore_genome_t *genome);
 
+/**
+ * Allocate a genome of a given size from a size-class pool
+ *
+ * Serves the request from the smallest class that fits; the genome's
+ * capacity is set to the class chunk size. Works on fixed-size pools
+ * too, where any size up to the genome size maps to the single class.
+ *
+ * @param pool    Memory pool
+ * @param genome  Genome to initialize (must have data=NULL)
+ * @param size    Requested capacity in bytes
+ * @return EVOCORE_OK, or EVOCORE_ERR_OUT_OF_MEMORY if size exceeds
+ *         the largest class
+ */
+evocore_error_t evocore_mempool_alloc_sized(evocore_mempool_t *pool,
+                                            evocore_genome_t *genome,
+                                            size_t size);
+
 /**
  * Free a genome back to the pool
  *
@@ -79,6 +112,36 @@ void evocore_mempool_get_stats(const evocore_mempool_t *pool,
                               size_t *total_blocks,
                               size_t *free_blocks);
 
+/**
+ * Get the number of size classes in a pool
+ *
+ * @param pool    Memory pool
+ * @return Class count (1 for fixed-size pools), 0 if pool is NULL
+ */
+size_t evocore_mempool_get_class_count(const evocore_mempool_t *pool);
+
+/**
+ * Get per-class statistics for utilization monitoring
+ *
+ * Any output pointer may be NULL.
+ *
+ * @param pool                Memory pool
+ * @param class_index         Class to query (0 .. class_count-1)
+ * @param chunk_size          Output: chunk size of this class in bytes
+ * @param total_allocations   Output: total allocations from this class
+ * @param current_allocations Output: currently allocated from this class
+ * @param num_blocks          Output: blocks backing this class
+ * @param free_chunks         Output: free chunks (shared freelist + uncarved)
+ * @return EVOCORE_OK, or EVOCORE_ERR_INVALID_ARG for a bad index
+ */
+evocore_error_t evocore_mempool_get_class_stats(const evocore_mempool_t *pool,
+                                                size_t class_index,
+                                                size_t *chunk_size,
+                                                size_t *total_allocations,
+                                                size_t *current_allocations,
+                                                size_t *num_blocks,
+                                                size_t *free_chunks);
+
 /*========================================================================
  * Parallel Fitness Evaluation
  *======================================================================== */
@@ -121,6 +184,24 @@ evocore_error_t evocore_parallel_evaluate_population(evocore_parallel_ctx_t *ctx
                                                 evocore_fitness_func_t fitness_func,
                                                 void *user_context);
 
+/**
+ * Evaluate a packed population in parallel
+ *
+ * Streams linearly through the contiguous genome slab; each thread
+ * evaluates a contiguous range of slots so genome bytes and fitness
+ * writes stay cache-friendly.
+ *
+ * @param ctx            Parallel context
+ * @param pop            Packed population to evaluate
+ * @param fitness_func   Fitness function
+ * @param user_context   User context for fitness function
+ * @return EVOCORE_OK on success, error code otherwise
+ */
+evocore_error_t evocore_parallel_evaluate_packed(evocore_parallel_ctx_t *ctx,
+                                             evocore_packed_population_t *pop,
+                                             evocore_fitness_func_t fitness_func,
+                                             void *user_context);
+
 /**
  * Evaluate batch of genomes in parallel
  *
@@ -147,6 +228,210 @@ evocore_error_t evocore_parallel_evaluate_batch(evocore_parallel_ctx_t *ctx,
  */
 int evocore_parallel_get_num_threads(const evocore_parallel_ctx_t *ctx);
 
+/**
+ * Get the number of NUMA nodes the context is aware of
+ *
+ * Topology is read from sysfs when the worker pool starts; pool slots
+ * are grouped into contiguous runs per node, helper threads are pinned
+ * to their node's CPUs, and work stealing prefers same-node victims so
+ * items only migrate across sockets as a last resort.
+ *
+ * @param ctx    Parallel context
+ * @return Detected node count (1 when flat or topology is unknown)
+ */
+int evocore_parallel_get_numa_nodes(const evocore_parallel_ctx_t *ctx);
+
+/**
+ * First-touch a slab of per-item storage from the worker pool
+ *
+ * Touches one page-granular stripe per item from the same pool slot
+ * that the evaluate paths hand that item to, so with pinned workers
+ * the kernel's first-touch policy places each partition's pages on the
+ * socket that keeps evaluating it. Call once right after allocating a
+ * packed population slab (or any array indexed like one), before the
+ * first evaluation writes to it.
+ *
+ * @param ctx          Parallel context
+ * @param data         Base of the slab
+ * @param item_size    Bytes per item
+ * @param count        Number of items
+ * @return EVOCORE_OK on success, error code otherwise
+ */
+evocore_error_t evocore_parallel_first_touch(evocore_parallel_ctx_t *ctx,
+                                             void *data,
+                                             size_t item_size,
+                                             size_t count);
+
+/*========================================================================
+ * Multi-Process Evaluation
+ *======================================================================== */
+
+/**
+ * Process pool for crash-isolated fitness evaluation
+ *
+ * Forked worker processes evaluate contiguous population ranges against
+ * a shared-memory genome slab and write fitness into a shared results
+ * array — isolation from crashing or leaking fitness functions without
+ * serialization overhead. A worker killed by a bad evaluation forfeits
+ * only the genome it was running (marked failed, fitness NaN) and is
+ * respawned to finish the rest of its range.
+ */
+typedef struct evocore_process_pool_t evocore_process_pool_t;
+
+/**
+ * Create a process evaluation pool
+ *
+ * Sizes the shared mapping up front, so max_genomes and max_genome_size
+ * bound every later evaluate call.
+ *
+ * @param num_workers     Worker processes (0 = one per online CPU)
+ * @param max_genomes     Largest population the pool must evaluate
+ * @param max_genome_size Largest genome in bytes
+ * @return New pool, or NULL on failure
+ */
+evocore_process_pool_t* evocore_process_pool_create(int num_workers,
+                                                    size_t max_genomes,
+                                                    size_t max_genome_size);
+
+/**
+ * Destroy a process pool
+ *
+ * @param pool    Pool to destroy
+ */
+void evocore_process_pool_destroy(evocore_process_pool_t *pool);
+
+/**
+ * Evaluate a population in isolated worker processes
+ *
+ * Genomes are copied into the shared slab, workers are forked per
+ * contiguous range, and fitness is collected from shared memory.
+ * Workers inherit fitness_func and user_context via fork, so the
+ * context must not rely on mutations being visible to the optimizer.
+ * Genomes whose evaluation crashed get fitness NaN and, when neg is
+ * non-NULL, a FATAL failure record via negative learning.
+ *
+ * @param pool           Process pool
+ * @param pop            Population to evaluate
+ * @param fitness_func   Fitness function (runs in the workers)
+ * @param user_context   User context for fitness function
+ * @param neg            Negative learning state for crashed genomes, or NULL
+ * @return EVOCORE_OK on success, error code otherwise
+ */
+evocore_error_t evocore_process_pool_evaluate(evocore_process_pool_t *pool,
+                                              evocore_population_t *pop,
+                                              evocore_fitness_func_t fitness_func,
+                                              void *user_context,
+                                              evocore_negative_learning_t *neg);
+
+/**
+ * Get process pool statistics
+ *
+ * @param pool          Process pool
+ * @param crash_count   Output: workers lost to signals or bad exits
+ * @param failed_count  Output: genomes marked failed across evaluations
+ */
+void evocore_process_pool_get_stats(const evocore_process_pool_t *pool,
+                                    size_t *crash_count,
+                                    size_t *failed_count);
+
+/*========================================================================
+ * Fitness Memoization Cache
+ *======================================================================== */
+
+/**
+ * Fitness cache keyed by genome content
+ *
+ * Tournament selection plus elitism re-submits identical genomes for
+ * evaluation constantly; the cache hashes genome bytes and returns the
+ * stored fitness instead of re-evaluating. Bounded size with
+ * generation-based eviction. Only valid for deterministic fitness
+ * functions.
+ */
+typedef struct evocore_fitness_cache_t evocore_fitness_cache_t;
+
+/**
+ * Create a fitness cache
+ *
+ * @param capacity    Maximum entries (rounded up to a power of two)
+ * @param max_age     Generations an unused entry survives before it
+ *                    becomes evictable (0 for default)
+ * @return New cache, or NULL on failure
+ */
+evocore_fitness_cache_t* evocore_fitness_cache_create(size_t capacity,
+                                                   size_t max_age);
+
+/**
+ * Destroy a fitness cache
+ *
+ * @param cache    Cache to destroy
+ */
+void evocore_fitness_cache_destroy(evocore_fitness_cache_t *cache);
+
+/**
+ * Look up a genome's cached fitness
+ *
+ * Thread-safe. A hit refreshes the entry's age.
+ *
+ * @param cache        Cache to query
+ * @param genome       Genome to look up
+ * @param out_fitness  Output: cached fitness on hit
+ * @return true on hit, false on miss
+ */
+bool evocore_fitness_cache_lookup(evocore_fitness_cache_t *cache,
+                                 const evocore_genome_t *genome,
+                                 double *out_fitness);
+
+/**
+ * Insert an evaluated genome into the cache
+ *
+ * Thread-safe. When the probe window is full of fresh entries, the
+ * oldest one is evicted.
+ *
+ * @param cache      Cache to update
+ * @param genome     Genome that was evaluated
+ * @param fitness    Its fitness value
+ */
+void evocore_fitness_cache_insert(evocore_fitness_cache_t *cache,
+                                 const evocore_genome_t *genome,
+                                 double fitness);
+
+/**
+ * Advance the cache's generation counter
+ *
+ * Call once per evolutionary generation so age-based eviction tracks
+ * the run.
+ *
+ * @param cache    Cache to advance
+ */
+void evocore_fitness_cache_advance_generation(evocore_fitness_cache_t *cache);
+
+/**
+ * Get cache hit statistics
+ *
+ * @param cache       Cache to query
+ * @param out_hits    Output: lookup hits (can be NULL)
+ * @param out_misses  Output: lookup misses (can be NULL)
+ * @param out_entries Output: live entries (can be NULL)
+ */
+void evocore_fitness_cache_get_stats(const evocore_fitness_cache_t *cache,
+                                    long long *out_hits,
+                                    long long *out_misses,
+                                    size_t *out_entries);
+
+/**
+ * Attach a fitness cache to a parallel context
+ *
+ * The parallel evaluate paths consult the cache automatically before
+ * calling the fitness function and insert results after. Pass NULL to
+ * detach. The context does not take ownership.
+ *
+ * @param ctx      Parallel context
+ * @param cache    Cache to consult (or NULL)
+ * @return EVOCORE_OK on success, error code otherwise
+ */
+evocore_error_t evocore_parallel_set_fitness_cache(evocore_parallel_ctx_t *ctx,
+                                               evocore_fitness_cache_t *cache);
+
 /*========================================================================
  * SIMD Genome Operations
  *======================================================================== */
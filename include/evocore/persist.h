@@ -37,7 +37,9 @@ typedef struct {
     evocore_serial_format_t format;
     bool include_metadata;     /* Include generation, timestamps, etc. */
     bool pretty_print;          /* For JSON: pretty print output */
-    int compression_level;      /* 0-9, 0 = none, 9 = max (future) */
+    int compression_level;      /* 0 = none, >0 = block compression
+                                 * (see evocore/compress.h); readers
+                                 * detect compressed files by magic */
 } evocore_serial_options_t;
 
 /**
@@ -313,6 +315,130 @@ evocore_error_t evocore_checkpoint_restore(const evocore_checkpoint_t *checkpoin
  */
 void evocore_checkpoint_free(evocore_checkpoint_t *checkpoint);
 
+/*========================================================================
+ * Memory-Mapped Binary Checkpoints
+ *========================================================================*/
+
+/**
+ * Handle for a memory-mapped population checkpoint
+ *
+ * The file layout is a fixed header (with the evocore magic), an offset
+ * table, and genome bytes stored at their natural alignment, so restore
+ * can map the file and rebuild a population with zero copies of genome
+ * data. The mapping must stay open for as long as any population
+ * restored from it is alive.
+ */
+typedef struct {
+    void *map;                     /* Base of the mapping */
+    size_t map_size;               /* Length of the mapping */
+    size_t population_size;        /* Number of individuals in the file */
+    size_t generation;             /* Generation number at save time */
+} evocore_mmap_checkpoint_t;
+
+/**
+ * Save population in mmap-friendly binary format
+ *
+ * Writes a fixed header, a per-individual offset table, and genome
+ * bytes at cache-line alignment.
+ *
+ * @param pop           Population to save
+ * @param filepath      Output file path
+ * @return EVOCORE_OK on success, error code otherwise
+ */
+evocore_error_t evocore_population_save_mmap(const evocore_population_t *pop,
+                                         const char *filepath);
+
+/**
+ * Open a memory-mapped checkpoint
+ *
+ * Maps the file read-only and validates header and offset table.
+ *
+ * @param filepath      Checkpoint file path
+ * @param ck            Handle to initialize
+ * @return EVOCORE_OK on success, error code otherwise
+ */
+evocore_error_t evocore_mmap_checkpoint_open(const char *filepath,
+                                         evocore_mmap_checkpoint_t *ck);
+
+/**
+ * Rebuild a population from a mapped checkpoint without copying
+ *
+ * Individuals receive genome views pointing directly into the mapping
+ * (owns_memory = false). The handle must outlive the population.
+ *
+ * @param ck            Open checkpoint handle
+ * @param pop           Population to initialize and fill
+ * @return EVOCORE_OK on success, error code otherwise
+ */
+evocore_error_t evocore_mmap_checkpoint_restore(const evocore_mmap_checkpoint_t *ck,
+                                            evocore_population_t *pop);
+
+/**
+ * Close a memory-mapped checkpoint
+ *
+ * Unmaps the file. Populations restored from the handle become invalid.
+ *
+ * @param ck            Handle to close
+ */
+void evocore_mmap_checkpoint_close(evocore_mmap_checkpoint_t *ck);
+
+/*========================================================================
+ * Delta Checkpoints
+ *========================================================================*/
+
+/**
+ * Save only the individuals that changed since a base checkpoint
+ *
+ * Compares each genome's hash (evocore_genome_hash) against the hashes
+ * captured when the base was written and stores just the changed
+ * individuals, so per-generation checkpoints stay small when most of
+ * the population is stable. Individuals at indices beyond base_count
+ * are always treated as changed.
+ *
+ * @param pop           Population to save
+ * @param base_hashes   Genome hashes at base-checkpoint time
+ * @param base_count    Number of entries in base_hashes
+ * @param filepath      Output file path
+ * @return EVOCORE_OK on success, error code otherwise
+ */
+evocore_error_t evocore_population_save_delta(const evocore_population_t *pop,
+                                          const uint64_t *base_hashes,
+                                          size_t base_count,
+                                          const char *filepath);
+
+/**
+ * Apply a delta file to a population in place
+ *
+ * Replaces genome bytes and fitness of each individual recorded in the
+ * delta and advances the population's generation to the delta's. The
+ * population must have been restored from the delta's base (or an
+ * earlier delta in the same chain).
+ *
+ * @param pop           Population to patch
+ * @param filepath      Delta file path
+ * @return EVOCORE_OK on success, error code otherwise
+ */
+evocore_error_t evocore_population_apply_delta(evocore_population_t *pop,
+                                           const char *filepath);
+
+/**
+ * Restore a population from a base checkpoint plus a chain of deltas
+ *
+ * Opens the mmap base, deep-copies it into an owning population, then
+ * replays the delta files in the given order. Pass delta_count = 0 to
+ * load just the base.
+ *
+ * @param base_path     Base checkpoint (evocore_population_save_mmap format)
+ * @param delta_paths   Delta file paths, oldest first (NULL if none)
+ * @param delta_count   Number of delta files
+ * @param pop           Population to initialize and fill
+ * @return EVOCORE_OK on success, error code otherwise
+ */
+evocore_error_t evocore_population_load_chain(const char *base_path,
+                                          const char *const *delta_paths,
+                                          size_t delta_count,
+                                          evocore_population_t *pop);
+
 /*========================================================================
  * Checkpoint Management (Advanced)
  *========================================================================*/
@@ -325,7 +451,14 @@ typedef struct {
     int every_n_generations;     /* 0 = only on explicit request */
     char directory[256];         /* Directory for checkpoints */
     int max_checkpoints;          /* 0 = unlimited, >0 = keep N most recent */
-    bool compress;                /* Use compression (future) */
+    bool compress;                /* Block-compress checkpoint files */
+    bool async;                   /* Write checkpoints on a background thread */
+    int max_pending;              /* Async backpressure limit (0 = default) */
+    bool delta;                   /* Binary base + per-interval deltas of
+                                   * changed individuals (see
+                                   * evocore_population_save_delta) */
+    int full_every;               /* Full base every N checkpoints in delta
+                                   * mode (0 = default) */
 } evocore_auto_checkpoint_config_t;
 
 /**
@@ -335,7 +468,11 @@ typedef struct {
                                     .every_n_generations = 10, \
                                     .directory = "./checkpoints", \
                                     .max_checkpoints = 5, \
-                                    .compress = false }
+                                    .compress = false, \
+                                    .async = false, \
+                                    .max_pending = 0, \
+                                    .delta = false, \
+                                    .full_every = 0 }
 
 /**
  * Checkpoint manager
@@ -363,7 +500,11 @@ void evocore_checkpoint_manager_destroy(evocore_checkpoint_manager_t *manager);
 /**
  * Update checkpoint manager (call after each generation)
  *
- * Creates automatic checkpoints if configured.
+ * Creates automatic checkpoints if configured. In async mode the
+ * population is snapshotted into an in-memory checkpoint and handed to
+ * a background writer thread, so the caller does not block on file
+ * I/O; if more than max_pending snapshots are waiting, the call blocks
+ * until the writer catches up.
  *
  * @param manager       Checkpoint manager
  * @param pop           Current population
@@ -376,6 +517,26 @@ evocore_error_t evocore_checkpoint_manager_update(evocore_checkpoint_manager_t *
                                              const evocore_domain_t *domain,
                                              const evocore_meta_population_t *meta_pop);
 
+/**
+ * Get number of checkpoints waiting on the background writer
+ *
+ * Always 0 for synchronous managers.
+ *
+ * @param manager       Checkpoint manager
+ * @return Number of queued snapshots not yet written to disk
+ */
+int evocore_checkpoint_manager_pending(evocore_checkpoint_manager_t *manager);
+
+/**
+ * Block until all queued checkpoints have been written
+ *
+ * No-op for synchronous managers.
+ *
+ * @param manager       Checkpoint manager
+ * @return EVOCORE_OK on success, error code otherwise
+ */
+evocore_error_t evocore_checkpoint_manager_flush(evocore_checkpoint_manager_t *manager);
+
 /**
  * List available checkpoints
  *
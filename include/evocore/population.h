@@ -21,8 +21,35 @@ typedef struct {
     double avg_fitness;               /* Average fitness */
     double worst_fitness;             /* Worst fitness */
     size_t best_index;                /* Index of best individual */
+    double fitness_sum;               /* Running sum of valid fitness values */
+    size_t valid_count;               /* Number of non-NaN fitness values */
+    bool stats_dirty;                 /* Aggregates need a full recompute */
 } evocore_population_t;
 
+/**
+ * Cache line size assumed for packed population alignment
+ */
+#define EVOCORE_CACHE_LINE_SIZE 64
+
+/**
+ * Packed population structure (structure-of-arrays layout)
+ *
+ * Alternative to evocore_population_t for fixed-size genomes:
+ * all genome bytes live in one contiguous, cache-line-aligned slab
+ * with fitness values in a parallel array. Evaluation and selection
+ * stream linearly through memory instead of chasing per-individual
+ * heap pointers.
+ */
+typedef struct {
+    unsigned char *genome_data;       /* Contiguous genome slab (cache-line aligned) */
+    double *fitness;                  /* Fitness values, parallel to genome slots */
+    size_t genome_size;               /* Logical genome size in bytes */
+    size_t genome_stride;             /* Slot stride (genome_size rounded up to cache line) */
+    size_t size;                      /* Current population size */
+    size_t capacity;                  /* Maximum capacity */
+    size_t generation;                /* Current generation number */
+} evocore_packed_population_t;
+
 /*========================================================================
  * Population Lifecycle
  *========================================================================*/
@@ -55,6 +82,81 @@ void evocore_population_cleanup(evocore_population_t *pop);
  */
 void evocore_population_clear(evocore_population_t *pop);
 
+/*========================================================================
+ * Packed Population (Structure of Arrays)
+ *========================================================================*/
+
+/**
+ * Create a packed population
+ *
+ * Allocates one cache-line-aligned slab for all genome bytes plus a
+ * parallel fitness array. All slots are zeroed and fitness set to NaN.
+ *
+ * @param pop          Packed population to initialize
+ * @param capacity     Maximum number of individuals
+ * @param genome_size  Fixed genome size in bytes
+ * @return EVOCORE_OK on success, error code otherwise
+ */
+evocore_error_t evocore_packed_population_init(evocore_packed_population_t *pop,
+                                           size_t capacity,
+                                           size_t genome_size);
+
+/**
+ * Free packed population resources
+ *
+ * @param pop       Packed population to clean up
+ */
+void evocore_packed_population_cleanup(evocore_packed_population_t *pop);
+
+/**
+ * Get pointer to genome bytes at index
+ *
+ * @param pop       Packed population
+ * @param index     Slot index
+ * @return Pointer into the slab, or NULL if invalid index
+ */
+unsigned char* evocore_packed_population_genome(const evocore_packed_population_t *pop,
+                                              size_t index);
+
+/**
+ * Wrap slot at index in a non-owning genome view
+ *
+ * The view points into the slab and must not outlive the population.
+ *
+ * @param pop       Packed population
+ * @param index     Slot index
+ * @param view      Genome view to initialize (owns_memory = false)
+ * @return EVOCORE_OK on success, error code otherwise
+ */
+evocore_error_t evocore_packed_population_view(const evocore_packed_population_t *pop,
+                                           size_t index,
+                                           evocore_genome_t *view);
+
+/**
+ * Copy a pointer-based population into packed layout
+ *
+ * Genomes larger than the packed genome_size are rejected; smaller
+ * genomes are zero-padded to genome_size.
+ *
+ * @param dst       Packed population (already initialized)
+ * @param src       Source population
+ * @return EVOCORE_OK on success, error code otherwise
+ */
+evocore_error_t evocore_packed_population_pack(evocore_packed_population_t *dst,
+                                           const evocore_population_t *src);
+
+/**
+ * Copy a packed population back into pointer-based layout
+ *
+ * Existing individuals in dst are cleared first.
+ *
+ * @param src       Packed population
+ * @param dst       Destination population (already initialized)
+ * @return EVOCORE_OK on success, error code otherwise
+ */
+evocore_error_t evocore_packed_population_unpack(const evocore_packed_population_t *src,
+                                             evocore_population_t *dst);
+
 /*========================================================================
  * Population Manipulation
  *========================================================================*/
@@ -73,6 +175,97 @@ evocore_error_t evocore_population_add(evocore_population_t *pop,
                                     const evocore_genome_t *genome,
                                     double fitness);
 
+/**
+ * Add an individual by moving its genome into the population
+ *
+ * Zero-copy variant of evocore_population_add: steals data/capacity
+ * from a genome that owns its memory and leaves the source empty
+ * (data = NULL), so produce-then-insert paths avoid cloning large
+ * genomes. Non-owning genomes (arena-scoped, mmap views) are cloned
+ * instead, since stealing a borrowed buffer would dangle; either way
+ * the source is safe to pass to evocore_genome_cleanup afterwards.
+ *
+ * @param pop       Population to add to
+ * @param genome    Genome to move from (emptied on success)
+ * @param fitness   Fitness value
+ * @return EVOCORE_OK on success, error code otherwise
+ */
+evocore_error_t evocore_population_add_move(evocore_population_t *pop,
+                                        evocore_genome_t *genome,
+                                        double fitness);
+
+/**
+ * Replace the individual at specified index
+ *
+ * The old genome is freed and the new genome cloned in. Population
+ * aggregates are maintained incrementally in O(1); a full recompute is
+ * deferred until the replacement evicts the tracked extremum.
+ *
+ * @param pop       Population to modify
+ * @param index     Index of individual to replace
+ * @param genome    Replacement genome (will be cloned)
+ * @param fitness   Fitness value for the replacement
+ * @return EVOCORE_OK on success, error code otherwise
+ */
+evocore_error_t evocore_population_replace(evocore_population_t *pop,
+                                       size_t index,
+                                       const evocore_genome_t *genome,
+                                       double fitness);
+
+/**
+ * Replace an individual by moving in a genome
+ *
+ * Zero-copy variant of evocore_population_replace with the same move
+ * semantics as evocore_population_add_move: owning genomes are stolen
+ * and emptied, non-owning genomes are cloned.
+ *
+ * @param pop       Population to modify
+ * @param index     Index of individual to replace
+ * @param genome    Genome to move from (emptied on success)
+ * @param fitness   Fitness value for the replacement
+ * @return EVOCORE_OK on success, error code otherwise
+ */
+evocore_error_t evocore_population_replace_move(evocore_population_t *pop,
+                                            size_t index,
+                                            evocore_genome_t *genome,
+                                            double fitness);
+
+/**
+ * Replace an individual by trading genome buffers
+ *
+ * Allocation-free variant of evocore_population_replace: the caller's
+ * genome is installed at index and the evicted genome's storage is
+ * handed back through the same pointer for reuse, so tight
+ * produce-replace loops (steady-state evolution) never touch the
+ * allocator. Both genomes must own their memory; views fall back to
+ * the cloning path.
+ *
+ * @param pop       Population to modify
+ * @param index     Index of individual to replace
+ * @param genome    Genome to install (receives the evicted buffer)
+ * @param fitness   Fitness value for the replacement
+ * @return EVOCORE_OK on success, error code otherwise
+ */
+evocore_error_t evocore_population_replace_swap(evocore_population_t *pop,
+                                            size_t index,
+                                            evocore_genome_t *genome,
+                                            double fitness);
+
+/**
+ * Swap the contents of two populations
+ *
+ * Exchanges individuals, sizes, and aggregates in O(1) by swapping the
+ * underlying storage - no genome bytes are copied. Useful for
+ * double-buffered generation schemes (evolve into a scratch
+ * population, then swap it with the live one).
+ *
+ * @param a         First population
+ * @param b         Second population
+ * @return EVOCORE_OK on success, error code otherwise
+ */
+evocore_error_t evocore_population_swap(evocore_population_t *a,
+                                    evocore_population_t *b);
+
 /**
  * Remove an individual at specified index
  *
@@ -178,6 +371,18 @@ void evocore_population_increment_generation(evocore_population_t *pop);
  */
 evocore_error_t evocore_population_update_stats(evocore_population_t *pop);
 
+/**
+ * Refresh statistics only if they are stale
+ *
+ * Add/replace/remove maintain the aggregates incrementally, so this is
+ * O(1) unless an eviction invalidated the tracked extremum, in which
+ * case it falls back to a full scan.
+ *
+ * @param pop       Population
+ * @return EVOCORE_OK on success, error code otherwise
+ */
+evocore_error_t evocore_population_refresh_stats(evocore_population_t *pop);
+
 /**
  * Sort population by fitness (descending)
  *
@@ -188,6 +393,24 @@ evocore_error_t evocore_population_update_stats(evocore_population_t *pop);
  */
 evocore_error_t evocore_population_sort(evocore_population_t *pop);
 
+/**
+ * Partially select the top K individuals to the front
+ *
+ * After the call, indices [0, k) hold the k best individuals in
+ * descending fitness order; the rest are in arbitrary order. Uses
+ * quickselect, so this is O(n + k log k) instead of the O(n log n)
+ * full sort - elitism and truncation selection only need the top K,
+ * which for large populations skips almost all of the comparison work.
+ * Use evocore_population_sort when the full ordering matters
+ * (reporting, ranked exports).
+ *
+ * @param pop       Population to select from
+ * @param k         Number of top individuals to place in front
+ * @return EVOCORE_OK on success, error code otherwise
+ */
+evocore_error_t evocore_population_select_top(evocore_population_t *pop,
+                                          size_t k);
+
 /*========================================================================
  * Evolution Operations
  *========================================================================*/
@@ -197,7 +420,9 @@ evocore_error_t evocore_population_sort(evocore_population_t *pop);
  *
  * @param pop               Population to select from
  * @param tournament_size   Number of individuals in tournament
- * @param seed              Random seed pointer (will be updated)
+ * @param seed              Random seed pointer (will be updated), or NULL
+ *                          to draw from the thread-local PRNG service
+ *                          (see evocore/random.h)
  * @return Index of selected parent, or SIZE_MAX on error
  */
 size_t evocore_population_tournament_select(const evocore_population_t *pop,
@@ -207,7 +432,8 @@ size_t evocore_population_tournament_select(const evocore_population_t *pop,
 /**
  * Truncate population to keep top N individuals
  *
- * Frees removed individuals.
+ * Partially selects the survivors to the front first (the population
+ * does not need to be pre-sorted), then frees removed individuals.
  *
  * @param pop       Population to truncate
  * @param n         Number of individuals to keep
@@ -255,7 +481,8 @@ evocore_error_t evocore_genome_crossover(const evocore_genome_t *parent1,
  *
  * @param genome    Genome to mutate
  * @param rate      Mutation rate (0.0 to 1.0)
- * @param seed      Random seed pointer (will be updated)
+ * @param seed      Random seed pointer (will be updated), or NULL to
+ *                  draw from the thread-local PRNG service
  * @return EVOCORE_OK on success, error code otherwise
  */
 evocore_error_t evocore_genome_mutate(evocore_genome_t *genome,
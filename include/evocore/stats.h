@@ -14,6 +14,196 @@
 #include "evocore/memory.h"
 #include <stddef.h>
 #include <stdbool.h>
+#include <stdint.h>
+
+/*========================================================================
+ * Per-Phase Instrumentation
+ *========================================================================*/
+
+/**
+ * Hot-path phases instrumented with scoped timers
+ *
+ * Answers "where did the generation go?" without attaching an external
+ * profiler: selection, mutation, evaluation, and the learn paths each
+ * feed their own latency histogram.
+ */
+typedef enum {
+    EVOCORE_PHASE_SELECTION = 0,    /* Tournament select + population sort */
+    EVOCORE_PHASE_MUTATION,         /* Genome mutation */
+    EVOCORE_PHASE_EVALUATION,       /* Fitness evaluation (whole batch) */
+    EVOCORE_PHASE_CONTEXT_LEARN,    /* evocore_context_learn* */
+    EVOCORE_PHASE_TEMPORAL_LEARN,   /* evocore_temporal_learn */
+    EVOCORE_PHASE_COUNT
+} evocore_phase_t;
+
+/** Log2-spaced latency buckets: bucket i counts samples in [2^i, 2^(i+1)) ns */
+#define EVOCORE_PHASE_HIST_BUCKETS 32
+
+/**
+ * Aggregated timing for one phase
+ *
+ * Accumulated globally with relaxed atomics so instrumented paths pay
+ * one clock read and a handful of uncontended adds per sample. All
+ * fields stay zero unless the library is built with EVOCORE_PHASE_TIMING.
+ */
+typedef struct {
+    uint64_t count;                              /* Samples recorded */
+    uint64_t total_ns;                           /* Sum of sample durations */
+    uint64_t buckets[EVOCORE_PHASE_HIST_BUCKETS]; /* Log2 latency histogram */
+} evocore_phase_timing_t;
+
+/**
+ * Get human-readable phase name
+ *
+ * @param phase    Phase identifier
+ * @return Static string ("selection", "mutation", ...)
+ */
+const char* evocore_phase_name(evocore_phase_t phase);
+
+/**
+ * Record one timing sample for a phase
+ *
+ * Normally invoked through EVOCORE_PHASE_BEGIN/END rather than directly.
+ * Thread-safe; no-op when built without EVOCORE_PHASE_TIMING.
+ *
+ * @param phase       Phase identifier
+ * @param elapsed_ns  Sample duration in nanoseconds
+ */
+void evocore_phase_timing_record(evocore_phase_t phase, uint64_t elapsed_ns);
+
+/**
+ * Copy the global per-phase histograms into a caller buffer
+ *
+ * @param out    Array of EVOCORE_PHASE_COUNT entries to fill
+ */
+void evocore_phase_timing_snapshot(evocore_phase_timing_t out[EVOCORE_PHASE_COUNT]);
+
+/**
+ * Reset all per-phase histograms to zero
+ */
+void evocore_phase_timing_reset(void);
+
+/**
+ * Estimate a latency percentile from a phase histogram
+ *
+ * Resolution is one log2 bucket; returns the geometric midpoint of the
+ * bucket containing the requested percentile.
+ *
+ * @param timing      Phase timing snapshot
+ * @param percentile  Percentile in [0, 100] (e.g. 50.0, 99.0)
+ * @return Estimated latency in nanoseconds, or 0 if no samples
+ */
+double evocore_phase_timing_percentile(const evocore_phase_timing_t *timing,
+                                      double percentile);
+
+/*========================================================================
+ * Trace Timeline Export
+ * ========================================================================
+ *
+ * Where the phase histograms answer "how long", the trace answers
+ * "when, and on which thread": instrumented regions record begin/end
+ * events (thread, phase name, generation) into bounded per-thread ring
+ * buffers, dumped on demand as chrome://tracing JSON. Recording costs
+ * one relaxed flag load when tracing is off, so it can stay compiled
+ * into production builds and be switched on during a slowdown.
+ */
+
+/**
+ * Start trace recording
+ *
+ * Each recording thread gets its own ring of events_per_thread slots
+ * (0 for the default); old events are overwritten when a ring wraps,
+ * so memory stays bounded at rings * capacity. The per-thread capacity
+ * is fixed by the first start and reused by later ones. Call while
+ * tracing is stopped.
+ *
+ * @param events_per_thread Ring capacity per thread (0 = default 8192)
+ * @return EVOCORE_OK on success, error code otherwise
+ */
+evocore_error_t evocore_trace_start(size_t events_per_thread);
+
+/**
+ * Stop trace recording
+ *
+ * Recorded events stay available for evocore_trace_dump.
+ */
+void evocore_trace_stop(void);
+
+/**
+ * Check whether tracing is currently recording
+ *
+ * @return true while tracing is started
+ */
+bool evocore_trace_enabled(void);
+
+/**
+ * Tag subsequent events with a generation number
+ *
+ * Called by the evolution loop once per generation; events carry the
+ * value in their args for filtering in the trace viewer.
+ *
+ * @param generation    Current generation
+ */
+void evocore_trace_set_generation(size_t generation);
+
+/**
+ * Record one begin/end event pair
+ *
+ * Normally invoked through EVOCORE_TRACE_BEGIN/END or the phase
+ * macros. name must be a static string (it is stored, not copied).
+ * No-op while tracing is stopped.
+ *
+ * @param name      Static event name ("evaluation", "gpu_batch", ...)
+ * @param begin_ns  Region start, from evocore_phase_clock_ns
+ * @param end_ns    Region end
+ */
+void evocore_trace_record(const char *name, uint64_t begin_ns, uint64_t end_ns);
+
+/**
+ * Dump recorded events as chrome://tracing JSON
+ *
+ * Writes every thread's ring to filepath in Trace Event Format; load
+ * the file in chrome://tracing or Perfetto. Safe to call while
+ * tracing is running (in-flight events may be missed or torn, which
+ * the viewer tolerates); stop first for an exact snapshot.
+ *
+ * @param filepath    Output path
+ * @return EVOCORE_OK on success, error code otherwise
+ */
+evocore_error_t evocore_trace_dump(const char *filepath);
+
+/*
+ * Scoped timing macros. Compiled out entirely (no clock reads, no
+ * atomics) when EVOCORE_PHASE_TIMING is not defined at build time.
+ * The phase macros feed both the histograms and the trace; the trace
+ * macros record a named trace span only.
+ */
+#ifdef EVOCORE_PHASE_TIMING
+#include <time.h>
+
+static inline uint64_t evocore_phase_clock_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+#define EVOCORE_PHASE_BEGIN(var) uint64_t var = evocore_phase_clock_ns()
+#define EVOCORE_PHASE_END(var, phase) \
+    do { \
+        uint64_t evocore_phase_now_ = evocore_phase_clock_ns(); \
+        evocore_phase_timing_record((phase), evocore_phase_now_ - (var)); \
+        evocore_trace_record(evocore_phase_name(phase), (var), \
+                             evocore_phase_now_); \
+    } while (0)
+#define EVOCORE_TRACE_BEGIN(var) uint64_t var = evocore_phase_clock_ns()
+#define EVOCORE_TRACE_END(var, name) \
+    evocore_trace_record((name), (var), evocore_phase_clock_ns())
+#else
+#define EVOCORE_PHASE_BEGIN(var) (void)0
+#define EVOCORE_PHASE_END(var, phase) (void)0
+#define EVOCORE_TRACE_BEGIN(var) (void)0
+#define EVOCORE_TRACE_END(var, name) (void)0
+#endif
 
 /*========================================================================
  * Evolution Statistics
@@ -55,6 +245,10 @@ typedef struct {
     /* Memory usage */
     size_t memory_usage_bytes;
 
+    /* Per-phase hot-path timing; snapshotted by evocore_stats_update
+     * when track_timing is on (all zeros without EVOCORE_PHASE_TIMING) */
+    evocore_phase_timing_t phase_timing[EVOCORE_PHASE_COUNT];
+
     /* Tracking options */
     bool track_memory;
     bool track_timing;
@@ -154,6 +348,27 @@ bool evocore_stats_is_stagnant(const evocore_stats_t *stats);
  */
 double evocore_stats_diversity(const evocore_population_t *pop);
 
+/**
+ * Estimate diversity by adaptive pair sampling
+ *
+ * Samples random pairs and compares genomes with a word-wide popcount
+ * distance until the standard error of the estimate drops below
+ * target_stderr (or a hard sample cap is reached), so large
+ * populations get an O(samples) estimate instead of an O(n^2) scan.
+ * Cheap enough to feed evocore_adaptive_scheduler_update every
+ * generation.
+ *
+ * @param pop            Population to analyze
+ * @param target_stderr  Confidence target; <= 0 uses 0.01
+ * @param seed           Random seed pointer (will be updated)
+ * @param out_stderr     Output: achieved standard error (can be NULL)
+ * @return Diversity score (0 to 1), or 0 on error
+ */
+double evocore_stats_diversity_estimate(const evocore_population_t *pop,
+                                       double target_stderr,
+                                       unsigned int *seed,
+                                       double *out_stderr);
+
 /**
  * Get fitness statistics for population
  *
@@ -170,6 +385,66 @@ evocore_error_t evocore_stats_fitness_distribution(const evocore_population_t *p
                                              double *out_mean,
                                              double *out_stddev);
 
+/*========================================================================
+ * Published Statistics Snapshots
+ * ========================================================================
+ *
+ * Seqlock publication for monitor threads. The evolution thread keeps
+ * updating its private evocore_stats_t as usual and publishes it once
+ * per generation; any number of readers pull a consistent copy without
+ * ever making the writer block or wait. The writer's cost is one
+ * memcpy plus two atomic increments; readers retry on the rare torn
+ * read instead of locking.
+ */
+
+/**
+ * Statistics snapshot publisher
+ */
+typedef struct evocore_stats_publisher_t evocore_stats_publisher_t;
+
+/**
+ * Create a snapshot publisher
+ *
+ * @return New publisher, or NULL on failure
+ */
+evocore_stats_publisher_t* evocore_stats_publisher_create(void);
+
+/**
+ * Destroy a snapshot publisher
+ *
+ * Readers must be done with it first.
+ *
+ * @param pub    Publisher to destroy
+ */
+void evocore_stats_publisher_destroy(evocore_stats_publisher_t *pub);
+
+/**
+ * Publish a statistics snapshot (writer side)
+ *
+ * Called by the evolution thread, typically right after
+ * evocore_stats_update. Never blocks: concurrent readers retry
+ * instead. Single writer only.
+ *
+ * @param pub      Publisher
+ * @param stats    Statistics to publish (copied)
+ * @return EVOCORE_OK on success, error code otherwise
+ */
+evocore_error_t evocore_stats_publish(evocore_stats_publisher_t *pub,
+                                      const evocore_stats_t *stats);
+
+/**
+ * Read the latest published snapshot (reader side)
+ *
+ * Retries until it gets a copy untorn by a concurrent publish; safe
+ * from any number of monitor threads.
+ *
+ * @param pub    Publisher
+ * @param out    Output: consistent statistics copy
+ * @return EVOCORE_OK, or EVOCORE_ERR_UNKNOWN before the first publish
+ */
+evocore_error_t evocore_stats_read(const evocore_stats_publisher_t *pub,
+                                   evocore_stats_t *out);
+
 /*========================================================================
  * Progress Reporting
  *========================================================================*/
@@ -0,0 +1,110 @@
+/**
+ * Steady-State Evolution Engine
+ *
+ * Continuous alternative to the generational loop: each step selects
+ * parents by tournament, produces a single offspring, evaluates it,
+ * and replaces the current worst individual in place. Progress is
+ * smooth and constant-rate - no latency spike while a whole generation
+ * is rebuilt - and the offspring buffer is recycled through
+ * evocore_population_replace_swap, so the hot loop performs no
+ * allocations.
+ */
+
+#ifndef EVOCORE_STEADY_STATE_H
+#define EVOCORE_STEADY_STATE_H
+
+#include "evocore/population.h"
+#include "evocore/domain.h"
+#include "evocore/error.h"
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * Steady-state engine configuration
+ */
+typedef struct {
+    size_t tournament_size;   /* Tournament size for parent selection (0 = 3) */
+    double mutation_rate;     /* Mutation rate applied to every offspring */
+    double crossover_rate;    /* Probability offspring comes from crossover
+                               * of two parents rather than a mutated copy */
+    unsigned int seed;        /* PRNG seed (0 = seeded from the clock) */
+} evocore_steady_state_config_t;
+
+/**
+ * Default steady-state configuration
+ */
+#define EVOCORE_STEADY_STATE_DEFAULTS { .tournament_size = 3, \
+                                       .mutation_rate = 0.01, \
+                                       .crossover_rate = 0.9, \
+                                       .seed = 0 }
+
+/**
+ * Steady-state engine handle
+ */
+typedef struct evocore_steady_state_t evocore_steady_state_t;
+
+/**
+ * Create a steady-state engine over a population
+ *
+ * The population must already be initialized and evaluated (steps
+ * replace the worst individual, so unevaluated NaN individuals are
+ * replaced first). The engine borrows the population and domain; both
+ * must outlive it.
+ *
+ * @param pop       Population to evolve in place
+ * @param domain    Domain providing mutation/crossover/fitness
+ * @param config    Configuration (NULL for defaults)
+ * @return Engine instance, or NULL on failure
+ */
+evocore_steady_state_t* evocore_steady_state_create(
+    evocore_population_t *pop,
+    const evocore_domain_t *domain,
+    const evocore_steady_state_config_t *config);
+
+/**
+ * Produce, evaluate, and insert one offspring
+ *
+ * Selects parents by tournament, builds the offspring in a reused
+ * scratch buffer (domain crossover when available, uniform byte
+ * crossover otherwise), mutates and evaluates it, then swap-replaces
+ * the current worst individual. The population's generation counter
+ * advances once every population-size steps, so generation-based
+ * cadence (checkpointing, logging) keeps working.
+ *
+ * @param engine    Engine to step
+ * @return EVOCORE_OK on success, error code otherwise
+ */
+evocore_error_t evocore_steady_state_step(evocore_steady_state_t *engine);
+
+/**
+ * Run a fixed number of steady-state steps
+ *
+ * @param engine    Engine to run
+ * @param steps     Number of offspring to produce
+ * @return EVOCORE_OK on success, first error otherwise
+ */
+evocore_error_t evocore_steady_state_run(evocore_steady_state_t *engine,
+                                     size_t steps);
+
+/**
+ * Get engine counters
+ *
+ * @param engine    Engine to query
+ * @param steps     Output: offspring produced (can be NULL)
+ * @param improved  Output: offspring fitter than the individual they
+ *                  replaced (can be NULL)
+ */
+void evocore_steady_state_get_stats(const evocore_steady_state_t *engine,
+                                uint64_t *steps,
+                                uint64_t *improved);
+
+/**
+ * Destroy a steady-state engine
+ *
+ * The population is left in its current evolved state.
+ *
+ * @param engine    Engine to destroy
+ */
+void evocore_steady_state_destroy(evocore_steady_state_t *engine);
+
+#endif /* EVOCORE_STEADY_STATE_H */
@@ -88,12 +88,25 @@ typedef struct {
  * Context similarity matrix
  *
  * Tracks similarity between contexts for transfer learning.
+ *
+ * Acts as an incrementally maintained cache: pairs are computed lazily
+ * from the registered parameter snapshots on first lookup and served
+ * from the table afterwards. Re-registering a context's parameters
+ * (a learn event) invalidates just that context's row and column, so
+ * repeated synthesis against a slow-moving context family stays a
+ * table lookup instead of an O(contexts x params) recompute.
  */
 typedef struct {
     size_t context_count;
     char **context_ids;
     double **similarity_matrix;    /* context_count x context_count */
     time_t last_update;
+
+    /* Cache state */
+    unsigned char **valid;         /* Per-pair: cached value is current */
+    double **params;               /* Registered parameter snapshots */
+    size_t param_count;            /* Snapshot length (0 until first set) */
+    double max_distance;           /* Decay scale for lazy computes */
 } evocore_similarity_matrix_t;
 
 /*========================================================================
@@ -191,6 +204,29 @@ bool evocore_synthesis_weighted(
     double *out_parameters
 );
 
+/**
+ * Similarity-weighted synthesis
+ *
+ * Like evocore_synthesis_weighted, but each source's confidence is
+ * scaled by its cached similarity to the target context, so blending
+ * for a context family costs a table lookup per source. Sources whose
+ * context the matrix does not know contribute at the minimum
+ * similarity floor. Falls back to the plain confidence weighting when
+ * no matrix or target is given.
+ *
+ * @param request Synthesis request
+ * @param matrix Similarity cache (or NULL)
+ * @param target_context Context being synthesized for (or NULL)
+ * @param out_parameters Output array
+ * @return true on success
+ */
+bool evocore_synthesis_weighted_similarity(
+    const evocore_synthesis_request_t *request,
+    evocore_similarity_matrix_t *matrix,
+    const char *target_context,
+    double *out_parameters
+);
+
 /**
  * Trend synthesis
  *
@@ -278,9 +314,32 @@ evocore_similarity_matrix_t* evocore_similarity_matrix_create(
  */
 void evocore_similarity_matrix_free(evocore_similarity_matrix_t *matrix);
 
+/**
+ * Register or refresh a context's parameter snapshot
+ *
+ * Call on learn events. Invalidates the context's cached row and
+ * column; similarities against it are recomputed lazily on the next
+ * lookup. The snapshot length is fixed by the first registration.
+ *
+ * @param matrix Similarity matrix
+ * @param context_id Context to register
+ * @param parameters Current parameter values
+ * @param param_count Number of parameters
+ * @return true on success
+ */
+bool evocore_similarity_set_params(
+    evocore_similarity_matrix_t *matrix,
+    const char *context_id,
+    const double *parameters,
+    size_t param_count
+);
+
 /**
  * Update similarity between contexts
  *
+ * Manually overrides the cached pair (symmetric); the value stays
+ * until one of the two contexts is invalidated by a learn event.
+ *
  * @param matrix Similarity matrix
  * @param context_a First context
  * @param context_b Second context
@@ -297,13 +356,16 @@ bool evocore_similarity_update(
 /**
  * Get similarity between contexts
  *
+ * Served from the cache when the pair is current; otherwise computed
+ * from the registered parameter snapshots and cached.
+ *
  * @param matrix Similarity matrix
  * @param context_a First context
  * @param context_b Second context
  * @return Similarity score (0-1), or 0 if not found
  */
 double evocore_similarity_get(
-    const evocore_similarity_matrix_t *matrix,
+    evocore_similarity_matrix_t *matrix,
     const char *context_a,
     const char *context_b
 );
@@ -316,7 +378,7 @@ double evocore_similarity_get(
  * @return Most similar context ID, or NULL
  */
 const char* evocore_similarity_find_nearest(
-    const evocore_similarity_matrix_t *matrix,
+    evocore_similarity_matrix_t *matrix,
     const char *target_context
 );
 
@@ -377,7 +439,7 @@ bool evocore_transfer_params(
     const double *source_params,
     const char *source_context,
     const char *target_context,
-    const evocore_similarity_matrix_t *similarity_matrix,
+    evocore_similarity_matrix_t *similarity_matrix,
     size_t param_count,
     double *out_params,
     double adjustment_factor
@@ -397,7 +459,7 @@ bool evocore_transfer_params(
  */
 size_t evocore_find_transferable_contexts(
     const char *target_context,
-    const evocore_similarity_matrix_t *similarity_matrix,
+    evocore_similarity_matrix_t *similarity_matrix,
     double min_similarity,
     const char **out_contexts,
     size_t max_contexts
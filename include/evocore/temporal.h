@@ -65,16 +65,34 @@ typedef struct {
 /**
  * Temporal bucket list
  *
- * Linked list of time buckets for a specific context.
- * Ordered chronologically.
+ * Fixed-capacity ring buffer of time buckets for a specific context.
+ * Appending a bucket is O(1): when the ring is full the oldest bucket
+ * is overwritten instead of shifting the array. Use
+ * evocore_temporal_list_bucket() for chronological access; indexing
+ * `buckets` directly gives ring order, not time order.
  */
 typedef struct {
-    evocore_temporal_bucket_t *buckets;  /* Array of buckets */
-    size_t count;                       /* Number of buckets */
+    evocore_temporal_bucket_t *buckets;  /* Ring storage, capacity slots */
+    size_t count;                       /* Number of live buckets */
     size_t capacity;                    /* Allocated capacity */
+    size_t head;                        /* Ring slot of the oldest bucket */
     evocore_temporal_bucket_type_t bucket_type; /* Time granularity */
 } evocore_temporal_list_t;
 
+/**
+ * Get a bucket by chronological index
+ *
+ * Index 0 is the oldest retained bucket, count-1 the newest.
+ *
+ * @param list  Bucket list
+ * @param index Chronological index (must be < list->count)
+ * @return Bucket pointer, or NULL if index is out of range
+ */
+evocore_temporal_bucket_t* evocore_temporal_list_bucket(
+    const evocore_temporal_list_t *list,
+    size_t index
+);
+
 /**
  * Context key for temporal system
  *
@@ -301,6 +319,62 @@ bool evocore_temporal_detect_regime_change(
     double threshold
 );
 
+/**
+ * Query the incremental regime detector (O(1))
+ *
+ * Each context maintains a two-sided CUSUM over its fitness stream,
+ * updated as observations arrive in evocore_temporal_learn, so this
+ * is a constant-time state read suitable for per-tick polling. The
+ * bucket-based evocore_temporal_detect_regime_change remains for
+ * retrospective/offline analysis.
+ *
+ * The threshold is in accumulated standard deviations; 5.0 is a
+ * reasonable default (shifts below half a standard deviation
+ * accumulate no evidence). After acting on a detection, call
+ * evocore_temporal_regime_reset to re-baseline.
+ *
+ * @param system Temporal system
+ * @param context_key Context identifier
+ * @param threshold CUSUM decision threshold (> 0)
+ * @return true if either CUSUM statistic exceeds the threshold
+ */
+bool evocore_temporal_regime_changed(
+    const evocore_temporal_system_t *system,
+    const char *context_key,
+    double threshold
+);
+
+/**
+ * Read the raw CUSUM statistics for a context
+ *
+ * @param system Temporal system
+ * @param context_key Context identifier
+ * @param out_positive Output upward-shift statistic (can be NULL)
+ * @param out_negative Output downward-shift statistic (can be NULL)
+ * @return true if the context exists
+ */
+bool evocore_temporal_regime_state(
+    const evocore_temporal_system_t *system,
+    const char *context_key,
+    double *out_positive,
+    double *out_negative
+);
+
+/**
+ * Re-baseline the incremental detector after a regime change
+ *
+ * Clears the CUSUM statistics and the running fitness baseline so
+ * detection restarts against the new regime.
+ *
+ * @param system Temporal system
+ * @param context_key Context identifier
+ * @return true if the context exists
+ */
+bool evocore_temporal_regime_reset(
+    evocore_temporal_system_t *system,
+    const char *context_key
+);
+
 /*========================================================================
  * Bucket Management
  *========================================================================*/
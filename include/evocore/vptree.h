@@ -0,0 +1,133 @@
+/**
+ * Evocore Metric Index Module
+ *
+ * Vantage-point tree over parameter vectors for nearest-neighbor and
+ * radius queries in Euclidean space (evocore_param_distance).
+ *
+ * Brute-force similarity scans over learned history cost O(n) per
+ * candidate and dominate once the history reaches tens of thousands of
+ * records. The VP-tree partitions space by distance to a vantage point,
+ * so queries prune whole subtrees via the triangle inequality and run in
+ * O(log n) expected time on well-distributed data.
+ *
+ * Key Concepts:
+ * - Incremental Insertion: points are routed down the tree as they
+ *   arrive; each node's partition radius is fixed by the first point
+ *   routed through it, so no bulk rebuild is needed
+ * - Nearest Neighbor: branch-and-bound search with triangle-inequality
+ *   pruning
+ * - Radius Query: reports every indexed vector within a given distance
+ *
+ * The index stores its own copy of each parameter vector plus an opaque
+ * user pointer, so callers can map results back to their own records.
+ * Deletion is not supported; rebuild the index after bulk pruning.
+ */
+
+#ifndef EVOCORE_VPTREE_H
+#define EVOCORE_VPTREE_H
+
+#include <stddef.h>
+#include <stdbool.h>
+
+/*========================================================================
+ * Data Structures
+ *========================================================================*/
+
+/**
+ * Opaque metric index handle
+ */
+typedef struct evocore_vptree_t evocore_vptree_t;
+
+/*========================================================================
+ * Lifecycle
+ *========================================================================*/
+
+/**
+ * Create a metric index over vectors of a fixed dimension
+ *
+ * @param param_count Dimension of every indexed vector (> 0)
+ * @return New index, or NULL on error
+ */
+evocore_vptree_t* evocore_vptree_create(size_t param_count);
+
+/**
+ * Free a metric index
+ *
+ * Releases all nodes and the stored vector copies. User data pointers
+ * are not freed; they remain owned by the caller.
+ *
+ * @param tree Index to free (NULL is a no-op)
+ */
+void evocore_vptree_free(evocore_vptree_t *tree);
+
+/*========================================================================
+ * Insertion and Queries
+ *========================================================================*/
+
+/**
+ * Insert a parameter vector
+ *
+ * The vector is copied; user_data is stored as-is and returned by
+ * queries. Duplicate vectors are allowed.
+ *
+ * @param tree Index
+ * @param parameters Vector of param_count values
+ * @param user_data Opaque pointer returned with query results (may be NULL)
+ * @return true on success, false on allocation failure or bad arguments
+ */
+bool evocore_vptree_insert(
+    evocore_vptree_t *tree,
+    const double *parameters,
+    void *user_data
+);
+
+/**
+ * Find the indexed vector nearest to a query point
+ *
+ * @param tree Index
+ * @param query Vector of param_count values
+ * @param out_parameters Output: pointer to the stored vector (owned by
+ *                       the index, valid until evocore_vptree_free); may be NULL
+ * @param out_user_data Output: user pointer of the match; may be NULL
+ * @param out_distance Output: Euclidean distance to the match; may be NULL
+ * @return true if the index is non-empty and a match was found
+ */
+bool evocore_vptree_nearest(
+    const evocore_vptree_t *tree,
+    const double *query,
+    const double **out_parameters,
+    void **out_user_data,
+    double *out_distance
+);
+
+/**
+ * Collect all indexed vectors within a radius of a query point
+ *
+ * Results are written in tree order, not sorted by distance. The return
+ * value counts every match, so a return greater than max_results means
+ * the output array was too small.
+ *
+ * @param tree Index
+ * @param query Vector of param_count values
+ * @param radius Maximum Euclidean distance (inclusive)
+ * @param out_user_data Output array of user pointers (may be NULL to count only)
+ * @param max_results Capacity of out_user_data
+ * @return Total number of vectors within the radius
+ */
+size_t evocore_vptree_radius(
+    const evocore_vptree_t *tree,
+    const double *query,
+    double radius,
+    void **out_user_data,
+    size_t max_results
+);
+
+/**
+ * Get number of indexed vectors
+ *
+ * @param tree Index
+ * @return Vector count, or 0 if tree is NULL
+ */
+size_t evocore_vptree_count(const evocore_vptree_t *tree);
+
+#endif /* EVOCORE_VPTREE_H */
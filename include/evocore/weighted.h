@@ -38,11 +38,23 @@ typedef struct {
 /**
  * Weighted statistics array
  *
- * For tracking multiple parameters (e.g., 64 trading parameters)
+ * For tracking multiple parameters (e.g., 64 trading parameters).
+ *
+ * Laid out as structure-of-arrays: each statistic streams contiguously
+ * so the bulk update and query paths vectorize. Use the element
+ * accessors below to read or write a single parameter as an
+ * evocore_weighted_stats_t view.
  */
 typedef struct {
-    evocore_weighted_stats_t *stats;  /* Array of stats */
-    size_t count;                     /* Number of parameters */
+    size_t count;            /* Number of parameters */
+    double *mean;            /* Weighted means */
+    double *variance;        /* Weighted variances */
+    double *sum_weights;     /* Sums of weights */
+    double *m2;              /* Sums of squared deviations */
+    double *sum_weighted_x;  /* Sums of value * weight */
+    double *min_value;       /* Minimum observed values */
+    double *max_value;       /* Maximum observed values */
+    size_t *counts;          /* Observations per parameter */
 } evocore_weighted_array_t;
 
 /*========================================================================
@@ -104,7 +116,8 @@ double evocore_weighted_variance(const evocore_weighted_stats_t *stats);
  * mean and standard deviation.
  *
  * @param stats Statistics structure
- * @param seed Random seed pointer (updated in-place)
+ * @param seed Random seed pointer (updated in-place), or NULL to draw
+ *             from the thread-local PRNG service
  * @return Sampled value
  */
 double evocore_weighted_sample(
@@ -238,6 +251,74 @@ bool evocore_weighted_array_sample(
  */
 void evocore_weighted_array_reset(evocore_weighted_array_t *array);
 
+/**
+ * Get weighted mean of one parameter
+ *
+ * @param array Statistics array
+ * @param index Parameter index
+ * @return Weighted mean, or 0.0 if out of range or no observations
+ */
+double evocore_weighted_array_mean(
+    const evocore_weighted_array_t *array,
+    size_t index
+);
+
+/**
+ * Get weighted standard deviation of one parameter
+ *
+ * @param array Statistics array
+ * @param index Parameter index
+ * @return Weighted std dev, or 0.0 if out of range or insufficient samples
+ */
+double evocore_weighted_array_std(
+    const evocore_weighted_array_t *array,
+    size_t index
+);
+
+/**
+ * Update a single parameter in the array
+ *
+ * @param array Statistics array
+ * @param index Parameter index
+ * @param value New observation
+ * @param weight Fitness weight (higher = more influence)
+ * @return true if successful
+ */
+bool evocore_weighted_array_update_one(
+    evocore_weighted_array_t *array,
+    size_t index,
+    double value,
+    double weight
+);
+
+/**
+ * Materialize one parameter as a scalar statistics view
+ *
+ * @param array Statistics array
+ * @param index Parameter index
+ * @param out Receives the element's statistics
+ */
+void evocore_weighted_array_get(
+    const evocore_weighted_array_t *array,
+    size_t index,
+    evocore_weighted_stats_t *out
+);
+
+/**
+ * Overwrite one parameter from a scalar statistics view
+ *
+ * Used by deserialization paths that restore elements field by field.
+ *
+ * @param array Statistics array
+ * @param index Parameter index
+ * @param src Statistics to store
+ */
+void evocore_weighted_array_set(
+    evocore_weighted_array_t *array,
+    size_t index,
+    const evocore_weighted_stats_t *src
+);
+
 /*========================================================================
  * Utility Functions
  *========================================================================*/
@@ -44,6 +44,12 @@ from .core import (
     normalize_fitness,
 )
 
+# Zero-copy NumPy integration
+from .batch import (
+    PackedPopulation,
+    evaluate_generations,
+)
+
 # Learning imports
 from .learning import (
     ContextStats,
@@ -106,6 +112,10 @@ __all__ = [
     'combine_fitness',
     'normalize_fitness',
 
+    # Zero-copy NumPy integration
+    'PackedPopulation',
+    'evaluate_generations',
+
     # Learning
     'ContextStats',
     'ContextSystem',
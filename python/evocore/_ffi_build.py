@@ -132,6 +132,7 @@ typedef struct {
     size_t size;
     size_t capacity;
     bool owns_memory;
+    uint64_t fingerprint;
 } evocore_genome_t;
 
 typedef struct {
@@ -185,8 +186,28 @@ typedef struct {
     double avg_fitness;
     double worst_fitness;
     size_t best_index;
+    double fitness_sum;
+    size_t valid_count;
+    bool stats_dirty;
 } evocore_population_t;
 
+// Packed population (structure-of-arrays, contiguous genome slab)
+typedef struct {
+    unsigned char *genome_data;
+    double *fitness;
+    size_t genome_size;
+    size_t genome_stride;
+    size_t size;
+    size_t capacity;
+    size_t generation;
+} evocore_packed_population_t;
+
+evocore_error_t evocore_packed_population_init(evocore_packed_population_t *pop, size_t capacity, size_t genome_size);
+void evocore_packed_population_cleanup(evocore_packed_population_t *pop);
+unsigned char* evocore_packed_population_genome(const evocore_packed_population_t *pop, size_t index);
+evocore_error_t evocore_packed_population_pack(evocore_packed_population_t *dst, const evocore_population_t *src);
+evocore_error_t evocore_packed_population_unpack(const evocore_packed_population_t *src, evocore_population_t *dst);
+
 // Lifecycle
 evocore_error_t evocore_population_init(evocore_population_t *pop, size_t capacity);
 void evocore_population_cleanup(evocore_population_t *pop);
@@ -267,8 +288,15 @@ typedef struct {
 } evocore_weighted_stats_t;
 
 typedef struct {
-    evocore_weighted_stats_t *stats;
     size_t count;
+    double *mean;
+    double *variance;
+    double *sum_weights;
+    double *m2;
+    double *sum_weighted_x;
+    double *min_value;
+    double *max_value;
+    size_t *counts;
 } evocore_weighted_array_t;
 
 // Single value operations
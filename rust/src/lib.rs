@@ -337,5 +337,202 @@ impl Drop for EvoCoreContextSystem {
     }
 }
 
+// Packed population (structure-of-arrays layout from population.h)
+#[repr(C)]
+pub struct evocore_packed_population_t {
+    pub genome_data: *mut u8,
+    pub fitness: *mut f64,
+    pub genome_size: usize,
+    pub genome_stride: usize,
+    pub size: usize,
+    pub capacity: usize,
+    pub generation: usize,
+}
+
+extern "C" {
+    pub fn evocore_packed_population_init(
+        pop: *mut evocore_packed_population_t,
+        capacity: usize,
+        genome_size: usize,
+    ) -> i32;
+
+    pub fn evocore_packed_population_cleanup(pop: *mut evocore_packed_population_t);
+
+    pub fn evocore_packed_population_genome(
+        pop: *const evocore_packed_population_t,
+        index: usize,
+    ) -> *mut u8;
+}
+
+/// Population with a contiguous genome slab and rayon-parallel evaluation
+///
+/// Wraps `evocore_packed_population_t`: all genome bytes live in one
+/// cache-line-aligned C allocation with fitness values in a parallel
+/// array. Genomes are exposed as `&[u8]` slices borrowed straight from
+/// the slab, and [`evaluate_parallel`](Self::evaluate_parallel) fans a
+/// `Sync` closure out across the rayon pool, so Rust fitness code gets
+/// full-core scaling without per-genome FFI crossings or copies.
+pub struct EvoCorePackedPopulation {
+    pop: evocore_packed_population_t,
+}
+
+impl EvoCorePackedPopulation {
+    /// Create a packed population
+    ///
+    /// # Arguments
+    /// * `capacity` - Maximum number of individuals
+    /// * `genome_size` - Fixed genome size in bytes
+    pub fn new(capacity: usize, genome_size: usize) -> Result<Self, String> {
+        let mut pop = evocore_packed_population_t {
+            genome_data: std::ptr::null_mut(),
+            fitness: std::ptr::null_mut(),
+            genome_size: 0,
+            genome_stride: 0,
+            size: 0,
+            capacity: 0,
+            generation: 0,
+        };
+
+        let err = unsafe { evocore_packed_population_init(&mut pop, capacity, genome_size) };
+        if err != 0 {
+            return Err(format!("Failed to create packed population (error {})", err));
+        }
+
+        Ok(Self { pop })
+    }
+
+    /// Current population size
+    pub fn size(&self) -> usize {
+        self.pop.size
+    }
+
+    /// Maximum capacity
+    pub fn capacity(&self) -> usize {
+        self.pop.capacity
+    }
+
+    /// Genome size in bytes
+    pub fn genome_size(&self) -> usize {
+        self.pop.genome_size
+    }
+
+    /// Current generation number
+    pub fn generation(&self) -> usize {
+        self.pop.generation
+    }
+
+    /// Set the current population size
+    ///
+    /// Freshly allocated slots are zeroed with NaN fitness; slots
+    /// between the old and new size keep their bytes.
+    pub fn resize(&mut self, size: usize) -> Result<(), String> {
+        if size > self.pop.capacity {
+            return Err(format!(
+                "Size {} exceeds capacity {}",
+                size, self.pop.capacity
+            ));
+        }
+        self.pop.size = size;
+        Ok(())
+    }
+
+    /// Borrow the genome at `index` as a slice of the C slab
+    pub fn genome(&self, index: usize) -> Option<&[u8]> {
+        if index >= self.pop.size {
+            return None;
+        }
+        unsafe {
+            let ptr = self.pop.genome_data.add(index * self.pop.genome_stride);
+            Some(std::slice::from_raw_parts(ptr, self.pop.genome_size))
+        }
+    }
+
+    /// Mutably borrow the genome at `index`
+    pub fn genome_mut(&mut self, index: usize) -> Option<&mut [u8]> {
+        if index >= self.pop.size {
+            return None;
+        }
+        unsafe {
+            let ptr = self.pop.genome_data.add(index * self.pop.genome_stride);
+            Some(std::slice::from_raw_parts_mut(ptr, self.pop.genome_size))
+        }
+    }
+
+    /// Borrow the fitness vector (NaN for unevaluated slots)
+    pub fn fitness(&self) -> &[f64] {
+        unsafe { std::slice::from_raw_parts(self.pop.fitness, self.pop.size) }
+    }
+
+    /// Evaluate every genome in parallel on the rayon pool
+    ///
+    /// The closure receives each genome as a `&[u8]` borrowed from the
+    /// C slab (no copies) and its return value is written to the
+    /// matching fitness slot. The closure must be `Sync` because rayon
+    /// calls it from multiple worker threads concurrently. The
+    /// generation counter is incremented afterwards.
+    ///
+    /// This is the Rust-side counterpart of
+    /// `evocore_parallel_evaluate_population`: the C pthread pool is
+    /// built around C function pointers, so Rust closures are fanned
+    /// out on rayon instead and write into the same fitness array the
+    /// C library reads.
+    pub fn evaluate_parallel<F>(&mut self, fitness_func: F)
+    where
+        F: Fn(&[u8]) -> f64 + Sync,
+    {
+        use rayon::prelude::*;
+
+        let size = self.pop.size;
+        let stride = self.pop.genome_stride;
+        let genome_size = self.pop.genome_size;
+
+        let slab = unsafe { std::slice::from_raw_parts(self.pop.genome_data, size * stride) };
+        let fitness = unsafe { std::slice::from_raw_parts_mut(self.pop.fitness, size) };
+
+        fitness
+            .par_iter_mut()
+            .zip(slab.par_chunks_exact(stride))
+            .for_each(|(fit, slot)| {
+                *fit = fitness_func(&slot[..genome_size]);
+            });
+
+        self.pop.generation += 1;
+    }
+
+    /// Evaluate serially (for comparison or tiny populations)
+    pub fn evaluate<F>(&mut self, mut fitness_func: F)
+    where
+        F: FnMut(&[u8]) -> f64,
+    {
+        let size = self.pop.size;
+        let stride = self.pop.genome_stride;
+        let genome_size = self.pop.genome_size;
+
+        for i in 0..size {
+            unsafe {
+                let ptr = self.pop.genome_data.add(i * stride);
+                let slot = std::slice::from_raw_parts(ptr, genome_size);
+                *self.pop.fitness.add(i) = fitness_func(slot);
+            }
+        }
+
+        self.pop.generation += 1;
+    }
+}
+
+// SAFETY: The packed population owns its slab exclusively; access from
+// multiple threads is only done through rayon inside evaluate_parallel
+// with disjoint borrows.
+unsafe impl Send for EvoCorePackedPopulation {}
+unsafe impl Sync for EvoCorePackedPopulation {}
+
+impl Drop for EvoCorePackedPopulation {
+    fn drop(&mut self) {
+        unsafe {
+            evocore_packed_population_cleanup(&mut self.pop);
+        }
+    }
+}
+
 // Re-export rand for convenience
 pub use rand;
@@ -29,56 +29,88 @@
  * Helper Functions
  *========================================================================*/
 
-static double calculate_mean(const double *values, size_t count) {
-    if (count == 0) return 0.0;
-
-    double sum = 0.0;
-    for (size_t i = 0; i < count; i++) {
-        if (!isnan(values[i]) && !isinf(values[i])) {
-            sum += values[i];
-        }
-    }
-    return sum / count;
+/**
+ * Full accumulator rebuilds happen every this many generations; the
+ * rolling add/remove updates are exact in real arithmetic but shed a
+ * little precision each turn of the buffer, so a periodic rescan keeps
+ * drift bounded without giving up the O(1) steady state.
+ */
+#define HISTORY_REBUILD_INTERVAL 4096
+
+/**
+ * Fold one history entry into the rolling accumulators
+ *
+ * Variance uses Welford's recurrence over the finite entries; the
+ * improvement-rate slope keeps plain regression sums keyed by buffer
+ * position, matching what the old linear scan computed.
+ */
+static void history_accumulate(
+    evocore_adaptive_scheduler_t *scheduler,
+    size_t pos,
+    double value
+) {
+    if (isnan(value) || isinf(value)) return;
+
+    scheduler->history_valid_count++;
+    double delta = value - scheduler->history_mean;
+    scheduler->history_mean += delta / (double)scheduler->history_valid_count;
+    scheduler->history_m2 += delta * (value - scheduler->history_mean);
+
+    double x = (double)pos;
+    scheduler->history_sum_x += x;
+    scheduler->history_sum_xx += x * x;
+    scheduler->history_sum_y += value;
+    scheduler->history_sum_xy += x * value;
 }
 
-static double calculate_stddev(const double *values, size_t count, double mean) {
-    if (count <= 1) return 0.0;
-
-    double sum_sq = 0.0;
-    for (size_t i = 0; i < count; i++) {
-        if (!isnan(values[i]) && !isinf(values[i])) {
-            double diff = values[i] - mean;
-            sum_sq += diff * diff;
-        }
-    }
-    return sqrt(sum_sq / count);
-}
+/**
+ * Remove a displaced history entry from the rolling accumulators
+ * (Chan-style downdate, the inverse of the Welford step)
+ */
+static void history_downdate(
+    evocore_adaptive_scheduler_t *scheduler,
+    size_t pos,
+    double value
+) {
+    if (isnan(value) || isinf(value)) return;
 
-static double calculate_linear_trend(const double *values, size_t count) {
-    if (count < 2) return 0.0;
-
-    /* Simple linear regression slope */
-    double sum_x = 0.0, sum_y = 0.0, sum_xy = 0.0, sum_xx = 0.0;
-    size_t valid_count = 0;
-
-    for (size_t i = 0; i < count; i++) {
-        if (!isnan(values[i]) && !isinf(values[i])) {
-            double x = (double)i;
-            double y = values[i];
-            sum_x += x;
-            sum_y += y;
-            sum_xy += x * y;
-            sum_xx += x * x;
-            valid_count++;
-        }
+    if (scheduler->history_valid_count <= 1) {
+        scheduler->history_valid_count = 0;
+        scheduler->history_mean = 0.0;
+        scheduler->history_m2 = 0.0;
+    } else {
+        size_t n = scheduler->history_valid_count;
+        double old_mean = scheduler->history_mean;
+        scheduler->history_mean = ((double)n * old_mean - value) /
+                                  (double)(n - 1);
+        scheduler->history_m2 -= (value - scheduler->history_mean) *
+                                 (value - old_mean);
+        if (scheduler->history_m2 < 0.0) scheduler->history_m2 = 0.0;
+        scheduler->history_valid_count = n - 1;
     }
 
-    if (valid_count < 2) return 0.0;
+    double x = (double)pos;
+    scheduler->history_sum_x -= x;
+    scheduler->history_sum_xx -= x * x;
+    scheduler->history_sum_y -= value;
+    scheduler->history_sum_xy -= x * value;
+}
 
-    double n = (double)valid_count;
-    double slope = (n * sum_xy - sum_x * sum_y) / (n * sum_xx - sum_x * sum_x);
+/**
+ * Recompute the accumulators from the buffer contents
+ */
+static void history_rebuild(evocore_adaptive_scheduler_t *scheduler) {
+    scheduler->history_valid_count = 0;
+    scheduler->history_mean = 0.0;
+    scheduler->history_m2 = 0.0;
+    scheduler->history_sum_x = 0.0;
+    scheduler->history_sum_xx = 0.0;
+    scheduler->history_sum_y = 0.0;
+    scheduler->history_sum_xy = 0.0;
 
-    return slope;
+    for (size_t i = 0; i < scheduler->history_window_size; i++) {
+        history_accumulate(scheduler, i, scheduler->fitness_history[i]);
+    }
 }
 
 /*========================================================================
@@ -229,9 +261,17 @@ evocore_error_t evocore_adaptive_scheduler_update(
     /* Update phase */
     scheduler->current_phase = evocore_adaptive_scheduler_get_phase(scheduler);
 
-    /* Add to fitness history (circular buffer) */
-    scheduler->fitness_history[scheduler->history_position] = best_fitness;
-    scheduler->history_position = (scheduler->history_position + 1) % scheduler->history_window_size;
+    /* Add to fitness history (circular buffer), rolling the displaced
+     * entry out of the accumulators and the new one in */
+    size_t pos = scheduler->history_position;
+    history_downdate(scheduler, pos, scheduler->fitness_history[pos]);
+    scheduler->fitness_history[pos] = best_fitness;
+    history_accumulate(scheduler, pos, best_fitness);
+    scheduler->history_position = (pos + 1) % scheduler->history_window_size;
+
+    if (scheduler->current_generation % HISTORY_REBUILD_INTERVAL == 0) {
+        history_rebuild(scheduler);
+    }
 
     /* Update best fitness tracking */
     if (best_fitness > scheduler->best_fitness_ever) {
@@ -264,23 +304,38 @@ double evocore_adaptive_scheduler_get_improvement_rate(
 ) {
     if (!scheduler) return 0.0;
 
-    /* Calculate linear trend (slope) of fitness history */
-    return calculate_linear_trend(scheduler->fitness_history, scheduler->history_window_size);
+    /* Regression slope straight from the rolling sums */
+    size_t n = scheduler->history_valid_count;
+    if (n < 2) return 0.0;
+
+    double nd = (double)n;
+    return (nd * scheduler->history_sum_xy -
+            scheduler->history_sum_x * scheduler->history_sum_y) /
+           (nd * scheduler->history_sum_xx -
+            scheduler->history_sum_x * scheduler->history_sum_x);
 }
 
 double evocore_adaptive_scheduler_get_fitness_variance(
     const evocore_adaptive_scheduler_t *scheduler
 ) {
-    if (!scheduler) return 0.0;
+    if (!scheduler || scheduler->history_window_size <= 1) return 0.0;
 
-    /* Calculate coefficient of variation (CV = stddev / mean) */
-    size_t count = scheduler->history_window_size;
-    double mean = calculate_mean(scheduler->fitness_history, count);
-    double stddev = calculate_stddev(scheduler->fitness_history, count, mean);
+    /* Coefficient of variation (CV = stddev / mean) from the rolling
+     * Welford state. The mean keeps the historical convention of
+     * dividing by the full window size, so a part-filled window reads
+     * low rather than jumping around. */
+    double w = (double)scheduler->history_window_size;
+    double n = (double)scheduler->history_valid_count;
+    double mean = n * scheduler->history_mean / w;
 
     if (fabs(mean) < 1e-9) return 0.0;
 
-    return stddev / fabs(mean);
+    /* Sum of squared deviations about the window mean: shift the
+     * Welford m2 (centred on the valid-sample mean) by the offset */
+    double shift = scheduler->history_mean - mean;
+    double sum_sq = scheduler->history_m2 + n * shift * shift;
+
+    return sqrt(sum_sq / w) / fabs(mean);
 }
 
 /*========================================================================
@@ -493,7 +548,8 @@ evocore_error_t evocore_adaptive_scheduler_get_state(
     }
 
     snprintf(out_state, size,
-             "Gen=%zu/%zu Phase=%s Mut=%.4f Kill=%.2f Pop=%zu Div=%.3f Stag=%zu",
+             "Gen=%zu/%zu Phase=%s Mut=%.4f Kill=%.2f Pop=%zu Div=%.3f Stag=%zu "
+             "Imp=%.5f Var=%.4f",
              scheduler->current_generation,
              scheduler->max_generations,
              phase_str,
@@ -501,7 +557,9 @@ evocore_error_t evocore_adaptive_scheduler_get_state(
              scheduler->current_kill_percentage,
              scheduler->current_population_size,
              scheduler->current_diversity,
-             scheduler->generations_since_improvement);
+             scheduler->generations_since_improvement,
+             evocore_adaptive_scheduler_get_improvement_rate(scheduler),
+             evocore_adaptive_scheduler_get_fitness_variance(scheduler));
 
     return EVOCORE_OK;
 }
@@ -12,11 +12,60 @@
 #include <stdint.h>
 #include <string.h>
 
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
+/* 2MB: the huge-page size on every platform we target */
+#define ARENA_HUGEPAGE_SIZE (2u * 1024 * 1024)
+
 /*========================================================================
  * Arena Management
  *========================================================================*/
 
+#ifdef __linux__
+/**
+ * Map a huge-page-backed buffer: explicit hugetlb pages first, then a
+ * normal mapping with transparent huge pages advised. Returns NULL if
+ * neither mapping succeeds; *out_huge reports whether 2MB pages (or at
+ * least the THP hint) were obtained.
+ */
+static void* arena_map_huge(size_t map_size, bool *out_huge) {
+    void *mem = MAP_FAILED;
+
+#ifdef MAP_HUGETLB
+    mem = mmap(NULL, map_size, PROT_READ | PROT_WRITE,
+               MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+#endif
+    if (mem != MAP_FAILED) {
+        *out_huge = true;
+        return mem;
+    }
+
+    /* Hugetlb pool empty or unsupported: fall back to a normal mapping
+     * and ask the kernel to back it with transparent huge pages */
+    mem = mmap(NULL, map_size, PROT_READ | PROT_WRITE,
+               MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (mem == MAP_FAILED) {
+        return NULL;
+    }
+
+#ifdef MADV_HUGEPAGE
+    *out_huge = (madvise(mem, map_size, MADV_HUGEPAGE) == 0);
+#else
+    *out_huge = false;
+#endif
+
+    return mem;
+}
+#endif /* __linux__ */
+
 evocore_error_t evocore_arena_init(evocore_arena_t *arena, size_t capacity) {
+    return evocore_arena_init_ex(arena, capacity, 0);
+}
+
+evocore_error_t evocore_arena_init_ex(evocore_arena_t *arena, size_t capacity,
+                                      unsigned int flags) {
     if (!arena) {
         return EVOCORE_ERR_NULL_PTR;
     }
@@ -29,9 +78,33 @@ evocore_error_t evocore_arena_init(evocore_arena_t *arena, size_t capacity) {
     capacity = (capacity + EVOCORE_ARENA_ALIGNMENT - 1) &
                ~(EVOCORE_ARENA_ALIGNMENT - 1);
 
-    char *buffer = (char*)evocore_malloc(capacity);
+    char *buffer = NULL;
+    bool uses_mmap = false;
+    bool huge_pages = false;
+    size_t map_size = 0;
+
+#ifdef __linux__
+    if (flags & EVOCORE_ARENA_HUGEPAGES) {
+        /* Hugetlb mappings must be a multiple of the huge-page size */
+        map_size = (capacity + ARENA_HUGEPAGE_SIZE - 1) &
+                   ~((size_t)ARENA_HUGEPAGE_SIZE - 1);
+        buffer = (char*)arena_map_huge(map_size, &huge_pages);
+        if (buffer) {
+            uses_mmap = true;
+            capacity = map_size;  /* Use the whole mapping */
+        }
+    }
+#else
+    (void)flags;
+#endif
+
     if (!buffer) {
-        return EVOCORE_ERR_OUT_OF_MEMORY;
+        /* Heap fallback; mmap'd buffers are page-aligned, malloc'd ones
+         * get their alignment fixed up per-allocation in arena_alloc */
+        buffer = (char*)evocore_malloc(capacity);
+        if (!buffer) {
+            return EVOCORE_ERR_OUT_OF_MEMORY;
+        }
     }
 
     arena->buffer = buffer;
@@ -39,6 +112,9 @@ evocore_error_t evocore_arena_init(evocore_arena_t *arena, size_t capacity) {
     arena->offset = 0;
     arena->alignment = EVOCORE_ARENA_ALIGNMENT;
     arena->owns_buffer = true;  /* We allocated the buffer */
+    arena->uses_mmap = uses_mmap;
+    arena->huge_pages = huge_pages;
+    arena->map_size = map_size;
 
     return EVOCORE_OK;
 }
@@ -55,6 +131,9 @@ evocore_error_t evocore_arena_init_with_buffer(evocore_arena_t *arena,
     arena->offset = 0;
     arena->alignment = EVOCORE_ARENA_ALIGNMENT;
     arena->owns_buffer = false;  /* External buffer, do not free */
+    arena->uses_mmap = false;
+    arena->huge_pages = false;
+    arena->map_size = 0;
 
     return EVOCORE_OK;
 }
@@ -66,13 +145,33 @@ void evocore_arena_cleanup(evocore_arena_t *arena) {
 
     /* Only free if we own the buffer (allocated via arena_init) */
     if (arena->owns_buffer && arena->buffer) {
-        evocore_free(arena->buffer);
+#ifdef __linux__
+        if (arena->uses_mmap) {
+            munmap(arena->buffer, arena->map_size);
+        } else
+#endif
+        {
+            evocore_free(arena->buffer);
+        }
     }
 
     arena->buffer = NULL;
     arena->capacity = 0;
     arena->offset = 0;
     arena->owns_buffer = false;
+    arena->uses_mmap = false;
+    arena->huge_pages = false;
+    arena->map_size = 0;
+}
+
+/**
+ * Padding needed so buffer+offset lands on an alignment boundary.
+ * Zero for owned buffers (page- or heap-aligned starts plus aligned
+ * sizes), nonzero only for unaligned external buffers.
+ */
+static size_t arena_align_pad(const evocore_arena_t *arena) {
+    uintptr_t base = (uintptr_t)arena->buffer + arena->offset;
+    return (size_t)(-base & (arena->alignment - 1));
 }
 
 void* evocore_arena_alloc(evocore_arena_t *arena, size_t size) {
@@ -83,15 +182,17 @@ void* evocore_arena_alloc(evocore_arena_t *arena, size_t size) {
     /* Align size */
     size = (size + arena->alignment - 1) & ~(arena->alignment - 1);
 
+    size_t pad = arena_align_pad(arena);
+
     /* Check capacity */
-    if (arena->offset + size > arena->capacity) {
+    if (arena->offset + pad + size > arena->capacity) {
         evocore_log_error("Arena out of memory: need %zu, have %zu",
-                         arena->offset + size, arena->capacity);
+                         arena->offset + pad + size, arena->capacity);
         return NULL;
     }
 
-    void *ptr = arena->buffer + arena->offset;
-    arena->offset += size;
+    void *ptr = arena->buffer + arena->offset + pad;
+    arena->offset += pad + size;
 
     return ptr;
 }
@@ -149,7 +250,7 @@ bool evocore_arena_can_alloc(const evocore_arena_t *arena, size_t size) {
     /* Align size */
     size = (size + arena->alignment - 1) & ~(arena->alignment - 1);
 
-    return (arena->offset + size <= arena->capacity);
+    return (arena->offset + arena_align_pad(arena) + size <= arena->capacity);
 }
 
 size_t evocore_arena_snapshot(evocore_arena_t *arena) {
@@ -192,3 +293,51 @@ void evocore_arena_get_stats(const evocore_arena_t *arena,
         *alloc_count = 0;  /* Would need counter to track accurately */
     }
 }
+
+/*========================================================================
+ * Generation Scopes
+ *========================================================================*/
+
+evocore_error_t evocore_generation_begin(evocore_generation_scope_t *scope,
+                                     evocore_arena_t *arena) {
+    if (!scope || !arena) return EVOCORE_ERR_NULL_PTR;
+
+    scope->arena = arena;
+    scope->mark = evocore_arena_snapshot(arena);
+    scope->genomes_allocated = 0;
+    scope->heap_fallbacks = 0;
+
+    return EVOCORE_OK;
+}
+
+evocore_error_t evocore_generation_genome(evocore_generation_scope_t *scope,
+                                      evocore_genome_t *genome,
+                                      size_t capacity) {
+    if (!scope || !scope->arena || !genome) return EVOCORE_ERR_NULL_PTR;
+    if (capacity == 0) capacity = EVOCORE_MIN_CAPACITY;
+
+    void *data = evocore_arena_calloc(scope->arena, capacity);
+    if (!data) {
+        /* Arena exhausted - fall back to the heap so the generation
+         * still completes; cleanup frees these genomes normally */
+        scope->heap_fallbacks++;
+        return evocore_genome_init(genome, capacity);
+    }
+
+    genome->data = data;
+    genome->capacity = capacity;
+    genome->size = 0;
+    genome->owns_memory = false;
+    genome->fingerprint = 0;
+    scope->genomes_allocated++;
+
+    return EVOCORE_OK;
+}
+
+void evocore_generation_end(evocore_generation_scope_t *scope) {
+    if (!scope || !scope->arena) return;
+
+    evocore_arena_rewind(scope->arena, scope->mark);
+    scope->genomes_allocated = 0;
+    scope->heap_fallbacks = 0;
+}
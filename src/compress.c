@@ -0,0 +1,468 @@
+/**
+ * Block Compression Implementation
+ *
+ * LZ77 with a small hash table over 4-byte sequences, emitting
+ * LZ4-style token/literal/match records with 16-bit offsets, plus the
+ * block-based frame container used by checkpoint persistence.
+ */
+
+#define _GNU_SOURCE
+#include "evocore/compress.h"
+#include "internal.h"
+#include <string.h>
+
+/*========================================================================
+ * Block Codec
+ *========================================================================*/
+
+#define COMPRESS_HASH_BITS 12
+#define COMPRESS_HASH_SIZE (1u << COMPRESS_HASH_BITS)
+#define COMPRESS_MIN_MATCH 4
+/* Matches stop this many bytes before the end so the decoder's match
+ * copy never runs past the output (classic LZ4 end-of-block rule) */
+#define COMPRESS_LAST_LITERALS 5
+
+static uint32_t compress_read32(const unsigned char *p) {
+    uint32_t v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+static uint32_t compress_hash(uint32_t v) {
+    return (v * 2654435761u) >> (32 - COMPRESS_HASH_BITS);
+}
+
+size_t evocore_compress_bound(size_t src_size) {
+    /* One token per 255 literals plus length continuation bytes */
+    return src_size + src_size / 255 + 16;
+}
+
+/* Emit one sequence: literal run, then optionally a match */
+static unsigned char* compress_emit(unsigned char *op, unsigned char *oend,
+                                    const unsigned char *anchor,
+                                    size_t lit_len, size_t offset,
+                                    size_t match_len) {
+    size_t token_lit = lit_len < 15 ? lit_len : 15;
+    size_t token_match = 0;
+    if (match_len > 0) {
+        size_t m = match_len - COMPRESS_MIN_MATCH;
+        token_match = m < 15 ? m : 15;
+    }
+
+    if (op + 1 + lit_len / 255 + 1 + lit_len + 8 > oend) {
+        return NULL;  /* Not shrinking; caller stores raw */
+    }
+    *op++ = (unsigned char)((token_lit << 4) | token_match);
+
+    if (token_lit == 15) {
+        size_t rest = lit_len - 15;
+        while (rest >= 255) {
+            if (op >= oend) return NULL;
+            *op++ = 255;
+            rest -= 255;
+        }
+        if (op >= oend) return NULL;
+        *op++ = (unsigned char)rest;
+    }
+
+    memcpy(op, anchor, lit_len);
+    op += lit_len;
+
+    if (match_len > 0) {
+        *op++ = (unsigned char)(offset & 0xFF);
+        *op++ = (unsigned char)(offset >> 8);
+
+        if (token_match == 15) {
+            size_t rest = match_len - COMPRESS_MIN_MATCH - 15;
+            while (rest >= 255) {
+                if (op >= oend) return NULL;
+                *op++ = 255;
+                rest -= 255;
+            }
+            if (op >= oend) return NULL;
+            *op++ = (unsigned char)rest;
+        }
+    }
+
+    return op;
+}
+
+size_t evocore_compress_block(const unsigned char *src, size_t src_size,
+                            unsigned char *dst, size_t dst_cap) {
+    if (src == NULL || dst == NULL || src_size == 0 ||
+        src_size > EVOCORE_COMPRESS_BLOCK_SIZE) {
+        return 0;
+    }
+
+    uint32_t table[COMPRESS_HASH_SIZE];
+    memset(table, 0xFF, sizeof(table));  /* UINT32_MAX = empty */
+
+    const unsigned char *ip = src;
+    const unsigned char *iend = src + src_size;
+    const unsigned char *anchor = src;
+    unsigned char *op = dst;
+    unsigned char *oend = dst + dst_cap;
+
+    if (src_size > COMPRESS_MIN_MATCH + COMPRESS_LAST_LITERALS) {
+        const unsigned char *mflimit = iend - COMPRESS_LAST_LITERALS -
+                                       COMPRESS_MIN_MATCH;
+
+        while (ip <= mflimit) {
+            uint32_t h = compress_hash(compress_read32(ip));
+            uint32_t cand = table[h];
+            table[h] = (uint32_t)(ip - src);
+
+            if (cand == UINT32_MAX ||
+                (size_t)(ip - src) - cand > 65535 ||
+                compress_read32(src + cand) != compress_read32(ip)) {
+                ip++;
+                continue;
+            }
+
+            /* Extend the match, leaving room for the tail literals */
+            const unsigned char *ref = src + cand;
+            const unsigned char *match_limit = iend - COMPRESS_LAST_LITERALS;
+            size_t match_len = COMPRESS_MIN_MATCH;
+            while (ip + match_len < match_limit &&
+                   ip[match_len] == ref[match_len]) {
+                match_len++;
+            }
+
+            op = compress_emit(op, oend, anchor, (size_t)(ip - anchor),
+                               (size_t)(ip - ref), match_len);
+            if (op == NULL) {
+                return 0;
+            }
+            ip += match_len;
+            anchor = ip;
+        }
+    }
+
+    /* Trailing literals */
+    op = compress_emit(op, oend, anchor, (size_t)(iend - anchor), 0, 0);
+    if (op == NULL || (size_t)(op - dst) >= src_size) {
+        return 0;  /* Did not shrink */
+    }
+    return (size_t)(op - dst);
+}
+
+size_t evocore_decompress_block(const unsigned char *src, size_t src_size,
+                              unsigned char *dst, size_t dst_cap) {
+    if (src == NULL || dst == NULL || src_size == 0) {
+        return 0;
+    }
+
+    const unsigned char *ip = src;
+    const unsigned char *iend = src + src_size;
+    unsigned char *op = dst;
+    unsigned char *oend = dst + dst_cap;
+
+    while (ip < iend) {
+        unsigned char token = *ip++;
+
+        /* Literal run */
+        size_t lit_len = token >> 4;
+        if (lit_len == 15) {
+            unsigned char b;
+            do {
+                if (ip >= iend) return 0;
+                b = *ip++;
+                lit_len += b;
+            } while (b == 255);
+        }
+        if ((size_t)(iend - ip) < lit_len || (size_t)(oend - op) < lit_len) {
+            return 0;
+        }
+        memcpy(op, ip, lit_len);
+        ip += lit_len;
+        op += lit_len;
+
+        if (ip >= iend) {
+            break;  /* Final sequence has no match */
+        }
+
+        /* Match */
+        if (iend - ip < 2) return 0;
+        size_t offset = (size_t)ip[0] | ((size_t)ip[1] << 8);
+        ip += 2;
+        if (offset == 0 || offset > (size_t)(op - dst)) {
+            return 0;
+        }
+
+        size_t match_len = (token & 0x0F) + COMPRESS_MIN_MATCH;
+        if ((token & 0x0F) == 15) {
+            unsigned char b;
+            do {
+                if (ip >= iend) return 0;
+                b = *ip++;
+                match_len += b;
+            } while (b == 255);
+        }
+        if ((size_t)(oend - op) < match_len) {
+            return 0;
+        }
+
+        /* Byte-wise copy: overlapping matches replicate the pattern */
+        const unsigned char *ref = op - offset;
+        for (size_t i = 0; i < match_len; i++) {
+            op[i] = ref[i];
+        }
+        op += match_len;
+    }
+
+    return (size_t)(op - dst);
+}
+
+/*========================================================================
+ * Frame Container
+ *========================================================================*/
+
+#define COMPRESS_FRAME_MAGIC 0x5A435645u  /* "EVCZ" */
+/* Block size-table entries: high bit marks a block stored raw */
+#define COMPRESS_BLOCK_RAW_FLAG 0x80000000u
+
+typedef struct __attribute__((packed)) {
+    uint32_t magic;
+    uint32_t block_size;
+    uint64_t raw_size;
+    uint32_t block_count;
+} compress_frame_header_t;
+
+bool evocore_compress_frame_detect(const void *buffer, size_t size) {
+    if (buffer == NULL || size < sizeof(compress_frame_header_t)) {
+        return false;
+    }
+    uint32_t magic;
+    memcpy(&magic, buffer, sizeof(magic));
+    return magic == COMPRESS_FRAME_MAGIC;
+}
+
+/* Validate an untrusted frame header before decoding. block_size must
+ * match the writer's constant (the read path's stack scratch is sized
+ * to it) and block_count must agree with raw_size, otherwise the
+ * per-block remaining-length math underflows and the decoder writes
+ * past the output buffer. */
+static bool frame_header_valid(const compress_frame_header_t *header) {
+    if (header->block_size != EVOCORE_COMPRESS_BLOCK_SIZE ||
+        header->raw_size == 0) {
+        return false;
+    }
+    uint64_t expect = (header->raw_size + header->block_size - 1) /
+                      header->block_size;
+    return (uint64_t)header->block_count == expect;
+}
+
+size_t evocore_compress_frame_raw_size(const void *frame, size_t frame_size) {
+    if (!evocore_compress_frame_detect(frame, frame_size)) {
+        return 0;
+    }
+    compress_frame_header_t header;
+    memcpy(&header, frame, sizeof(header));
+    if (!frame_header_valid(&header)) {
+        return 0;
+    }
+    return (size_t)header.raw_size;
+}
+
+evocore_error_t evocore_compress_frame(const void *src, size_t src_size,
+                                   void **out, size_t *out_size) {
+    if (src == NULL || out == NULL || out_size == NULL || src_size == 0) {
+        return EVOCORE_ERR_NULL_PTR;
+    }
+
+    const unsigned char *in = (const unsigned char*)src;
+    size_t block_count = (src_size + EVOCORE_COMPRESS_BLOCK_SIZE - 1) /
+                         EVOCORE_COMPRESS_BLOCK_SIZE;
+
+    size_t header_size = sizeof(compress_frame_header_t) +
+                         block_count * sizeof(uint32_t);
+    size_t worst = header_size +
+                   block_count * evocore_compress_bound(EVOCORE_COMPRESS_BLOCK_SIZE);
+    unsigned char *frame = (unsigned char*)evocore_malloc(worst);
+    if (frame == NULL) {
+        return EVOCORE_ERR_OUT_OF_MEMORY;
+    }
+
+    compress_frame_header_t header = {
+        .magic = COMPRESS_FRAME_MAGIC,
+        .block_size = EVOCORE_COMPRESS_BLOCK_SIZE,
+        .raw_size = src_size,
+        .block_count = (uint32_t)block_count
+    };
+    memcpy(frame, &header, sizeof(header));
+    uint32_t *table = (uint32_t*)(frame + sizeof(header));
+    unsigned char *op = frame + header_size;
+
+    for (size_t b = 0; b < block_count; b++) {
+        size_t offset = b * EVOCORE_COMPRESS_BLOCK_SIZE;
+        size_t raw_len = src_size - offset;
+        if (raw_len > EVOCORE_COMPRESS_BLOCK_SIZE) {
+            raw_len = EVOCORE_COMPRESS_BLOCK_SIZE;
+        }
+
+        size_t comp_len = evocore_compress_block(in + offset, raw_len, op,
+                                               evocore_compress_bound(raw_len));
+        if (comp_len > 0) {
+            table[b] = (uint32_t)comp_len;
+            op += comp_len;
+        } else {
+            /* Incompressible: store the block raw */
+            memcpy(op, in + offset, raw_len);
+            table[b] = (uint32_t)raw_len | COMPRESS_BLOCK_RAW_FLAG;
+            op += raw_len;
+        }
+    }
+
+    *out = frame;
+    *out_size = (size_t)(op - frame);
+    return EVOCORE_OK;
+}
+
+/* Locate block b; returns its data pointer and sizes, or false */
+static bool frame_block(const unsigned char *frame, size_t frame_size,
+                        const compress_frame_header_t *header, size_t index,
+                        const unsigned char **data, size_t *stored_len,
+                        bool *raw, size_t *raw_len) {
+    size_t header_size = sizeof(*header) +
+                         header->block_count * sizeof(uint32_t);
+    if (frame_size < header_size || index >= header->block_count) {
+        return false;
+    }
+
+    const uint32_t *table = (const uint32_t*)(frame + sizeof(*header));
+    size_t offset = header_size;
+    for (size_t b = 0; b < index; b++) {
+        offset += table[b] & ~COMPRESS_BLOCK_RAW_FLAG;
+    }
+
+    size_t len = table[index] & ~COMPRESS_BLOCK_RAW_FLAG;
+    if (offset + len > frame_size) {
+        return false;
+    }
+
+    *data = frame + offset;
+    *stored_len = len;
+    *raw = (table[index] & COMPRESS_BLOCK_RAW_FLAG) != 0;
+
+    size_t block_start = index * (size_t)header->block_size;
+    size_t remaining = (size_t)header->raw_size - block_start;
+    *raw_len = remaining < header->block_size ? remaining
+                                              : header->block_size;
+    return true;
+}
+
+evocore_error_t evocore_decompress_frame(const void *frame, size_t frame_size,
+                                     void **out, size_t *out_size) {
+    if (frame == NULL || out == NULL || out_size == NULL) {
+        return EVOCORE_ERR_NULL_PTR;
+    }
+    if (!evocore_compress_frame_detect(frame, frame_size)) {
+        return EVOCORE_ERR_INVALID_ARG;
+    }
+
+    compress_frame_header_t header;
+    memcpy(&header, frame, sizeof(header));
+    if (!frame_header_valid(&header)) {
+        return EVOCORE_ERR_FILE_READ;
+    }
+
+    unsigned char *raw = (unsigned char*)evocore_malloc(header.raw_size);
+    if (raw == NULL) {
+        return EVOCORE_ERR_OUT_OF_MEMORY;
+    }
+
+    const unsigned char *base = (const unsigned char*)frame;
+    for (size_t b = 0; b < header.block_count; b++) {
+        const unsigned char *data;
+        size_t stored_len, raw_len;
+        bool is_raw;
+        if (!frame_block(base, frame_size, &header, b, &data, &stored_len,
+                         &is_raw, &raw_len)) {
+            evocore_free(raw);
+            return EVOCORE_ERR_FILE_READ;
+        }
+
+        unsigned char *dst = raw + b * (size_t)header.block_size;
+        if (is_raw) {
+            if (stored_len != raw_len) {
+                evocore_free(raw);
+                return EVOCORE_ERR_FILE_READ;
+            }
+            memcpy(dst, data, raw_len);
+        } else if (evocore_decompress_block(data, stored_len, dst,
+                                            raw_len) != raw_len) {
+            evocore_free(raw);
+            return EVOCORE_ERR_FILE_READ;
+        }
+    }
+
+    *out = raw;
+    *out_size = (size_t)header.raw_size;
+    return EVOCORE_OK;
+}
+
+evocore_error_t evocore_compress_frame_read(const void *frame, size_t frame_size,
+                                        size_t offset, void *dst,
+                                        size_t length) {
+    if (frame == NULL || dst == NULL) {
+        return EVOCORE_ERR_NULL_PTR;
+    }
+    if (!evocore_compress_frame_detect(frame, frame_size)) {
+        return EVOCORE_ERR_INVALID_ARG;
+    }
+
+    compress_frame_header_t header;
+    memcpy(&header, frame, sizeof(header));
+    if (!frame_header_valid(&header)) {
+        return EVOCORE_ERR_FILE_READ;
+    }
+    if (offset + length > header.raw_size) {
+        return EVOCORE_ERR_INVALID_ARG;
+    }
+    if (length == 0) {
+        return EVOCORE_OK;
+    }
+
+    const unsigned char *base = (const unsigned char*)frame;
+    unsigned char *out = (unsigned char*)dst;
+    unsigned char block_buf[EVOCORE_COMPRESS_BLOCK_SIZE];
+
+    size_t first = offset / header.block_size;
+    size_t last = (offset + length - 1) / header.block_size;
+
+    for (size_t b = first; b <= last; b++) {
+        const unsigned char *data;
+        size_t stored_len, raw_len;
+        bool is_raw;
+        if (!frame_block(base, frame_size, &header, b, &data, &stored_len,
+                         &is_raw, &raw_len)) {
+            return EVOCORE_ERR_FILE_READ;
+        }
+
+        const unsigned char *block_bytes;
+        if (is_raw) {
+            if (stored_len != raw_len) {
+                return EVOCORE_ERR_FILE_READ;
+            }
+            block_bytes = data;
+        } else {
+            if (evocore_decompress_block(data, stored_len, block_buf,
+                                         raw_len) != raw_len) {
+                return EVOCORE_ERR_FILE_READ;
+            }
+            block_bytes = block_buf;
+        }
+
+        size_t block_start = b * (size_t)header.block_size;
+        size_t copy_from = offset > block_start ? offset - block_start : 0;
+        size_t copy_len = raw_len - copy_from;
+        size_t wanted = length - (size_t)(out - (unsigned char*)dst);
+        if (copy_len > wanted) {
+            copy_len = wanted;
+        }
+        memcpy(out, block_bytes + copy_from, copy_len);
+        out += copy_len;
+    }
+
+    return EVOCORE_OK;
+}
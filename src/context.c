@@ -7,6 +7,7 @@
 
 #define _GNU_SOURCE
 #include "evocore/context.h"
+#include "evocore/stats.h"
 #include "evocore/log.h"
 #include "internal.h"
 #include <stdlib.h>
@@ -15,6 +16,7 @@
 #include <stdio.h>
 #include <math.h>
 #include <pthread.h>
+#include <unistd.h>
 #include <arpa/inet.h>
 
 /*========================================================================
@@ -22,6 +24,7 @@
  *========================================================================*/
 
 #define INITIAL_HASH_CAPACITY 256
+#define STRIPE_INITIAL_CAPACITY 64  /* Per-stripe; stripes grow independently */
 #define HASH_LOAD_FACTOR 0.75
 #define MAX_KEY_LENGTH 256
 #define DEFAULT_MIN_SAMPLES 3
@@ -30,18 +33,28 @@
  * Internal Hash Table
  *========================================================================*/
 
-typedef struct hash_entry {
-    char *key;
-    evocore_context_stats_t *stats;
-    struct hash_entry *next;
+/*
+ * Flat open-addressing table with robin-hood probing.
+ *
+ * Slot metadata (hash, key pointer, stats pointer) is stored inline in
+ * one contiguous array, so hot lookups probe one or two cache lines
+ * instead of chasing per-entry heap nodes. Stats blocks stay heap
+ * allocated so evocore_context_stats_t pointers handed out through the
+ * API remain stable across amortized resizing.
+ */
+typedef struct {
     uint32_t hash;
-} hash_entry_t;
+    uint64_t packed;                 /* Packed interned key (packed mode) */
+    char *key;                       /* NULL == empty slot */
+    evocore_context_stats_t *stats;
+} hash_slot_t;
 
 typedef struct {
-    hash_entry_t **entries;
-    size_t capacity;
+    hash_slot_t *slots;
+    size_t capacity;                 /* Always a power of two */
     size_t count;
     size_t dimension_count;
+    bool string_mode;                /* Fallback when keys aren't packable */
 } hash_table_t;
 
 /* Hash function (FNV-1a) */
@@ -54,13 +67,47 @@ static uint32_t hash_string(const char *str) {
     return hash;
 }
 
+/*
+ * Packed keys: dimension values are interned into small integer IDs
+ * (their index in the dimension's registered value list), packed 8
+ * bits per dimension into a uint64_t, and hashed with one Fibonacci
+ * multiply. Lookups then compare one integer instead of strcmp'ing a
+ * formatted key. Systems that exceed the packing limits (more than
+ * EVOCORE_PACKED_KEY_DIMS dimensions or 256 values in one dimension)
+ * fall back to string keys transparently. The canonical string key is
+ * still built once per entry and kept for the key API, CSV/JSON
+ * export, and persistence.
+ */
+#define EVOCORE_PACKED_KEY_DIMS 8
+#define EVOCORE_PACKED_KEY_VALUES 256
+
+static uint32_t hash_packed(uint64_t packed) {
+    return (uint32_t)((packed * 0x9E3779B97F4A7C15ULL) >> 32);
+}
+
+/* Distance of the entry in slot `index` from its ideal slot */
+static size_t hash_probe_distance(const hash_table_t *table,
+                                  uint32_t hash, size_t index) {
+    size_t mask = table->capacity - 1;
+    return (index + table->capacity - (hash & mask)) & mask;
+}
+
+/* Round capacity up to a power of two */
+static size_t hash_round_capacity(size_t capacity) {
+    size_t cap = STRIPE_INITIAL_CAPACITY;
+    while (cap < capacity) cap *= 2;
+    return cap;
+}
+
 /* Create hash table */
 static hash_table_t* hash_create(size_t capacity, size_t dimension_count) {
     hash_table_t *table = calloc(1, sizeof(hash_table_t));
     if (!table) return NULL;
 
-    table->entries = calloc(capacity, sizeof(hash_entry_t*));
-    if (!table->entries) {
+    capacity = hash_round_capacity(capacity);
+
+    table->slots = calloc(capacity, sizeof(hash_slot_t));
+    if (!table->slots) {
         free(table);
         return NULL;
     }
@@ -76,131 +123,518 @@ static void hash_free(hash_table_t *table) {
     if (!table) return;
 
     for (size_t i = 0; i < table->capacity; i++) {
-        hash_entry_t *entry = table->entries[i];
-        while (entry) {
-            hash_entry_t *next = entry->next;
-            free(entry->key);
-            if (entry->stats) {
-                if (entry->stats->stats) {
-                    evocore_weighted_array_free(entry->stats->stats);
-                }
-                free(entry->stats);
+        hash_slot_t *slot = &table->slots[i];
+        if (!slot->key) continue;
+
+        free(slot->key);
+        if (slot->stats) {
+            if (slot->stats->stats) {
+                evocore_weighted_array_free(slot->stats->stats);
             }
-            free(entry);
-            entry = next;
+            free(slot->stats);
         }
     }
 
-    free(table->entries);
+    free(table->slots);
     free(table);
 }
 
-/* Get entry from hash table */
-static hash_entry_t* hash_get(hash_table_t *table, const char *key) {
-    uint32_t hash = hash_string(key);
-    size_t index = hash % table->capacity;
+/* Probe for a slot. In packed mode `key` may be NULL and entries
+ * compare by packed value; in string mode they compare by strcmp. */
+static hash_slot_t* hash_find(hash_table_t *table, uint32_t hash,
+                              uint64_t packed, const char *key) {
+    size_t mask = table->capacity - 1;
+    size_t index = hash & mask;
+
+    for (size_t dist = 0; ; dist++, index = (index + 1) & mask) {
+        hash_slot_t *slot = &table->slots[index];
+
+        if (!slot->key) return NULL;
 
-    hash_entry_t *entry = table->entries[index];
-    while (entry) {
-        if (entry->hash == hash && strcmp(entry->key, key) == 0) {
-            return entry;
+        /* Robin-hood invariant: once our distance exceeds the resident
+         * entry's, the key cannot be further along the probe chain */
+        if (dist > hash_probe_distance(table, slot->hash, index)) {
+            return NULL;
         }
-        entry = entry->next;
-    }
 
-    return NULL;
+        if (slot->hash != hash) continue;
+
+        if (table->string_mode) {
+            if (strcmp(slot->key, key) == 0) return slot;
+        } else {
+            if (slot->packed == packed) return slot;
+        }
+    }
 }
 
-/* Set entry in hash table */
-static hash_entry_t* hash_set(hash_table_t *table, const char *key, size_t param_count) {
-    uint32_t hash = hash_string(key);
-    size_t index = hash % table->capacity;
+/* Insert an occupied slot record using robin-hood displacement.
+ * The key must not already be present. */
+static hash_slot_t* hash_insert_slot(hash_table_t *table, hash_slot_t record) {
+    size_t mask = table->capacity - 1;
+    size_t index = record.hash & mask;
+    hash_slot_t *inserted = NULL;
+
+    for (size_t dist = 0; ; dist++, index = (index + 1) & mask) {
+        hash_slot_t *slot = &table->slots[index];
 
-    /* Check if exists */
-    hash_entry_t *entry = table->entries[index];
-    while (entry) {
-        if (entry->hash == hash && strcmp(entry->key, key) == 0) {
-            return entry;
+        if (!slot->key) {
+            *slot = record;
+            return inserted ? inserted : slot;
+        }
+
+        /* Steal from the rich: displace entries closer to home */
+        size_t slot_dist = hash_probe_distance(table, slot->hash, index);
+        if (slot_dist < dist) {
+            hash_slot_t tmp = *slot;
+            *slot = record;
+            record = tmp;
+            if (!inserted) inserted = slot;
+            dist = slot_dist;
         }
-        entry = entry->next;
     }
+}
 
-    /* Create new entry */
-    hash_entry_t *new_entry = calloc(1, sizeof(hash_entry_t));
-    if (!new_entry) return NULL;
+/* Get or create slot in hash table */
+static hash_slot_t* hash_set_hashed(hash_table_t *table, uint32_t hash,
+                                    uint64_t packed, const char *key,
+                                    size_t param_count) {
+    hash_slot_t *existing = hash_find(table, hash, packed, key);
+    if (existing) return existing;
 
-    new_entry->key = strdup(key);
-    if (!new_entry->key) {
-        free(new_entry);
-        return NULL;
-    }
+    hash_slot_t record;
+    record.hash = hash;
+    record.packed = packed;
+
+    record.key = strdup(key);
+    if (!record.key) return NULL;
 
-    new_entry->stats = calloc(1, sizeof(evocore_context_stats_t));
-    if (!new_entry->stats) {
-        free(new_entry->key);
-        free(new_entry);
+    record.stats = calloc(1, sizeof(evocore_context_stats_t));
+    if (!record.stats) {
+        free(record.key);
         return NULL;
     }
 
-    new_entry->stats->key = new_entry->key;
-    new_entry->stats->stats = evocore_weighted_array_create(param_count);
-    if (!new_entry->stats->stats) {
-        free(new_entry->stats->key);
-        free(new_entry->stats);
-        free(new_entry->key);
-        free(new_entry);
+    record.stats->key = record.key;
+    record.stats->stats = evocore_weighted_array_create(param_count);
+    if (!record.stats->stats) {
+        free(record.stats);
+        free(record.key);
         return NULL;
     }
 
-    new_entry->stats->param_count = param_count;
-    new_entry->hash = hash;
+    record.stats->param_count = param_count;
 
-    /* Insert at head */
-    new_entry->next = table->entries[index];
-    table->entries[index] = new_entry;
+    hash_slot_t *slot = hash_insert_slot(table, record);
     table->count++;
-
-    return new_entry;
+    return slot;
 }
 
 /* Resize hash table */
 static bool hash_resize(hash_table_t *table, size_t new_capacity) {
     if (new_capacity <= table->capacity) return false;
 
-    hash_table_t *new_table = hash_create(new_capacity, table->dimension_count);
-    if (!new_table) return false;
+    new_capacity = hash_round_capacity(new_capacity);
 
-    /* Rehash all entries */
-    for (size_t i = 0; i < table->capacity; i++) {
-        hash_entry_t *entry = table->entries[i];
-        while (entry) {
-            hash_entry_t *next = entry->next;
+    hash_slot_t *new_slots = calloc(new_capacity, sizeof(hash_slot_t));
+    if (!new_slots) return false;
 
-            /* Re-insert into new table */
-            uint32_t hash = entry->hash;
-            size_t index = hash % new_capacity;
+    hash_slot_t *old_slots = table->slots;
+    size_t old_capacity = table->capacity;
 
-            entry->next = new_table->entries[index];
-            new_table->entries[index] = entry;
-            new_table->count++;
+    table->slots = new_slots;
+    table->capacity = new_capacity;
 
-            entry = next;
+    /* Rehash all occupied slots */
+    for (size_t i = 0; i < old_capacity; i++) {
+        if (old_slots[i].key) {
+            hash_insert_slot(table, old_slots[i]);
         }
     }
 
-    /* Swap and free old */
-    hash_entry_t **old_entries = table->entries;
-    size_t old_capacity = table->capacity;
+    free(old_slots);
+    return true;
+}
+
+/*========================================================================
+ * Key Interning
+ *========================================================================*/
+
+/* Intern a dimension value to its index in the registered value list.
+ * With grow set, unseen values are appended to the dictionary. */
+static bool context_intern_value(evocore_context_dimension_t *dim,
+                                 const char *value, bool grow,
+                                 size_t *out_idx) {
+    for (size_t i = 0; i < dim->value_count; i++) {
+        if (strcmp(value, dim->values[i]) == 0) {
+            *out_idx = i;
+            return true;
+        }
+    }
+
+    if (!grow || dim->value_count >= EVOCORE_PACKED_KEY_VALUES) {
+        return false;
+    }
+
+    char **new_values = realloc(dim->values,
+                                (dim->value_count + 1) * sizeof(char*));
+    if (!new_values) return false;
+    dim->values = new_values;
+
+    dim->values[dim->value_count] = strdup(value);
+    if (!dim->values[dim->value_count]) return false;
 
-    table->entries = new_table->entries;
-    table->capacity = new_table->capacity;
+    *out_idx = dim->value_count++;
+    return true;
+}
+
+/* Pack dimension values into a single integer key. Fails when the
+ * system exceeds the packing limits or (without grow) a value is
+ * unknown - callers treat the latter as "no such context". */
+static bool context_pack_values(evocore_context_system_t *system,
+                                const char **dimension_values, bool grow,
+                                uint64_t *out_packed) {
+    if (system->dimension_count > EVOCORE_PACKED_KEY_DIMS) return false;
 
-    free(old_entries);
-    free(new_table);
+    uint64_t packed = 0;
+    for (size_t i = 0; i < system->dimension_count; i++) {
+        const char *value = dimension_values[i] ? dimension_values[i] : "";
+        size_t idx;
+        if (!context_intern_value(&system->dimensions[i], value, grow, &idx)) {
+            return false;
+        }
+        packed |= (uint64_t)idx << (8 * i);
+    }
 
+    *out_packed = packed;
     return true;
 }
 
+/* Pack a "v1:v2:..." string key by splitting and interning each part */
+static bool context_pack_key_string(evocore_context_system_t *system,
+                                    const char *key, bool grow,
+                                    uint64_t *out_packed) {
+    if (system->dimension_count > EVOCORE_PACKED_KEY_DIMS) return false;
+
+    char key_copy[MAX_KEY_LENGTH];
+    strncpy(key_copy, key, sizeof(key_copy) - 1);
+    key_copy[sizeof(key_copy) - 1] = '\0';
+
+    const char *parts[EVOCORE_PACKED_KEY_DIMS];
+    size_t part_count = 0;
+    char *cursor = key_copy;
+
+    parts[part_count++] = cursor;
+    while ((cursor = strchr(cursor, ':')) != NULL) {
+        if (part_count >= EVOCORE_PACKED_KEY_DIMS) return false;
+        *cursor++ = '\0';
+        parts[part_count++] = cursor;
+    }
+
+    if (part_count != system->dimension_count) return false;
+
+    return context_pack_values(system, parts, grow, out_packed);
+}
+
+/*========================================================================
+ * Sharded Store
+ * ========================================================================
+ *
+ * The hash table is sharded into independently rwlock'd stripes keyed
+ * by the top bits of the context hash, so concurrent learner threads
+ * only contend when they hit the same stripe and read-heavy sampling
+ * during genome generation takes shared locks that never block behind
+ * readers. The dimension dictionaries used for key interning have
+ * their own rwlock: interning an already-seen value (the common case)
+ * is a read; growing the dictionary is a short write.
+ */
+
+#define CONTEXT_STRIPES 16          /* Power of two */
+
+typedef struct {
+    hash_table_t *stripes[CONTEXT_STRIPES];
+    pthread_rwlock_t locks[CONTEXT_STRIPES];
+    pthread_rwlock_t dim_lock;      /* Guards dimension dictionaries */
+    bool string_mode;               /* Mirrored into every stripe table */
+
+    /* Optional write-ahead log */
+    FILE *wal;
+    pthread_mutex_t wal_lock;
+    size_t wal_pending;             /* Records since last group commit */
+    size_t wal_sync_interval;       /* 0 = manual sync only */
+} context_store_t;
+
+/* Stripe selection uses the top hash bits; slot probing uses the low
+ * bits, so the two stay decorrelated */
+static size_t stripe_of(uint32_t hash) {
+    return (hash >> 24) & (CONTEXT_STRIPES - 1);
+}
+
+static context_store_t* store_create(size_t dimension_count) {
+    context_store_t *store = calloc(1, sizeof(context_store_t));
+    if (!store) return NULL;
+
+    for (size_t i = 0; i < CONTEXT_STRIPES; i++) {
+        store->stripes[i] = hash_create(STRIPE_INITIAL_CAPACITY,
+                                        dimension_count);
+        if (!store->stripes[i]) {
+            for (size_t j = 0; j < i; j++) {
+                hash_free(store->stripes[j]);
+                pthread_rwlock_destroy(&store->locks[j]);
+            }
+            free(store);
+            return NULL;
+        }
+        pthread_rwlock_init(&store->locks[i], NULL);
+    }
+    pthread_rwlock_init(&store->dim_lock, NULL);
+    pthread_mutex_init(&store->wal_lock, NULL);
+
+    return store;
+}
+
+static void store_free(context_store_t *store) {
+    if (!store) return;
+
+    if (store->wal) {
+        fclose(store->wal);
+    }
+
+    for (size_t i = 0; i < CONTEXT_STRIPES; i++) {
+        hash_free(store->stripes[i]);
+        pthread_rwlock_destroy(&store->locks[i]);
+    }
+    pthread_rwlock_destroy(&store->dim_lock);
+    pthread_mutex_destroy(&store->wal_lock);
+    free(store);
+}
+
+/* Convert the whole store to string keys, redistributing every entry.
+ * One-way: once a system outgrows the packing limits it stays on
+ * string keys. Called with no stripe locks held. */
+static void store_to_string_mode(context_store_t *store) {
+    for (size_t i = 0; i < CONTEXT_STRIPES; i++) {
+        pthread_rwlock_wrlock(&store->locks[i]);
+    }
+
+    if (__atomic_load_n(&store->string_mode, __ATOMIC_RELAXED)) {
+        goto unlock;  /* Lost the race - someone else converted */
+    }
+
+    /* Collect every entry, rehash by string, and redistribute */
+    size_t total = 0;
+    for (size_t i = 0; i < CONTEXT_STRIPES; i++) {
+        total += store->stripes[i]->count;
+    }
+
+    hash_slot_t *records = total > 0 ? calloc(total, sizeof(hash_slot_t))
+                                     : NULL;
+    if (total > 0 && !records) {
+        goto unlock;  /* Keep packed mode; the caller's insert fails */
+    }
+
+    size_t n = 0;
+    for (size_t i = 0; i < CONTEXT_STRIPES; i++) {
+        hash_table_t *table = store->stripes[i];
+        for (size_t j = 0; j < table->capacity; j++) {
+            if (!table->slots[j].key) continue;
+            records[n] = table->slots[j];
+            records[n].hash = hash_string(records[n].key);
+            records[n].packed = 0;
+            n++;
+        }
+        memset(table->slots, 0, table->capacity * sizeof(hash_slot_t));
+        table->count = 0;
+        table->string_mode = true;
+    }
+
+    for (size_t i = 0; i < n; i++) {
+        hash_table_t *table = store->stripes[stripe_of(records[i].hash)];
+        if (table->count >= (size_t)(table->capacity * HASH_LOAD_FACTOR)) {
+            hash_resize(table, table->capacity * 2);
+        }
+        hash_insert_slot(table, records[i]);
+        table->count++;
+    }
+
+    free(records);
+    __atomic_store_n(&store->string_mode, true, __ATOMIC_RELEASE);
+    evocore_log_info("Context keys fell back to string mode");
+
+unlock:
+    for (size_t i = CONTEXT_STRIPES; i > 0; i--) {
+        pthread_rwlock_unlock(&store->locks[i - 1]);
+    }
+}
+
+/* Intern under the dimension lock: shared for the common already-seen
+ * case, exclusive only when the dictionary must grow.
+ * Returns 1 on success, 0 for an unknown value (without grow), and -1
+ * when the system exceeds the packing limits. */
+static int store_pack(evocore_context_system_t *system,
+                      context_store_t *store,
+                      const char **dimension_values, const char *strkey,
+                      bool grow, uint64_t *out_packed) {
+    bool ok;
+
+    pthread_rwlock_rdlock(&store->dim_lock);
+    if (system->dimension_count > EVOCORE_PACKED_KEY_DIMS) {
+        pthread_rwlock_unlock(&store->dim_lock);
+        return -1;
+    }
+    ok = dimension_values
+         ? context_pack_values(system, dimension_values, false, out_packed)
+         : context_pack_key_string(system, strkey, false, out_packed);
+    pthread_rwlock_unlock(&store->dim_lock);
+
+    if (ok || !grow) return ok ? 1 : 0;
+
+    pthread_rwlock_wrlock(&store->dim_lock);
+    ok = dimension_values
+         ? context_pack_values(system, dimension_values, true, out_packed)
+         : context_pack_key_string(system, strkey, true, out_packed);
+    pthread_rwlock_unlock(&store->dim_lock);
+
+    return ok ? 1 : -1;
+}
+
+/* Resolve a context to its entry with the stripe lock held.
+ *
+ * On success returns the entry and writes the stripe index; the caller
+ * must release store->locks[*out_stripe] when done with the entry.
+ * Returns NULL with no lock held when the entry is absent (and create
+ * is false) or creation failed. Retries when a concurrent string-mode
+ * conversion moves the entry between stripes.
+ */
+static hash_slot_t* store_acquire(evocore_context_system_t *system,
+                                  const char **dimension_values,
+                                  const char *strkey,
+                                  bool write, bool create,
+                                  size_t param_count,
+                                  size_t *out_stripe) {
+    context_store_t *store = (context_store_t*)system->internal;
+
+    for (;;) {
+        bool sm = __atomic_load_n(&store->string_mode, __ATOMIC_ACQUIRE);
+        uint32_t hash;
+        uint64_t packed = 0;
+        char key[MAX_KEY_LENGTH];
+        const char *lookup_key = strkey;
+
+        if (!sm) {
+            int rc = store_pack(system, store, dimension_values, strkey,
+                                create, &packed);
+            if (rc == 0) return NULL;       /* Unknown value: no entry */
+            if (rc < 0) {
+                if (!create) {
+                    /* Unpackable keys can only exist after conversion */
+                    if (!__atomic_load_n(&store->string_mode,
+                                         __ATOMIC_ACQUIRE)) {
+                        return NULL;
+                    }
+                    continue;
+                }
+                store_to_string_mode(store);
+                if (!__atomic_load_n(&store->string_mode,
+                                     __ATOMIC_ACQUIRE)) {
+                    return NULL;            /* Conversion failed */
+                }
+                continue;
+            }
+            hash = hash_packed(packed);
+        } else {
+            if (!lookup_key) {
+                if (!evocore_context_build_key(system, dimension_values,
+                                               key, sizeof(key))) {
+                    return NULL;
+                }
+                lookup_key = key;
+            }
+            hash = hash_string(lookup_key);
+        }
+
+        size_t stripe = stripe_of(hash);
+        if (write) pthread_rwlock_wrlock(&store->locks[stripe]);
+        else pthread_rwlock_rdlock(&store->locks[stripe]);
+
+        if (__atomic_load_n(&store->string_mode, __ATOMIC_ACQUIRE) != sm) {
+            pthread_rwlock_unlock(&store->locks[stripe]);
+            continue;  /* Mode flipped under us - recompute the route */
+        }
+
+        hash_table_t *table = store->stripes[stripe];
+        hash_slot_t *entry = hash_find(table, hash, packed,
+                                       sm ? lookup_key : NULL);
+
+        if (!entry && create) {
+            if (table->count >=
+                (size_t)(table->capacity * HASH_LOAD_FACTOR)) {
+                if (!hash_resize(table, table->capacity * 2)) {
+                    evocore_log_warn("Hash table resize failed, continuing "
+                                     "with current capacity");
+                }
+            }
+            if (!lookup_key) {
+                if (!evocore_context_build_key(system, dimension_values,
+                                               key, sizeof(key))) {
+                    pthread_rwlock_unlock(&store->locks[stripe]);
+                    return NULL;
+                }
+                lookup_key = key;
+            }
+            entry = hash_set_hashed(table, hash, packed, lookup_key,
+                                    param_count);
+        }
+
+        if (!entry) {
+            pthread_rwlock_unlock(&store->locks[stripe]);
+            return NULL;
+        }
+
+        *out_stripe = stripe;
+        return entry;
+    }
+}
+
+static void store_release(context_store_t *store, size_t stripe) {
+    pthread_rwlock_unlock(&store->locks[stripe]);
+}
+
+/*
+ * WAL record: uint32 key length, key bytes, fitness, then param_count
+ * doubles. param_count is fixed per system and lives in the file
+ * header, so records stay compact. Native byte order - the log is
+ * machine-local scratch that compaction deletes.
+ */
+#define WAL_MAGIC "EVWL"
+#define WAL_VERSION 1
+
+/* Append one learn record; called outside the stripe locks with the
+ * entry's heap-stable key string */
+static void wal_append(context_store_t *store, const char *key,
+                       const double *parameters, size_t param_count,
+                       double fitness) {
+    if (!store->wal) return;
+
+    uint32_t key_len = (uint32_t)strlen(key);
+
+    pthread_mutex_lock(&store->wal_lock);
+    if (store->wal) {
+        fwrite(&key_len, sizeof(uint32_t), 1, store->wal);
+        fwrite(key, 1, key_len, store->wal);
+        fwrite(&fitness, sizeof(double), 1, store->wal);
+        fwrite(parameters, sizeof(double), param_count, store->wal);
+
+        store->wal_pending++;
+        if (store->wal_sync_interval &&
+            store->wal_pending >= store->wal_sync_interval) {
+            fflush(store->wal);
+            fdatasync(fileno(store->wal));
+            store->wal_pending = 0;
+        }
+    }
+    pthread_mutex_unlock(&store->wal_lock);
+}
+
 /*========================================================================
  * Context System
  *========================================================================*/
@@ -276,8 +710,8 @@ evocore_context_system_t* evocore_context_system_create(
     system->dimension_count = dimension_count;
     system->param_count = param_count;
 
-    /* Create hash table */
-    system->internal = hash_create(INITIAL_HASH_CAPACITY, dimension_count);
+    /* Create sharded store */
+    system->internal = store_create(dimension_count);
     if (!system->internal) {
         /* Cleanup dimensions... */
         for (size_t i = 0; i < dimension_count; i++) {
@@ -312,9 +746,9 @@ void evocore_context_system_free(evocore_context_system_t *system) {
         free(system->dimensions);
     }
 
-    /* Free hash table */
+    /* Free sharded store */
     if (system->internal) {
-        hash_free(system->internal);
+        store_free(system->internal);
     }
 
     free(system);
@@ -328,12 +762,18 @@ bool evocore_context_add_dimension(
 ) {
     if (!system || !name || !values || value_count == 0) return false;
 
+    context_store_t *store = (context_store_t*)system->internal;
+    pthread_rwlock_wrlock(&store->dim_lock);
+
     /* Reallocate dimensions array */
     evocore_context_dimension_t *new_dims = realloc(
         system->dimensions,
         (system->dimension_count + 1) * sizeof(evocore_context_dimension_t)
     );
-    if (!new_dims) return false;
+    if (!new_dims) {
+        pthread_rwlock_unlock(&store->dim_lock);
+        return false;
+    }
 
     system->dimensions = new_dims;
 
@@ -349,6 +789,7 @@ bool evocore_context_add_dimension(
 
     system->dimension_count++;
 
+    pthread_rwlock_unlock(&store->dim_lock);
     return true;
 }
 
@@ -436,6 +877,12 @@ bool evocore_context_validate_values(
  * Learning Operations
  *========================================================================*/
 
+/* Fold one experience into an entry's statistics */
+static bool context_learn_entry(hash_slot_t *entry,
+                                const double *parameters,
+                                size_t param_count,
+                                double fitness);
+
 bool evocore_context_learn(
     evocore_context_system_t *system,
     const char **dimension_values,
@@ -446,13 +893,28 @@ bool evocore_context_learn(
     if (!system || !dimension_values || !parameters) return false;
     if (param_count != system->param_count) return false;
 
-    /* Build context key */
-    char key[MAX_KEY_LENGTH];
-    if (!evocore_context_build_key(system, dimension_values, key, sizeof(key))) {
-        return false;
+    EVOCORE_PHASE_BEGIN(phase_start);
+
+    /* Hot path: interned packed key, no string formatting or hashing.
+     * The stats update happens under the stripe's write lock so
+     * concurrent learners on the same context don't interleave. */
+    context_store_t *store = (context_store_t*)system->internal;
+    size_t stripe;
+    hash_slot_t *entry = store_acquire(system, dimension_values, NULL,
+                                       true, true, param_count, &stripe);
+    if (!entry) return false;
+
+    bool ok = context_learn_entry(entry, parameters, param_count, fitness);
+    const char *wal_key = entry->stats->key;  /* Heap-stable */
+    store_release(store, stripe);
+
+    if (ok) {
+        wal_append(store, wal_key, parameters, param_count, fitness);
     }
 
-    return evocore_context_learn_key(system, key, parameters, param_count, fitness);
+    EVOCORE_PHASE_END(phase_start, EVOCORE_PHASE_CONTEXT_LEARN);
+
+    return ok;
 }
 
 bool evocore_context_learn_key(
@@ -465,19 +927,32 @@ bool evocore_context_learn_key(
     if (!system || !context_key || !parameters) return false;
     if (param_count != system->param_count) return false;
 
-    hash_table_t *table = (hash_table_t*)system->internal;
+    EVOCORE_PHASE_BEGIN(phase_start);
 
-    /* Check for resize */
-    if (table->count >= (size_t)(table->capacity * HASH_LOAD_FACTOR)) {
-        if (!hash_resize(table, table->capacity * 2)) {
-            evocore_log_warn("Hash table resize failed, continuing with current capacity");
-        }
+    /* Get or create entry; stats update stays under the stripe lock */
+    context_store_t *store = (context_store_t*)system->internal;
+    size_t stripe;
+    hash_slot_t *entry = store_acquire(system, NULL, context_key,
+                                       true, true, param_count, &stripe);
+    if (!entry) return false;
+
+    bool ok = context_learn_entry(entry, parameters, param_count, fitness);
+    const char *wal_key = entry->stats->key;  /* Heap-stable */
+    store_release(store, stripe);
+
+    if (ok) {
+        wal_append(store, wal_key, parameters, param_count, fitness);
     }
 
-    /* Get or create entry */
-    hash_entry_t *entry = hash_set(table, context_key, param_count);
-    if (!entry) return false;
+    EVOCORE_PHASE_END(phase_start, EVOCORE_PHASE_CONTEXT_LEARN);
+
+    return ok;
+}
 
+static bool context_learn_entry(hash_slot_t *entry,
+                                const double *parameters,
+                                size_t param_count,
+                                double fitness) {
     evocore_context_stats_t *stats = entry->stats;
 
     /* Update weighted statistics */
@@ -500,10 +975,9 @@ bool evocore_context_learn_key(
     }
 
     /* Update confidence */
-    stats->confidence = evocore_weighted_confidence(
-        &stats->stats->stats[0],
-        100
-    );
+    evocore_weighted_stats_t first;
+    evocore_weighted_array_get(stats->stats, 0, &first);
+    stats->confidence = evocore_weighted_confidence(&first, 100);
 
     return true;
 }
@@ -519,12 +993,20 @@ bool evocore_context_get_stats(
 ) {
     if (!system || !dimension_values || !out_stats) return false;
 
-    char key[MAX_KEY_LENGTH];
-    if (!evocore_context_build_key(system, dimension_values, key, sizeof(key))) {
-        return false;
+    /* Shared lock: concurrent readers never block each other. The
+     * stats block is heap-stable, so handing the pointer out past the
+     * lock is safe; the values may keep moving under later learns. */
+    size_t stripe;
+    hash_slot_t *entry = store_acquire(system, dimension_values, NULL,
+                                       false, false, 0, &stripe);
+    if (entry) {
+        *out_stats = entry->stats;
+        store_release((context_store_t*)system->internal, stripe);
+        return true;
     }
 
-    return evocore_context_get_stats_key(system, key, out_stats);
+    *out_stats = NULL;
+    return false;
 }
 
 bool evocore_context_get_stats_key(
@@ -534,11 +1016,13 @@ bool evocore_context_get_stats_key(
 ) {
     if (!system || !context_key || !out_stats) return false;
 
-    hash_table_t *table = (hash_table_t*)system->internal;
-    hash_entry_t *entry = hash_get(table, context_key);
-
+    size_t stripe;
+    hash_slot_t *entry = store_acquire((evocore_context_system_t*)system,
+                                       NULL, context_key,
+                                       false, false, 0, &stripe);
     if (entry) {
         *out_stats = entry->stats;
+        store_release((context_store_t*)system->internal, stripe);
         return true;
     }
 
@@ -571,12 +1055,30 @@ bool evocore_context_sample(
     if (!system || !dimension_values || !out_parameters) return false;
     if (param_count != system->param_count) return false;
 
-    char key[MAX_KEY_LENGTH];
-    if (!evocore_context_build_key(system, dimension_values, key, sizeof(key))) {
-        return false;
+    /* Shared lock: the hot sampling path during genome generation
+     * never blocks behind other samplers, only behind a writer that
+     * happens to hit the same stripe. */
+    size_t stripe;
+    hash_slot_t *entry = store_acquire((evocore_context_system_t*)system,
+                                       dimension_values, NULL,
+                                       false, false, 0, &stripe);
+    if (!entry) {
+        /* No context data, return random */
+        for (size_t i = 0; i < param_count; i++) {
+            out_parameters[i] = (double)rand_r(seed) / (double)RAND_MAX;
+        }
+        return true;
     }
 
-    return evocore_context_sample_key(system, key, out_parameters, param_count, exploration_factor, seed);
+    bool ok = evocore_weighted_array_sample(
+        entry->stats->stats,
+        out_parameters,
+        param_count,
+        exploration_factor,
+        seed
+    );
+    store_release((context_store_t*)system->internal, stripe);
+    return ok;
 }
 
 bool evocore_context_sample_key(
@@ -590,9 +1092,10 @@ bool evocore_context_sample_key(
     if (!system || !context_key || !out_parameters) return false;
     if (param_count != system->param_count) return false;
 
-    hash_table_t *table = (hash_table_t*)system->internal;
-    hash_entry_t *entry = hash_get(table, context_key);
-
+    size_t stripe;
+    hash_slot_t *entry = store_acquire((evocore_context_system_t*)system,
+                                       NULL, context_key,
+                                       false, false, 0, &stripe);
     if (!entry) {
         /* No context data, return random */
         for (size_t i = 0; i < param_count; i++) {
@@ -602,13 +1105,15 @@ bool evocore_context_sample_key(
     }
 
     /* Sample from learned distribution */
-    return evocore_weighted_array_sample(
+    bool ok = evocore_weighted_array_sample(
         entry->stats->stats,
         out_parameters,
         param_count,
         exploration_factor,
         seed
     );
+    store_release((context_store_t*)system->internal, stripe);
+    return ok;
 }
 
 /*========================================================================
@@ -639,14 +1144,17 @@ bool evocore_context_query_best(
     evocore_context_stats_t **contexts = calloc(max_results, sizeof(evocore_context_stats_t*));
     if (!contexts) return false;
 
-    hash_table_t *table = (hash_table_t*)system->internal;
+    context_store_t *store = (context_store_t*)system->internal;
     size_t count = 0;
 
-    /* Scan all contexts */
-    for (size_t i = 0; i < table->capacity && count < max_results; i++) {
-        hash_entry_t *entry = table->entries[i];
-        while (entry && count < max_results) {
-            evocore_context_stats_t *stats = entry->stats;
+    /* Scan all contexts, one stripe at a time */
+    for (size_t s = 0; s < CONTEXT_STRIPES && count < max_results; s++) {
+        pthread_rwlock_rdlock(&store->locks[s]);
+        hash_table_t *table = store->stripes[s];
+
+        for (size_t i = 0; i < table->capacity && count < max_results; i++) {
+            if (!table->slots[i].key) continue;
+            evocore_context_stats_t *stats = table->slots[i].stats;
 
             /* Check filters */
             bool matches = true;
@@ -664,9 +1172,9 @@ bool evocore_context_query_best(
             if (matches) {
                 contexts[count++] = stats;
             }
-
-            entry = entry->next;
         }
+
+        pthread_rwlock_unlock(&store->locks[s]);
     }
 
     /* Sort by fitness */
@@ -689,8 +1197,15 @@ void evocore_context_query_free(evocore_context_query_t *results) {
 
 size_t evocore_context_count(const evocore_context_system_t *system) {
     if (!system) return 0;
-    hash_table_t *table = (hash_table_t*)system->internal;
-    return table->count;
+    context_store_t *store = (context_store_t*)system->internal;
+
+    size_t total = 0;
+    for (size_t s = 0; s < CONTEXT_STRIPES; s++) {
+        pthread_rwlock_rdlock(&store->locks[s]);
+        total += store->stripes[s]->count;
+        pthread_rwlock_unlock(&store->locks[s]);
+    }
+    return total;
 }
 
 size_t evocore_context_get_param_count(const evocore_context_system_t *system) {
@@ -705,16 +1220,20 @@ size_t evocore_context_get_keys(
 ) {
     if (!system || !out_keys) return 0;
 
-    hash_table_t *table = (hash_table_t*)system->internal;
+    context_store_t *store = (context_store_t*)system->internal;
     size_t count = 0;
 
-    for (size_t i = 0; i < table->capacity && count < max_keys; i++) {
-        hash_entry_t *entry = table->entries[i];
-        while (entry && count < max_keys) {
-            out_keys[count] = strdup(entry->key);
+    for (size_t s = 0; s < CONTEXT_STRIPES && count < max_keys; s++) {
+        pthread_rwlock_rdlock(&store->locks[s]);
+        hash_table_t *table = store->stripes[s];
+
+        for (size_t i = 0; i < table->capacity && count < max_keys; i++) {
+            if (!table->slots[i].key) continue;
+            out_keys[count] = strdup(table->slots[i].key);
             count++;
-            entry = entry->next;
         }
+
+        pthread_rwlock_unlock(&store->locks[s]);
     }
 
     return count;
@@ -733,6 +1252,9 @@ bool evocore_context_save_json(
     FILE *f = fopen(filepath, "w");
     if (!f) return false;
 
+    /* Big stdio buffer: large stores write millions of short pieces */
+    setvbuf(f, NULL, _IOFBF, 1 << 20);
+
     fprintf(f, "{\n");
     fprintf(f, "  \"dimensions\": [\n");
 
@@ -752,42 +1274,74 @@ bool evocore_context_save_json(
     fprintf(f, "  \"param_count\": %zu,\n", system->param_count);
     fprintf(f, "  \"contexts\": {\n");
 
-    hash_table_t *table = (hash_table_t*)system->internal;
+    context_store_t *store = (context_store_t*)system->internal;
     size_t context_idx = 0;
+    size_t total = evocore_context_count(system);
+
+    for (size_t s = 0; s < CONTEXT_STRIPES; s++) {
+        pthread_rwlock_rdlock(&store->locks[s]);
+        hash_table_t *table = store->stripes[s];
+
+        for (size_t i = 0; i < table->capacity; i++) {
+            if (!table->slots[i].key) continue;
+            evocore_context_stats_t *stats = table->slots[i].stats;
+
+            /* Batch each entry into one chunk: snprintf/fprintf per
+             * value dominates save time on multi-million-key stores */
+            char chunk[4096];
+            size_t clen = 0;
+
+            clen += (size_t)snprintf(chunk + clen, sizeof(chunk) - clen,
+                "    \"%s\": {\n"
+                "      \"param_count\": %zu,\n"
+                "      \"total_experiences\": %zu,\n"
+                "      \"confidence\": ",
+                stats->key, stats->param_count, stats->total_experiences);
+#define CHUNK_LIT(lit) \
+    do { memcpy(chunk + clen, lit, sizeof(lit) - 1); clen += sizeof(lit) - 1; } while (0)
+            clen += evocore_format_double(chunk + clen, stats->confidence);
+            CHUNK_LIT(",\n      \"avg_fitness\": ");
+            clen += evocore_format_double(chunk + clen, stats->avg_fitness);
+            CHUNK_LIT(",\n      \"best_fitness\": ");
+            clen += evocore_format_double(chunk + clen, stats->best_fitness);
+            CHUNK_LIT(",\n      \"means\": [");
+            fwrite(chunk, 1, clen, f);
+            clen = 0;
 
-    for (size_t i = 0; i < table->capacity; i++) {
-        hash_entry_t *entry = table->entries[i];
-        while (entry) {
-            evocore_context_stats_t *stats = entry->stats;
-
-            fprintf(f, "    \"%s\": {\n", stats->key);
-            fprintf(f, "      \"param_count\": %zu,\n", stats->param_count);
-            fprintf(f, "      \"total_experiences\": %zu,\n", stats->total_experiences);
-            fprintf(f, "      \"confidence\": %.6g,\n", stats->confidence);
-            fprintf(f, "      \"avg_fitness\": %.6g,\n", stats->avg_fitness);
-            fprintf(f, "      \"best_fitness\": %.6g,\n", stats->best_fitness);
-
-            /* Write means */
-            fprintf(f, "      \"means\": [");
             for (size_t j = 0; j < stats->param_count; j++) {
-                double mean = evocore_weighted_mean(&stats->stats->stats[j]);
-                fprintf(f, "%.6g%s", mean, j + 1 < stats->param_count ? ", " : "");
+                if (clen > sizeof(chunk) - 40) {
+                    fwrite(chunk, 1, clen, f);
+                    clen = 0;
+                }
+                clen += evocore_format_double(chunk + clen,
+                    evocore_weighted_array_mean(stats->stats, j));
+                if (j + 1 < stats->param_count) {
+                    chunk[clen++] = ',';
+                    chunk[clen++] = ' ';
+                }
             }
-            fprintf(f, "],\n");
+            CHUNK_LIT("],\n      \"stds\": [");
 
-            /* Write stds */
-            fprintf(f, "      \"stds\": [");
             for (size_t j = 0; j < stats->param_count; j++) {
-                double std = evocore_weighted_std(&stats->stats->stats[j]);
-                fprintf(f, "%.6g%s", std, j + 1 < stats->param_count ? ", " : "");
+                if (clen > sizeof(chunk) - 40) {
+                    fwrite(chunk, 1, clen, f);
+                    clen = 0;
+                }
+                clen += evocore_format_double(chunk + clen,
+                    evocore_weighted_array_std(stats->stats, j));
+                if (j + 1 < stats->param_count) {
+                    chunk[clen++] = ',';
+                    chunk[clen++] = ' ';
+                }
             }
-            fprintf(f, "]\n");
-
-            fprintf(f, "    }%s\n", context_idx + 1 < table->count ? "," : "");
+            clen += (size_t)snprintf(chunk + clen, sizeof(chunk) - clen,
+                "]\n    }%s\n", context_idx + 1 < total ? "," : "");
+            fwrite(chunk, 1, clen, f);
             context_idx++;
-
-            entry = entry->next;
+#undef CHUNK_LIT
         }
+
+        pthread_rwlock_unlock(&store->locks[s]);
     }
 
     fprintf(f, "  }\n");
@@ -797,13 +1351,266 @@ bool evocore_context_save_json(
     return true;
 }
 
+/* Parse one "key": { ... } entry and insert it into the store. The
+ * arena is rewound by the caller after each entry, so peak parser
+ * memory stays at one entry regardless of file size. */
+static bool load_json_entry(evocore_json_reader_t *reader,
+                            evocore_context_system_t *system,
+                            evocore_arena_t *arena) {
+    char *key = evocore_json_read_string(reader);
+    if (!key || !evocore_json_expect(reader, ':')) return false;
+    if (!evocore_json_expect(reader, '{')) return false;
+
+    double param_count_val = 0;
+    double experiences = 0;
+    double confidence = 0;
+    double avg_fitness = 0;
+    double best_fitness = 0;
+    double *means = NULL;
+    double *stds = NULL;
+    size_t means_count = 0;
+    size_t stds_count = 0;
+
+    if (!evocore_json_try(reader, '}')) {
+        for (;;) {
+            char *field = evocore_json_read_string(reader);
+            if (!field || !evocore_json_expect(reader, ':')) return false;
+
+            if (strcmp(field, "param_count") == 0) {
+                if (!evocore_json_read_number(reader, &param_count_val)) return false;
+            } else if (strcmp(field, "total_experiences") == 0) {
+                if (!evocore_json_read_number(reader, &experiences)) return false;
+            } else if (strcmp(field, "confidence") == 0) {
+                if (!evocore_json_read_number(reader, &confidence)) return false;
+            } else if (strcmp(field, "avg_fitness") == 0) {
+                if (!evocore_json_read_number(reader, &avg_fitness)) return false;
+            } else if (strcmp(field, "best_fitness") == 0) {
+                if (!evocore_json_read_number(reader, &best_fitness)) return false;
+            } else if (strcmp(field, "means") == 0 ||
+                       strcmp(field, "stds") == 0) {
+                bool is_means = field[0] == 'm';
+                double *values =
+                    evocore_arena_alloc(arena,
+                                        system->param_count * sizeof(double));
+                if (!values) return false;
+                size_t count = 0;
+
+                if (!evocore_json_expect(reader, '[')) return false;
+                if (!evocore_json_try(reader, ']')) {
+                    for (;;) {
+                        double v;
+                        if (!evocore_json_read_number(reader, &v)) return false;
+                        if (count >= system->param_count) return false;
+                        values[count++] = v;
+                        if (evocore_json_try(reader, ']')) break;
+                        if (!evocore_json_expect(reader, ',')) return false;
+                    }
+                }
+                if (is_means) {
+                    means = values;
+                    means_count = count;
+                } else {
+                    stds = values;
+                    stds_count = count;
+                }
+            } else {
+                if (!evocore_json_skip_value(reader)) return false;
+            }
+
+            if (evocore_json_try(reader, '}')) break;
+            if (!evocore_json_expect(reader, ',')) return false;
+        }
+    }
+
+    size_t param_count = (size_t)param_count_val;
+    if (param_count == 0 || param_count != system->param_count) return false;
+    if (means_count != param_count || stds_count != param_count) return false;
+
+    /* Insert; the system isn't published yet so the stripe lock can be
+     * dropped before filling in the stats */
+    size_t stripe;
+    hash_slot_t *entry = store_acquire(system, NULL, key,
+                                       true, true, param_count, &stripe);
+    if (!entry) return false;
+    store_release((context_store_t*)system->internal, stripe);
+
+    evocore_context_stats_t *stats = entry->stats;
+    stats->total_experiences = (size_t)experiences;
+    stats->confidence = confidence;
+    stats->avg_fitness = avg_fitness;
+    stats->best_fitness = best_fitness;
+
+    /* JSON persists means and stds only; reconstruct the weighted
+     * accumulators treating every past experience as weight 1, which
+     * preserves the distribution the store will keep learning from */
+    if (stats->stats && stats->stats->mean) {
+        double weight = experiences > 0 ? experiences : 1;
+        for (size_t j = 0; j < param_count; j++) {
+            evocore_weighted_stats_t ws;
+            memset(&ws, 0, sizeof(ws));
+            ws.mean = means[j];
+            ws.variance = stds[j] * stds[j];
+            ws.sum_weights = weight;
+            ws.m2 = ws.variance * weight;
+            ws.count = (size_t)experiences;
+            ws.min_value = means[j];
+            ws.max_value = means[j];
+            ws.sum_weighted_x = means[j] * weight;
+            evocore_weighted_array_set(stats->stats, j, &ws);
+        }
+    }
+
+    return true;
+}
+
 bool evocore_context_load_json(
     const char *filepath,
     evocore_context_system_t **out_system
 ) {
-    /* TODO: Implement JSON loading */
-    (void)filepath;
-    (void)out_system;
+    if (!filepath || !out_system) return false;
+
+    FILE *f = fopen(filepath, "rb");
+    if (!f) return false;
+
+    /* Streaming parse: fixed chunk reads plus a per-entry arena keep
+     * peak memory bounded instead of doubling RSS on multi-GB files,
+     * and the table is warm as soon as its entries go by */
+    evocore_arena_t arena;
+    if (evocore_arena_init(&arena, 1 << 20) != EVOCORE_OK) {
+        fclose(f);
+        return false;
+    }
+
+    evocore_json_reader_t reader;
+    if (!evocore_json_reader_init(&reader, f, &arena, 1 << 18)) {
+        evocore_arena_cleanup(&arena);
+        fclose(f);
+        return false;
+    }
+
+    evocore_context_system_t *system =
+        evocore_calloc(1, sizeof(evocore_context_system_t));
+    if (!system) goto error;
+
+    if (!evocore_json_expect(&reader, '{')) goto error;
+    if (!evocore_json_try(&reader, '}')) {
+        for (;;) {
+            size_t mark = evocore_arena_snapshot(&arena);
+            char *section = evocore_json_read_string(&reader);
+            if (!section || !evocore_json_expect(&reader, ':')) goto error;
+
+            if (strcmp(section, "dimensions") == 0) {
+                if (!evocore_json_expect(&reader, '[')) goto error;
+                if (!evocore_json_try(&reader, ']')) {
+                    for (;;) {
+                        /* Grow the dimension array; files carry few
+                         * dimensions so realloc-per-entry is fine */
+                        evocore_context_dimension_t *grown = evocore_realloc(
+                            system->dimensions,
+                            (system->dimension_count + 1) *
+                                sizeof(evocore_context_dimension_t));
+                        if (!grown) goto error;
+                        system->dimensions = grown;
+                        evocore_context_dimension_t *dim =
+                            &system->dimensions[system->dimension_count];
+                        memset(dim, 0, sizeof(*dim));
+                        system->dimension_count++;
+
+                        if (!evocore_json_expect(&reader, '{')) goto error;
+                        for (;;) {
+                            char *field = evocore_json_read_string(&reader);
+                            if (!field ||
+                                !evocore_json_expect(&reader, ':')) goto error;
+
+                            if (strcmp(field, "name") == 0) {
+                                char *name = evocore_json_read_string(&reader);
+                                if (!name) goto error;
+                                dim->name = evocore_strdup(name);
+                                if (!dim->name) goto error;
+                            } else if (strcmp(field, "values") == 0) {
+                                if (!evocore_json_expect(&reader, '[')) goto error;
+                                if (!evocore_json_try(&reader, ']')) {
+                                    for (;;) {
+                                        char *value =
+                                            evocore_json_read_string(&reader);
+                                        if (!value) goto error;
+                                        char **vgrown = evocore_realloc(
+                                            dim->values,
+                                            (dim->value_count + 1) *
+                                                sizeof(char*));
+                                        if (!vgrown) goto error;
+                                        dim->values = vgrown;
+                                        dim->values[dim->value_count] =
+                                            evocore_strdup(value);
+                                        if (!dim->values[dim->value_count]) goto error;
+                                        dim->value_count++;
+                                        if (evocore_json_try(&reader, ']')) break;
+                                        if (!evocore_json_expect(&reader, ',')) goto error;
+                                    }
+                                }
+                            } else {
+                                if (!evocore_json_skip_value(&reader)) goto error;
+                            }
+                            if (evocore_json_try(&reader, '}')) break;
+                            if (!evocore_json_expect(&reader, ',')) goto error;
+                        }
+                        if (evocore_json_try(&reader, ']')) break;
+                        if (!evocore_json_expect(&reader, ',')) goto error;
+                    }
+                }
+            } else if (strcmp(section, "param_count") == 0) {
+                double v;
+                if (!evocore_json_read_number(&reader, &v)) goto error;
+                system->param_count = (size_t)v;
+            } else if (strcmp(section, "contexts") == 0) {
+                /* The saver writes dimensions and param_count first */
+                if (system->param_count == 0) goto error;
+                if (!system->internal) {
+                    context_store_t *store =
+                        store_create(system->dimension_count);
+                    if (!store) goto error;
+                    system->internal = store;
+                }
+
+                if (!evocore_json_expect(&reader, '{')) goto error;
+                if (!evocore_json_try(&reader, '}')) {
+                    for (;;) {
+                        size_t entry_mark = evocore_arena_snapshot(&arena);
+                        if (!load_json_entry(&reader, system, &arena)) goto error;
+                        evocore_arena_rewind(&arena, entry_mark);
+                        system->total_contexts++;
+                        if (evocore_json_try(&reader, '}')) break;
+                        if (!evocore_json_expect(&reader, ',')) goto error;
+                    }
+                }
+            } else {
+                if (!evocore_json_skip_value(&reader)) goto error;
+            }
+
+            evocore_arena_rewind(&arena, mark);
+            if (evocore_json_try(&reader, '}')) break;
+            if (!evocore_json_expect(&reader, ',')) goto error;
+        }
+    }
+
+    if (!system->internal) {
+        /* Empty store is still a valid system */
+        context_store_t *store = store_create(system->dimension_count);
+        if (!store) goto error;
+        system->internal = store;
+    }
+
+    evocore_json_reader_cleanup(&reader);
+    evocore_arena_cleanup(&arena);
+    fclose(f);
+    *out_system = system;
+    return true;
+
+error:
+    if (system) evocore_context_system_free(system);
+    evocore_json_reader_cleanup(&reader);
+    evocore_arena_cleanup(&arena);
+    fclose(f);
     return false;
 }
 
@@ -893,6 +1700,40 @@ static bool read_uint64(FILE *f, uint64_t *out_val) {
     return true;
 }
 
+/* Helper: Write one context's record (called with its stripe rdlock held) */
+static bool write_context_entry(FILE *f, const evocore_context_stats_t *stats) {
+    if (!write_string(f, stats->key)) return false;
+    if (!write_uint32(f, (uint32_t)stats->param_count)) return false;
+    if (!write_uint32(f, (uint32_t)stats->total_experiences)) return false;
+    if (!write_double(f, stats->confidence)) return false;
+    if (!write_double(f, stats->avg_fitness)) return false;
+    if (!write_double(f, stats->best_fitness)) return false;
+    if (!write_uint64(f, (uint64_t)stats->first_update)) return false;
+    if (!write_uint64(f, (uint64_t)stats->last_update)) return false;
+
+    /* Write weighted statistics for each parameter */
+    if (stats->stats && stats->stats->mean) {
+        for (size_t j = 0; j < stats->param_count; j++) {
+            evocore_weighted_stats_t ws;
+            evocore_weighted_array_get(stats->stats, j, &ws);
+            if (!write_double(f, ws.mean)) return false;
+            if (!write_double(f, ws.variance)) return false;
+            if (!write_double(f, ws.sum_weights)) return false;
+            if (!write_uint32(f, (uint32_t)ws.count)) return false;
+        }
+    } else {
+        /* Write zeros for missing stats */
+        for (size_t j = 0; j < stats->param_count; j++) {
+            if (!write_double(f, 0.0)) return false;
+            if (!write_double(f, 0.0)) return false;
+            if (!write_double(f, 0.0)) return false;
+            if (!write_uint32(f, 0)) return false;
+        }
+    }
+
+    return true;
+}
+
 bool evocore_context_save_binary(
     const evocore_context_system_t *system,
     const char *filepath
@@ -902,8 +1743,8 @@ bool evocore_context_save_binary(
     FILE *f = fopen(filepath, "wb");
     if (!f) return false;
 
-    hash_table_t *table = (hash_table_t*)system->internal;
-    if (!table) {
+    context_store_t *store = (context_store_t*)system->internal;
+    if (!store) {
         fclose(f);
         return false;
     }
@@ -925,53 +1766,23 @@ bool evocore_context_save_binary(
     }
 
     /* Write contexts */
-    uint32_t total_contexts = 0;
-    for (size_t i = 0; i < table->capacity; i++) {
-        hash_entry_t *entry = table->entries[i];
-        while (entry) {
-            total_contexts++;
-            entry = entry->next;
-        }
-    }
+    uint32_t total_contexts = (uint32_t)evocore_context_count(system);
 
     if (!write_uint32(f, total_contexts)) goto error;
 
-    /* Write each context */
-    for (size_t i = 0; i < table->capacity; i++) {
-        hash_entry_t *entry = table->entries[i];
-        while (entry) {
-            evocore_context_stats_t *stats = entry->stats;
-
-            if (!write_string(f, stats->key)) goto error;
-            if (!write_uint32(f, (uint32_t)stats->param_count)) goto error;
-            if (!write_uint32(f, (uint32_t)stats->total_experiences)) goto error;
-            if (!write_double(f, stats->confidence)) goto error;
-            if (!write_double(f, stats->avg_fitness)) goto error;
-            if (!write_double(f, stats->best_fitness)) goto error;
-            if (!write_uint64(f, (uint64_t)stats->first_update)) goto error;
-            if (!write_uint64(f, (uint64_t)stats->last_update)) goto error;
-
-            /* Write weighted statistics for each parameter */
-            if (stats->stats && stats->stats->stats) {
-                for (size_t j = 0; j < stats->param_count; j++) {
-                    evocore_weighted_stats_t *ws = &stats->stats->stats[j];
-                    if (!write_double(f, ws->mean)) goto error;
-                    if (!write_double(f, ws->variance)) goto error;
-                    if (!write_double(f, ws->sum_weights)) goto error;
-                    if (!write_uint32(f, (uint32_t)ws->count)) goto error;
-                }
-            } else {
-                /* Write zeros for missing stats */
-                for (size_t j = 0; j < stats->param_count; j++) {
-                    if (!write_double(f, 0.0)) goto error;
-                    if (!write_double(f, 0.0)) goto error;
-                    if (!write_double(f, 0.0)) goto error;
-                    if (!write_uint32(f, 0)) goto error;
-                }
-            }
+    /* Write each context, stripe by stripe */
+    for (size_t s = 0; s < CONTEXT_STRIPES; s++) {
+        pthread_rwlock_rdlock(&store->locks[s]);
+        hash_table_t *table = store->stripes[s];
+        bool ok = true;
 
-            entry = entry->next;
+        for (size_t i = 0; i < table->capacity && ok; i++) {
+            if (!table->slots[i].key) continue;
+            ok = write_context_entry(f, table->slots[i].stats);
         }
+
+        pthread_rwlock_unlock(&store->locks[s]);
+        if (!ok) goto error;
     }
 
     fclose(f);
@@ -1049,25 +1860,19 @@ bool evocore_context_load_binary(
         }
     }
 
-    /* Create hash table - use next power of 2 from expected count */
     uint32_t context_count;
     if (!read_uint32(f, &context_count)) {
         evocore_context_system_free(system);
         goto error;
     }
 
-    /* Calculate appropriate capacity (power of 2, at least 256) */
-    size_t capacity = INITIAL_HASH_CAPACITY;
-    while (capacity < context_count * 2) {
-        capacity *= 2;
-    }
-
-    hash_table_t *table = hash_create(capacity, dim_count);
-    if (!table) {
+    /* Create the sharded store; stripes grow on demand while loading */
+    context_store_t *store = store_create(dim_count);
+    if (!store) {
         evocore_context_system_free(system);
         goto error;
     }
-    system->internal = table;
+    system->internal = store;
     system->total_contexts = context_count;
 
     /* Read contexts */
@@ -1117,13 +1922,17 @@ bool evocore_context_load_binary(
             goto error;
         }
 
-        /* Create or get hash entry */
-        hash_entry_t *entry = hash_set(table, key, param_cnt);
-        evocore_free(key);  /* hash_set makes a copy */
+        /* Create or get hash entry. The system isn't published yet, so
+         * the stripe lock can be dropped before filling in the stats. */
+        size_t stripe;
+        hash_slot_t *entry = store_acquire(system, NULL, key,
+                                           true, true, param_cnt, &stripe);
+        evocore_free(key);  /* the table makes its own copy */
         if (!entry) {
             evocore_context_system_free(system);
             goto error;
         }
+        store_release(store, stripe);
 
         /* Set metadata */
         evocore_context_stats_t *stats = entry->stats;
@@ -1135,18 +1944,19 @@ bool evocore_context_load_binary(
         stats->last_update = (time_t)last_update;
 
         /* Read weighted statistics */
-        if (stats->stats && stats->stats->stats) {
+        if (stats->stats && stats->stats->mean) {
             for (size_t j = 0; j < stats->param_count; j++) {
-                evocore_weighted_stats_t *ws = &stats->stats->stats[j];
-                if (!read_double(f, &ws->mean)) {
+                evocore_weighted_stats_t ws;
+                evocore_weighted_array_get(stats->stats, j, &ws);
+                if (!read_double(f, &ws.mean)) {
                     evocore_context_system_free(system);
                     goto error;
                 }
-                if (!read_double(f, &ws->variance)) {
+                if (!read_double(f, &ws.variance)) {
                     evocore_context_system_free(system);
                     goto error;
                 }
-                if (!read_double(f, &ws->sum_weights)) {
+                if (!read_double(f, &ws.sum_weights)) {
                     evocore_context_system_free(system);
                     goto error;
                 }
@@ -1155,7 +1965,8 @@ bool evocore_context_load_binary(
                     evocore_context_system_free(system);
                     goto error;
                 }
-                ws->count = count_val;
+                ws.count = count_val;
+                evocore_weighted_array_set(stats->stats, j, &ws);
             }
         }
     }
@@ -1185,19 +1996,22 @@ bool evocore_context_export_csv(
     }
     fprintf(f, ",experiences,confidence,avg_fitness,best_fitness\n");
 
-    /* Write data */
-    hash_table_t *table = (hash_table_t*)system->internal;
+    /* Write data, stripe by stripe */
+    context_store_t *store = (context_store_t*)system->internal;
 
-    for (size_t i = 0; i < table->capacity; i++) {
-        hash_entry_t *entry = table->entries[i];
-        while (entry) {
-            evocore_context_stats_t *stats = entry->stats;
+    for (size_t s = 0; s < CONTEXT_STRIPES; s++) {
+        pthread_rwlock_rdlock(&store->locks[s]);
+        hash_table_t *table = store->stripes[s];
+
+        for (size_t i = 0; i < table->capacity; i++) {
+            if (!table->slots[i].key) continue;
+            evocore_context_stats_t *stats = table->slots[i].stats;
 
             fprintf(f, "%s", stats->key);
 
             for (size_t j = 0; j < stats->param_count; j++) {
-                double mean = evocore_weighted_mean(&stats->stats->stats[j]);
-                double std = evocore_weighted_std(&stats->stats->stats[j]);
+                double mean = evocore_weighted_array_mean(stats->stats, j);
+                double std = evocore_weighted_array_std(stats->stats, j);
                 fprintf(f, ",%.6g,%.6g", mean, std);
             }
 
@@ -1206,12 +2020,214 @@ bool evocore_context_export_csv(
                     stats->confidence,
                     stats->avg_fitness,
                     stats->best_fitness);
+        }
+
+        pthread_rwlock_unlock(&store->locks[s]);
+    }
+
+    fclose(f);
+    return true;
+}
+
+/*========================================================================
+ * Write-Ahead Log
+ *========================================================================*/
+
+bool evocore_context_wal_open(
+    evocore_context_system_t *system,
+    const char *filepath,
+    size_t sync_interval
+) {
+    if (!system || !filepath) return false;
+
+    context_store_t *store = (context_store_t*)system->internal;
+
+    pthread_mutex_lock(&store->wal_lock);
+
+    if (store->wal) {
+        pthread_mutex_unlock(&store->wal_lock);
+        return false;  /* Already attached */
+    }
+
+    FILE *f = fopen(filepath, "a+b");
+    if (!f) {
+        pthread_mutex_unlock(&store->wal_lock);
+        return false;
+    }
+
+    fseek(f, 0, SEEK_END);
+    if (ftell(f) == 0) {
+        /* Fresh log: write the header */
+        uint32_t version = WAL_VERSION;
+        uint32_t param_count = (uint32_t)system->param_count;
+        fwrite(WAL_MAGIC, 1, 4, f);
+        fwrite(&version, sizeof(uint32_t), 1, f);
+        fwrite(&param_count, sizeof(uint32_t), 1, f);
+        fflush(f);
+    }
+
+    store->wal = f;
+    store->wal_pending = 0;
+    store->wal_sync_interval = sync_interval;
+
+    pthread_mutex_unlock(&store->wal_lock);
+    return true;
+}
+
+bool evocore_context_wal_sync(evocore_context_system_t *system) {
+    if (!system) return false;
+
+    context_store_t *store = (context_store_t*)system->internal;
+    bool ok = false;
 
-            entry = entry->next;
+    pthread_mutex_lock(&store->wal_lock);
+    if (store->wal) {
+        fflush(store->wal);
+        ok = fdatasync(fileno(store->wal)) == 0;
+        store->wal_pending = 0;
+    }
+    pthread_mutex_unlock(&store->wal_lock);
+
+    return ok;
+}
+
+void evocore_context_wal_close(evocore_context_system_t *system) {
+    if (!system) return;
+
+    context_store_t *store = (context_store_t*)system->internal;
+
+    pthread_mutex_lock(&store->wal_lock);
+    if (store->wal) {
+        fflush(store->wal);
+        fdatasync(fileno(store->wal));
+        fclose(store->wal);
+        store->wal = NULL;
+    }
+    pthread_mutex_unlock(&store->wal_lock);
+}
+
+bool evocore_context_compact(
+    evocore_context_system_t *system,
+    const char *snapshot_path
+) {
+    if (!system || !snapshot_path) return false;
+
+    context_store_t *store = (context_store_t*)system->internal;
+
+    /* Hold the WAL lock across snapshot and truncation so no record
+     * can land between them - nothing truncated away is missing from
+     * the snapshot. A learn whose stats update raced the snapshot scan
+     * can still end up both in the snapshot and in the post-truncation
+     * log, so replay may double-count a handful of experiences around
+     * a compaction; for weighted statistical state that is benign and
+     * not worth per-record sequence numbers. */
+    pthread_mutex_lock(&store->wal_lock);
+
+    if (!evocore_context_save_binary(system, snapshot_path)) {
+        pthread_mutex_unlock(&store->wal_lock);
+        return false;
+    }
+
+    if (store->wal) {
+        fflush(store->wal);
+        if (ftruncate(fileno(store->wal), 3 * sizeof(uint32_t)) != 0) {
+            pthread_mutex_unlock(&store->wal_lock);
+            return false;
+        }
+        fseek(store->wal, 0, SEEK_END);
+        fdatasync(fileno(store->wal));
+        store->wal_pending = 0;
+    }
+
+    pthread_mutex_unlock(&store->wal_lock);
+    return true;
+}
+
+bool evocore_context_replay_wal(
+    evocore_context_system_t *system,
+    const char *filepath
+) {
+    if (!system || !filepath) return false;
+
+    FILE *f = fopen(filepath, "rb");
+    if (!f) return true;  /* No log: nothing to replay */
+
+    char magic[4];
+    uint32_t version, param_count;
+    if (fread(magic, 1, 4, f) != 4 ||
+        memcmp(magic, WAL_MAGIC, 4) != 0 ||
+        fread(&version, sizeof(uint32_t), 1, f) != 1 ||
+        version != WAL_VERSION ||
+        fread(&param_count, sizeof(uint32_t), 1, f) != 1 ||
+        param_count != system->param_count ||
+        param_count > 256) {
+        evocore_log_error("Invalid context WAL header in %s", filepath);
+        fclose(f);
+        return false;
+    }
+
+    /* Detach any attached log while replaying so the replayed learns
+     * don't append themselves right back */
+    context_store_t *store = (context_store_t*)system->internal;
+    pthread_mutex_lock(&store->wal_lock);
+    FILE *attached = store->wal;
+    store->wal = NULL;
+    pthread_mutex_unlock(&store->wal_lock);
+
+    double parameters[256];
+    char key[MAX_KEY_LENGTH];
+    size_t replayed = 0;
+
+    for (;;) {
+        uint32_t key_len;
+        double fitness;
+
+        /* A short read is a torn tail from a crash mid-append: stop */
+        if (fread(&key_len, sizeof(uint32_t), 1, f) != 1) break;
+        if (key_len == 0 || key_len >= MAX_KEY_LENGTH) break;
+        if (fread(key, 1, key_len, f) != key_len) break;
+        key[key_len] = '\0';
+        if (fread(&fitness, sizeof(double), 1, f) != 1) break;
+        if (fread(parameters, sizeof(double), param_count, f) != param_count) {
+            break;
+        }
+
+        if (evocore_context_learn_key(system, key, parameters,
+                                      param_count, fitness)) {
+            replayed++;
         }
     }
 
     fclose(f);
+
+    pthread_mutex_lock(&store->wal_lock);
+    store->wal = attached;
+    pthread_mutex_unlock(&store->wal_lock);
+
+    if (replayed > 0) {
+        evocore_log_info("Replayed %zu context WAL records from %s",
+                         replayed, filepath);
+    }
+    return true;
+}
+
+bool evocore_context_load_binary_wal(
+    const char *snapshot_path,
+    const char *wal_path,
+    evocore_context_system_t **out_system
+) {
+    if (!snapshot_path || !wal_path || !out_system) return false;
+
+    if (!evocore_context_load_binary(snapshot_path, out_system)) {
+        return false;
+    }
+
+    if (!evocore_context_replay_wal(*out_system, wal_path)) {
+        evocore_context_system_free(*out_system);
+        *out_system = NULL;
+        return false;
+    }
+
     return true;
 }
 
@@ -1225,13 +2241,9 @@ bool evocore_context_reset(
 ) {
     if (!system || !dimension_values) return false;
 
-    char key[MAX_KEY_LENGTH];
-    if (!evocore_context_build_key(system, dimension_values, key, sizeof(key))) {
-        return false;
-    }
-
-    hash_table_t *table = (hash_table_t*)system->internal;
-    hash_entry_t *entry = hash_get(table, key);
+    size_t stripe;
+    hash_slot_t *entry = store_acquire(system, dimension_values, NULL,
+                                       true, false, 0, &stripe);
 
     if (entry && entry->stats) {
         evocore_weighted_array_reset(entry->stats->stats);
@@ -1241,31 +2253,37 @@ bool evocore_context_reset(
         entry->stats->best_fitness = 0.0;
         entry->stats->first_update = 0;
         entry->stats->last_update = 0;
+        store_release((context_store_t*)system->internal, stripe);
         return true;
     }
 
+    if (entry) store_release((context_store_t*)system->internal, stripe);
     return false;
 }
 
 void evocore_context_reset_all(evocore_context_system_t *system) {
     if (!system) return;
 
-    hash_table_t *table = (hash_table_t*)system->internal;
-
-    for (size_t i = 0; i < table->capacity; i++) {
-        hash_entry_t *entry = table->entries[i];
-        while (entry) {
-            if (entry->stats) {
-                evocore_weighted_array_reset(entry->stats->stats);
-                entry->stats->total_experiences = 0;
-                entry->stats->confidence = 0.0;
-                entry->stats->avg_fitness = 0.0;
-                entry->stats->best_fitness = 0.0;
-                entry->stats->first_update = 0;
-                entry->stats->last_update = 0;
+    context_store_t *store = (context_store_t*)system->internal;
+
+    for (size_t s = 0; s < CONTEXT_STRIPES; s++) {
+        pthread_rwlock_wrlock(&store->locks[s]);
+        hash_table_t *table = store->stripes[s];
+
+        for (size_t i = 0; i < table->capacity; i++) {
+            hash_slot_t *slot = &table->slots[i];
+            if (slot->key && slot->stats) {
+                evocore_weighted_array_reset(slot->stats->stats);
+                slot->stats->total_experiences = 0;
+                slot->stats->confidence = 0.0;
+                slot->stats->avg_fitness = 0.0;
+                slot->stats->best_fitness = 0.0;
+                slot->stats->first_update = 0;
+                slot->stats->last_update = 0;
             }
-            entry = entry->next;
         }
+
+        pthread_rwlock_unlock(&store->locks[s]);
     }
 }
 
@@ -1281,27 +2299,55 @@ bool evocore_context_merge(
 ) {
     if (!system || !target_key || !source_key) return false;
 
-    hash_table_t *table = (hash_table_t*)system->internal;
+    context_store_t *store = (context_store_t*)system->internal;
+    size_t param_count = system->param_count;
+
+    /* Snapshot the source under its stripe lock, then fold the copy
+     * into the target under its own lock. Two-phase instead of holding
+     * both stripes at once, which would need lock ordering and
+     * deadlocks against concurrent merges. */
+    evocore_weighted_stats_t *snapshot =
+        calloc(param_count, sizeof(evocore_weighted_stats_t));
+    if (!snapshot) return false;
+
+    size_t stripe;
+    hash_slot_t *source_entry = store_acquire(system, NULL, source_key,
+                                              false, false, 0, &stripe);
+    if (!source_entry) {
+        free(snapshot);
+        return false;
+    }
 
-    hash_entry_t *target_entry = hash_get(table, target_key);
-    hash_entry_t *source_entry = hash_get(table, source_key);
+    for (size_t i = 0; i < param_count; i++) {
+        evocore_weighted_array_get(source_entry->stats->stats, i, &snapshot[i]);
+    }
+    size_t source_experiences = source_entry->stats->total_experiences;
+    double source_best = source_entry->stats->best_fitness;
+    store_release(store, stripe);
 
-    if (!target_entry || !source_entry) return false;
+    hash_slot_t *target_entry = store_acquire(system, NULL, target_key,
+                                              true, false, 0, &stripe);
+    if (!target_entry) {
+        free(snapshot);
+        return false;
+    }
 
     /* Merge weighted stats for each parameter */
-    for (size_t i = 0; i < system->param_count; i++) {
-        evocore_weighted_merge(
-            &target_entry->stats->stats->stats[i],
-            &source_entry->stats->stats->stats[i]
-        );
+    for (size_t i = 0; i < param_count; i++) {
+        evocore_weighted_stats_t merged;
+        evocore_weighted_array_get(target_entry->stats->stats, i, &merged);
+        evocore_weighted_merge(&merged, &snapshot[i]);
+        evocore_weighted_array_set(target_entry->stats->stats, i, &merged);
     }
 
     /* Update metadata */
-    target_entry->stats->total_experiences += source_entry->stats->total_experiences;
-    if (source_entry->stats->best_fitness > target_entry->stats->best_fitness) {
-        target_entry->stats->best_fitness = source_entry->stats->best_fitness;
+    target_entry->stats->total_experiences += source_experiences;
+    if (source_best > target_entry->stats->best_fitness) {
+        target_entry->stats->best_fitness = source_best;
     }
 
+    store_release(store, stripe);
+    free(snapshot);
     return true;
 }
 
@@ -9,14 +9,74 @@
  * Domain Registry State
  * ======================================================================*/
 
+/* Open-addressed name index: power-of-two sized, 2x EVOCORE_MAX_DOMAINS
+ * so it never fills. Slots hold domain index + 1 (0 = empty). */
+#define DOMAIN_HASH_SLOTS (EVOCORE_MAX_DOMAINS * 2)
+
 typedef struct {
     evocore_domain_t domains[EVOCORE_MAX_DOMAINS];
+    int hash_slots[DOMAIN_HASH_SLOTS];
     int count;
     bool initialized;
 } domain_registry_t;
 
 static domain_registry_t g_registry = {0};
 
+/*========================================================================
+ * Name Index
+ * ======================================================================*/
+
+static unsigned long domain_hash_name(const char *name) {
+    /* FNV-1a */
+    unsigned long h = 14695981039346656037UL;
+    while (*name) {
+        h ^= (unsigned char)*name++;
+        h *= 1099511628211UL;
+    }
+    return h;
+}
+
+/**
+ * Find a registered domain by name via the hash index.
+ *
+ * @return Domain index, or -1 if not registered
+ */
+static int domain_find(const char *name) {
+    unsigned long slot = domain_hash_name(name) & (DOMAIN_HASH_SLOTS - 1);
+    for (int probes = 0; probes < DOMAIN_HASH_SLOTS; probes++) {
+        int idx = g_registry.hash_slots[slot];
+        if (idx == 0) {
+            return -1;
+        }
+        if (evocore_string_equals(g_registry.domains[idx - 1].name, name)) {
+            return idx - 1;
+        }
+        slot = (slot + 1) & (DOMAIN_HASH_SLOTS - 1);
+    }
+    return -1;
+}
+
+static void domain_hash_insert(const char *name, int idx) {
+    unsigned long slot = domain_hash_name(name) & (DOMAIN_HASH_SLOTS - 1);
+    while (g_registry.hash_slots[slot] != 0) {
+        slot = (slot + 1) & (DOMAIN_HASH_SLOTS - 1);
+    }
+    g_registry.hash_slots[slot] = idx + 1;
+}
+
+/**
+ * Rebuild the index from scratch. Unregistration shifts the domain
+ * array, which invalidates every stored index; with at most
+ * EVOCORE_MAX_DOMAINS entries a full rebuild is cheaper than tombstone
+ * bookkeeping.
+ */
+static void domain_hash_rebuild(void) {
+    memset(g_registry.hash_slots, 0, sizeof(g_registry.hash_slots));
+    for (int i = 0; i < g_registry.count; i++) {
+        domain_hash_insert(g_registry.domains[i].name, i);
+    }
+}
+
 /*========================================================================
  * Registry Management
  * ======================================================================*/
@@ -74,11 +134,9 @@ evocore_error_t evocore_register_domain(const evocore_domain_t *domain) {
     }
 
     /* Check for duplicate name */
-    for (int i = 0; i < g_registry.count; i++) {
-        if (evocore_string_equals(g_registry.domains[i].name, domain->name)) {
-            evocore_log_warn("Domain '%s' already registered", domain->name);
-            return EVOCORE_ERR_INVALID_ARG;
-        }
+    if (domain_find(domain->name) >= 0) {
+        evocore_log_warn("Domain '%s' already registered", domain->name);
+        return EVOCORE_ERR_INVALID_ARG;
     }
 
     /* Check capacity */
@@ -87,18 +145,14 @@ evocore_error_t evocore_register_domain(const evocore_domain_t *domain) {
         return EVOCORE_ERR_POP_FULL;
     }
 
-    /* Copy domain descriptor */
+    /* Copy the whole descriptor so new callback fields can't be
+     * silently dropped from registry handles, then take ownership of
+     * the name/version strings */
     int idx = g_registry.count;
+    g_registry.domains[idx] = *domain;
     g_registry.domains[idx].name = evocore_strdup(domain->name);
     g_registry.domains[idx].version = domain->version ?
         evocore_strdup(domain->version) : evocore_strdup("1.0.0");
-    g_registry.domains[idx].genome_size = domain->genome_size;
-    g_registry.domains[idx].genome_ops = domain->genome_ops;
-    g_registry.domains[idx].fitness = domain->fitness;
-    g_registry.domains[idx].user_context = domain->user_context;
-    g_registry.domains[idx].serialize_genome = domain->serialize_genome;
-    g_registry.domains[idx].deserialize_genome = domain->deserialize_genome;
-    g_registry.domains[idx].get_statistics = domain->get_statistics;
 
     if (g_registry.domains[idx].name == NULL ||
         g_registry.domains[idx].version == NULL) {
@@ -110,6 +164,7 @@ evocore_error_t evocore_register_domain(const evocore_domain_t *domain) {
     }
 
     g_registry.count++;
+    domain_hash_insert(g_registry.domains[idx].name, idx);
 
     evocore_log_info("Registered domain '%s' version %s (genome size: %zu)",
                    domain->name, g_registry.domains[idx].version,
@@ -128,14 +183,7 @@ evocore_error_t evocore_unregister_domain(const char *name) {
     }
 
     /* Find the domain */
-    int idx = -1;
-    for (int i = 0; i < g_registry.count; i++) {
-        if (evocore_string_equals(g_registry.domains[i].name, name)) {
-            idx = i;
-            break;
-        }
-    }
-
+    int idx = domain_find(name);
     if (idx < 0) {
         evocore_log_warn("Domain '%s' not found for unregistration", name);
         return EVOCORE_ERR_CONFIG_NOT_FOUND;
@@ -151,6 +199,7 @@ evocore_error_t evocore_unregister_domain(const char *name) {
     }
 
     g_registry.count--;
+    domain_hash_rebuild();
 
     evocore_log_info("Unregistered domain '%s'", name);
     return EVOCORE_OK;
@@ -161,13 +210,8 @@ const evocore_domain_t* evocore_get_domain(const char *name) {
         return NULL;
     }
 
-    for (int i = 0; i < g_registry.count; i++) {
-        if (evocore_string_equals(g_registry.domains[i].name, name)) {
-            return &g_registry.domains[i];
-        }
-    }
-
-    return NULL;
+    int idx = domain_find(name);
+    return idx >= 0 ? &g_registry.domains[idx] : NULL;
 }
 
 bool evocore_has_domain(const char *name) {
@@ -197,6 +241,15 @@ evocore_error_t evocore_domain_create_genome(const char *domain_name,
         return EVOCORE_ERR_CONFIG_NOT_FOUND;
     }
 
+    return evocore_domain_create_genome_for(domain, genome);
+}
+
+evocore_error_t evocore_domain_create_genome_for(const evocore_domain_t *domain,
+                                             evocore_genome_t *genome) {
+    if (domain == NULL || genome == NULL) {
+        return EVOCORE_ERR_NULL_PTR;
+    }
+
     evocore_error_t err = evocore_genome_init(genome, domain->genome_size);
     if (err != EVOCORE_OK) {
         return err;
@@ -255,3 +308,190 @@ double evocore_domain_diversity(const evocore_genome_t *a,
     }
     return 0.0;
 }
+
+evocore_error_t evocore_domain_bind_gpu_kernel(const evocore_domain_t *domain,
+                                           evocore_eval_batch_t *batch) {
+    if (domain == NULL || batch == NULL) {
+        return EVOCORE_ERR_NULL_PTR;
+    }
+
+    batch->gpu_kernel = domain->gpu_fitness;
+    batch->gpu_kernel_context = domain->gpu_fitness != NULL ?
+                                domain->user_context : NULL;
+
+    return EVOCORE_OK;
+}
+
+evocore_error_t evocore_domain_bind_batch_eval(const evocore_domain_t *domain,
+                                           evocore_eval_batch_t *batch) {
+    if (domain == NULL || batch == NULL) {
+        return EVOCORE_ERR_NULL_PTR;
+    }
+
+    batch->batch_eval = domain->evaluate_batch;
+    batch->batch_eval_context = domain->evaluate_batch != NULL ?
+                                domain->user_context : NULL;
+
+    return EVOCORE_OK;
+}
+
+evocore_error_t evocore_domain_evaluate_population(evocore_parallel_ctx_t *ctx,
+                                               evocore_population_t *pop,
+                                               const evocore_domain_t *domain) {
+    if (pop == NULL || domain == NULL) {
+        return EVOCORE_ERR_NULL_PTR;
+    }
+
+    if (pop->size == 0) {
+        return EVOCORE_OK;
+    }
+
+    if (domain->evaluate_batch != NULL) {
+        /* Hand the domain the whole population in one call so it can
+         * amortize setup and parallelize at its own granularity */
+        const evocore_genome_t **genomes =
+            evocore_malloc(pop->size * sizeof(evocore_genome_t*));
+        double *fitnesses = evocore_malloc(pop->size * sizeof(double));
+        size_t *indices = evocore_malloc(pop->size * sizeof(size_t));
+        if (!genomes || !fitnesses || !indices) {
+            evocore_free(indices);
+            evocore_free(fitnesses);
+            evocore_free(genomes);
+            return EVOCORE_ERR_OUT_OF_MEMORY;
+        }
+
+        size_t count = 0;
+        for (size_t i = 0; i < pop->size; i++) {
+            evocore_individual_t *ind = &pop->individuals[i];
+            if (ind->genome && ind->genome->data) {
+                genomes[count] = ind->genome;
+                indices[count] = i;
+                count++;
+            }
+        }
+
+        domain->evaluate_batch(genomes, fitnesses, count,
+                               domain->user_context);
+
+        for (size_t i = 0; i < count; i++) {
+            pop->individuals[indices[i]].fitness = fitnesses[i];
+        }
+        pop->stats_dirty = true;
+
+        evocore_free(indices);
+        evocore_free(fitnesses);
+        evocore_free(genomes);
+        return EVOCORE_OK;
+    }
+
+    if (domain->fitness == NULL) {
+        return EVOCORE_ERR_INVALID_ARG;
+    }
+
+    if (ctx != NULL) {
+        return evocore_parallel_evaluate_population(ctx, pop,
+                                                    domain->fitness,
+                                                    domain->user_context);
+    }
+
+    /* Serial fallback */
+    for (size_t i = 0; i < pop->size; i++) {
+        evocore_individual_t *ind = &pop->individuals[i];
+        if (ind->genome && ind->genome->data) {
+            ind->fitness = domain->fitness(ind->genome,
+                                           domain->user_context);
+        }
+    }
+    pop->stats_dirty = true;
+
+    return EVOCORE_OK;
+}
+
+evocore_error_t evocore_domain_dedup_population(evocore_population_t *pop,
+                                            const evocore_domain_t *domain,
+                                            size_t *replaced) {
+    if (pop == NULL || domain == NULL) {
+        return EVOCORE_ERR_NULL_PTR;
+    }
+    if (replaced) {
+        *replaced = 0;
+    }
+    if (pop->size < 2) {
+        return EVOCORE_OK;
+    }
+
+    /* Open-addressed fingerprint table, 2x population rounded up to a
+     * power of two so probing stays short. Slots hold index + 1. */
+    size_t slots = 16;
+    while (slots < pop->size * 2) {
+        slots *= 2;
+    }
+    size_t *table = evocore_calloc(slots, sizeof(size_t));
+    if (!table) {
+        return EVOCORE_ERR_OUT_OF_MEMORY;
+    }
+
+    size_t count = 0;
+    for (size_t i = 0; i < pop->size; i++) {
+        evocore_genome_t *genome = pop->individuals[i].genome;
+        if (!genome || !genome->data || genome->size == 0) {
+            continue;
+        }
+
+        /* Domains mutate genome bytes directly, so a stale cached
+         * fingerprint cannot be trusted here: recompute once */
+        evocore_genome_fingerprint_invalidate(genome);
+        uint64_t fp = evocore_genome_fingerprint(genome);
+
+        size_t slot = (size_t)fp & (slots - 1);
+        bool duplicate = false;
+        while (table[slot] != 0) {
+            evocore_genome_t *other =
+                pop->individuals[table[slot] - 1].genome;
+            if (other->fingerprint == fp &&
+                other->size == genome->size &&
+                memcmp(other->data, genome->data, genome->size) == 0) {
+                duplicate = true;
+                break;
+            }
+            slot = (slot + 1) & (slots - 1);
+        }
+
+        if (!duplicate) {
+            table[slot] = i + 1;
+            continue;
+        }
+
+        /* Replace the duplicate with fresh genetic material and force
+         * re-evaluation */
+        if (domain->genome_ops.random_init != NULL) {
+            domain->genome_ops.random_init(genome, domain->user_context);
+            evocore_genome_fingerprint_invalidate(genome);
+        } else {
+            evocore_genome_randomize(genome);
+        }
+        pop->individuals[i].fitness = 0.0;
+        count++;
+
+        /* Index the replacement too so a colliding rerandomization is
+         * still caught */
+        fp = evocore_genome_fingerprint(genome);
+        slot = (size_t)fp & (slots - 1);
+        while (table[slot] != 0) {
+            slot = (slot + 1) & (slots - 1);
+        }
+        table[slot] = i + 1;
+    }
+
+    evocore_free(table);
+
+    if (count > 0) {
+        pop->stats_dirty = true;
+        evocore_log_debug("Deduplicated %zu of %zu individuals",
+                          count, pop->size);
+    }
+    if (replaced) {
+        *replaced = count;
+    }
+    return EVOCORE_OK;
+}
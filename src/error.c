@@ -53,6 +53,14 @@ const char* evocore_error_string(evocore_error_t err) {
         case EVOCORE_ERR_FILE_WRITE:
             return "File write error";
 
+        /* Network errors */
+        case EVOCORE_ERR_NET:
+            return "Socket operation failed";
+        case EVOCORE_ERR_TIMEOUT:
+            return "Deadline passed";
+        case EVOCORE_ERR_PROTOCOL:
+            return "Malformed network message";
+
         default:
             return "Undefined error code";
     }
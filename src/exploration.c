@@ -369,6 +369,212 @@ double evocore_cool_temperature(double temperature, double cooling_rate) {
     return fmax(0.001, temperature * cooling_rate);
 }
 
+/*========================================================================
+ * Boltzmann Alias Sampler
+ *========================================================================*/
+
+/* Rebuild when any weight moved by more than this fraction of the
+ * temperature scale since the last build */
+#define SAMPLER_REBUILD_DRIFT 0.001
+
+/* 2^(k/256) lookup for the fast exp approximation */
+#define FAST_EXP_TABLE_BITS 8
+#define FAST_EXP_TABLE_SIZE (1 << FAST_EXP_TABLE_BITS)
+
+static double g_fast_exp_table[FAST_EXP_TABLE_SIZE];
+static bool g_fast_exp_ready = false;
+
+/**
+ * Table-approximated exp() for the batch rebuild.
+ *
+ * Splits x/ln(2) into integer and fractional parts; the fractional
+ * 2^f comes from a 256-entry table with linear interpolation, the
+ * integer part is applied with ldexp. Relative error is under 1e-5,
+ * far below what sampling noise can resolve. Inputs are <= 0 because
+ * the caller subtracts the max value first.
+ */
+static double fast_exp(double x) {
+    double t = x * 1.4426950408889634;  /* x / ln(2) */
+    double ip = floor(t);
+    double fp = t - ip;
+
+    double scaled = fp * FAST_EXP_TABLE_SIZE;
+    int idx = (int)scaled;
+    double frac = scaled - idx;
+    double lo = g_fast_exp_table[idx];
+    double hi = idx + 1 < FAST_EXP_TABLE_SIZE ?
+                g_fast_exp_table[idx + 1] : 2.0;
+
+    return ldexp(lo + (hi - lo) * frac, (int)ip);
+}
+
+static void fast_exp_init(void) {
+    if (g_fast_exp_ready) return;
+    for (int i = 0; i < FAST_EXP_TABLE_SIZE; i++) {
+        g_fast_exp_table[i] = pow(2.0, (double)i / FAST_EXP_TABLE_SIZE);
+    }
+    g_fast_exp_ready = true;
+}
+
+evocore_boltzmann_sampler_t* evocore_boltzmann_sampler_create(size_t count) {
+    if (count == 0) return NULL;
+
+    evocore_boltzmann_sampler_t *sampler =
+        calloc(1, sizeof(evocore_boltzmann_sampler_t));
+    if (!sampler) return NULL;
+
+    sampler->prob = calloc(count, sizeof(double));
+    sampler->alias = calloc(count, sizeof(size_t));
+    sampler->last_values = calloc(count, sizeof(double));
+    if (!sampler->prob || !sampler->alias || !sampler->last_values) {
+        evocore_boltzmann_sampler_free(sampler);
+        return NULL;
+    }
+
+    sampler->count = count;
+    fast_exp_init();
+
+    return sampler;
+}
+
+void evocore_boltzmann_sampler_free(evocore_boltzmann_sampler_t *sampler) {
+    if (!sampler) return;
+    free(sampler->prob);
+    free(sampler->alias);
+    free(sampler->last_values);
+    free(sampler);
+}
+
+/**
+ * Walker's alias method: partition the normalized weights into count
+ * slots of equal probability, each covering at most two arms.
+ */
+static bool sampler_build_table(evocore_boltzmann_sampler_t *sampler,
+                                const double *values,
+                                double temperature) {
+    size_t count = sampler->count;
+
+    double *weights = calloc(count, sizeof(double));
+    size_t *small = calloc(count, sizeof(size_t));
+    size_t *large = calloc(count, sizeof(size_t));
+    if (!weights || !small || !large) {
+        free(weights);
+        free(small);
+        free(large);
+        return false;
+    }
+
+    /* Batched softmax weights, max-subtracted for stability */
+    double max_val = values[0];
+    for (size_t i = 1; i < count; i++) {
+        if (values[i] > max_val) max_val = values[i];
+    }
+    double inv_temp = 1.0 / temperature;
+    double sum = 0.0;
+    for (size_t i = 0; i < count; i++) {
+        weights[i] = fast_exp((values[i] - max_val) * inv_temp);
+        sum += weights[i];
+    }
+
+    if (sum < 1e-300) {
+        /* Degenerate: fall back to uniform */
+        for (size_t i = 0; i < count; i++) {
+            sampler->prob[i] = 1.0;
+            sampler->alias[i] = i;
+        }
+    } else {
+        /* Scale so the average weight is exactly 1 slot */
+        double scale = (double)count / sum;
+        size_t n_small = 0;
+        size_t n_large = 0;
+        for (size_t i = 0; i < count; i++) {
+            weights[i] *= scale;
+            if (weights[i] < 1.0) {
+                small[n_small++] = i;
+            } else {
+                large[n_large++] = i;
+            }
+        }
+
+        while (n_small > 0 && n_large > 0) {
+            size_t s = small[--n_small];
+            size_t l = large[--n_large];
+            sampler->prob[s] = weights[s];
+            sampler->alias[s] = l;
+            weights[l] -= 1.0 - weights[s];
+            if (weights[l] < 1.0) {
+                small[n_small++] = l;
+            } else {
+                large[n_large++] = l;
+            }
+        }
+        /* Leftovers are exactly 1.0 up to rounding */
+        while (n_large > 0) {
+            size_t l = large[--n_large];
+            sampler->prob[l] = 1.0;
+            sampler->alias[l] = l;
+        }
+        while (n_small > 0) {
+            size_t s = small[--n_small];
+            sampler->prob[s] = 1.0;
+            sampler->alias[s] = s;
+        }
+    }
+
+    memcpy(sampler->last_values, values, count * sizeof(double));
+    sampler->last_temperature = temperature;
+    sampler->built = true;
+    sampler->rebuilds++;
+
+    free(weights);
+    free(small);
+    free(large);
+    return true;
+}
+
+bool evocore_boltzmann_sampler_update(
+    evocore_boltzmann_sampler_t *sampler,
+    const double *values,
+    size_t count,
+    double temperature
+) {
+    if (!sampler || !values || count != sampler->count) return false;
+
+    temperature = fmax(0.001, temperature);
+    sampler->updates++;
+
+    if (sampler->built) {
+        /* Skip the rebuild when nothing moved enough to shift the
+         * distribution: drift is measured on the exp() exponents, so
+         * the threshold is relative to the temperature scale */
+        double tolerance = SAMPLER_REBUILD_DRIFT * temperature;
+        bool drifted = fabs(temperature - sampler->last_temperature) >
+                       SAMPLER_REBUILD_DRIFT * sampler->last_temperature;
+        for (size_t i = 0; !drifted && i < count; i++) {
+            if (fabs(values[i] - sampler->last_values[i]) > tolerance) {
+                drifted = true;
+            }
+        }
+        if (!drifted) {
+            return true;
+        }
+    }
+
+    return sampler_build_table(sampler, values, temperature);
+}
+
+size_t evocore_boltzmann_sampler_select(
+    evocore_boltzmann_sampler_t *sampler,
+    unsigned int *seed
+) {
+    if (!sampler || !sampler->built || sampler->count == 0) return 0;
+
+    size_t slot = (size_t)rand_r(seed) % sampler->count;
+    double coin = (double)rand_r(seed) / (double)RAND_MAX;
+
+    return coin < sampler->prob[slot] ? slot : sampler->alias[slot];
+}
+
 /*========================================================================
  * Adaptive Exploration
  *========================================================================*/
@@ -1,5 +1,6 @@
 #define _GNU_SOURCE
 #include "evocore/genome.h"
+#include "evocore/random.h"
 #include "internal.h"
 #include "evocore/log.h"
 #include <string.h>
@@ -21,6 +22,7 @@ evocore_error_t evocore_genome_init(evocore_genome_t *genome, size_t capacity) {
     genome->capacity = capacity;
     genome->size = 0;
     genome->owns_memory = true;
+    genome->fingerprint = 0;
 
     return EVOCORE_OK;
 }
@@ -43,6 +45,7 @@ evocore_error_t evocore_genome_from_data(evocore_genome_t *genome,
     genome->capacity = size;
     genome->size = size;
     genome->owns_memory = true;
+    genome->fingerprint = 0;
 
     return EVOCORE_OK;
 }
@@ -57,6 +60,7 @@ evocore_error_t evocore_genome_view(evocore_genome_t *genome,
     genome->size = size;
     genome->capacity = size;
     genome->owns_memory = false;
+    genome->fingerprint = 0;
 
     return EVOCORE_OK;
 }
@@ -72,13 +76,18 @@ void evocore_genome_cleanup(evocore_genome_t *genome) {
     genome->size = 0;
     genome->capacity = 0;
     genome->owns_memory = false;
+    genome->fingerprint = 0;
 }
 
 evocore_error_t evocore_genome_clone(const evocore_genome_t *src,
                                  evocore_genome_t *dst) {
     if (!src || !dst) return EVOCORE_ERR_NULL_PTR;
 
-    return evocore_genome_from_data(dst, src->data, src->size);
+    evocore_error_t err = evocore_genome_from_data(dst, src->data, src->size);
+    if (err == EVOCORE_OK) {
+        dst->fingerprint = src->fingerprint;  /* Same bytes, same hash */
+    }
+    return err;
 }
 
 /*========================================================================
@@ -96,6 +105,7 @@ evocore_error_t evocore_genome_resize(evocore_genome_t *genome,
         genome->capacity = new_capacity;
         if (genome->size > new_capacity) {
             genome->size = new_capacity;
+            genome->fingerprint = 0;  /* Truncation changes hashed range */
         }
         return EVOCORE_OK;
     }
@@ -121,6 +131,7 @@ evocore_error_t evocore_genome_set_size(evocore_genome_t *genome, size_t size) {
         return EVOCORE_ERR_INVALID_ARG;
     }
     genome->size = size;
+    genome->fingerprint = 0;
     return EVOCORE_OK;
 }
 
@@ -144,6 +155,7 @@ evocore_error_t evocore_genome_write(evocore_genome_t *genome,
     }
 
     memcpy((char*)genome->data + offset, data, size);
+    genome->fingerprint = 0;
 
     if (offset + size > genome->size) {
         genome->size = offset + size;
@@ -199,6 +211,7 @@ evocore_error_t evocore_genome_zero(evocore_genome_t *genome) {
     if (!genome->data) return EVOCORE_ERR_GENOME_EMPTY;
 
     memset(genome->data, 0, genome->size);
+    genome->fingerprint = 0;
     return EVOCORE_OK;
 }
 
@@ -206,20 +219,51 @@ evocore_error_t evocore_genome_randomize(evocore_genome_t *genome) {
     if (!genome) return EVOCORE_ERR_NULL_PTR;
     if (!genome->data) return EVOCORE_ERR_GENOME_EMPTY;
 
-    unsigned char *data = (unsigned char*)genome->data;
     size_t len = genome->size > 0 ? genome->size : genome->capacity;
-    for (size_t i = 0; i < len; i++) {
-        data[i] = (unsigned char)rand();
-    }
+    evocore_random_fill_bytes(genome->data, len);
 
     /* Update size to reflect filled data if it was empty */
     if (genome->size == 0) {
         genome->size = len;
     }
+    genome->fingerprint = 0;
 
     return EVOCORE_OK;
 }
 
+uint64_t evocore_genome_hash(const evocore_genome_t *genome) {
+    if (!genome || !genome->data || genome->size == 0) {
+        return 0;
+    }
+
+    /* FNV-1a */
+    const unsigned char *data = (const unsigned char*)genome->data;
+    uint64_t hash = 14695981039346656037ULL;
+    for (size_t i = 0; i < genome->size; i++) {
+        hash ^= data[i];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+uint64_t evocore_genome_fingerprint(evocore_genome_t *genome) {
+    if (!genome) {
+        return 0;
+    }
+    /* A genuine hash of 0 is recomputed every call; with a 64-bit FNV
+     * that is not worth a separate validity flag */
+    if (genome->fingerprint == 0) {
+        genome->fingerprint = evocore_genome_hash(genome);
+    }
+    return genome->fingerprint;
+}
+
+void evocore_genome_fingerprint_invalidate(evocore_genome_t *genome) {
+    if (genome) {
+        genome->fingerprint = 0;
+    }
+}
+
 bool evocore_genome_is_valid(const evocore_genome_t *genome) {
     return genome && genome->data && genome->size > 0;
 }
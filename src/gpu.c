@@ -1,5 +1,6 @@
 #define _GNU_SOURCE
 #include "evocore/gpu.h"
+#include "evocore/stats.h"
 #include "internal.h"
 #include "evocore/log.h"
 #include <stdio.h>
@@ -20,6 +21,15 @@
 #include <cuda_runtime.h>
 
 /* External CUDA functions from fitness.cu */
+extern int cuda_batch_evaluate(
+    const void* d_genomes,
+    void* d_fitnesses,
+    size_t genome_size,
+    int count,
+    int fitness_type,
+    void* stream
+);
+
 extern int cuda_batch_evaluate_sync(
     const void* d_genomes,
     void* d_fitnesses,
@@ -50,6 +60,41 @@ extern const char* cuda_get_error_string(void);
  * GPU Context State
  *========================================================================*/
 
+/*========================================================================
+ * Batch Size Autotuning State
+ *========================================================================*/
+
+#define GPU_AUTOTUNE_ENTRIES 16       /* Tracked (device, kernel, size) triples */
+#define GPU_AUTOTUNE_MIN_SAMPLES 3    /* Batches measured per proposal */
+#define GPU_AUTOTUNE_EWMA_ALPHA 0.4   /* Throughput smoothing */
+#define GPU_AUTOTUNE_MIN_BATCH 32
+
+/**
+ * Hill-climbing state for one device/kernel/genome-size triple
+ *
+ * The tuner measures an EWMA of throughput at the current proposal,
+ * then steps the batch size up or down; a regression reverses the
+ * direction and halves the step, so the search converges once the
+ * step drops below ~5% of the size.
+ */
+typedef struct {
+    bool in_use;
+    int device_id;                       /* -1 for CPU-executed batches */
+    evocore_gpu_kernel_launch_t kernel;  /* NULL = built-in kernel */
+    size_t genome_size;
+
+    size_t current_size;                 /* Proposal being measured */
+    size_t step;
+    int direction;                       /* +1 growing, -1 shrinking */
+    double ewma_throughput;              /* Genomes/ms at current proposal */
+    int samples;
+    double prev_throughput;              /* Throughput at previous proposal */
+    size_t tuned_size;                   /* Best size seen so far */
+    double tuned_throughput;
+    bool converged;
+    bool seeded;                         /* Loaded from a persisted file */
+} gpu_autotune_entry_t;
+
 struct evocore_gpu_context_s {
     bool initialized;
     bool cuda_available;
@@ -59,6 +104,13 @@ struct evocore_gpu_context_s {
     int current_device;
     size_t max_batch_size;
 
+    /* Multi-GPU sharding */
+    bool sharding_enabled;
+    double device_throughput[EVOCORE_MAX_GPUS];  /* Genomes per ms (EWMA) */
+
+    /* Batch size autotuning (guarded by stats_lock) */
+    gpu_autotune_entry_t autotune[GPU_AUTOTUNE_ENTRIES];
+
     /* Performance stats */
     evocore_gpu_stats_t stats;
 #ifdef EVOCORE_HAVE_PTHREADS
@@ -288,6 +340,342 @@ static double get_time_ms(void) {
     return (double)ts.tv_sec * 1000.0 + (double)ts.tv_nsec / 1000000.0;
 }
 
+#ifdef EVOCORE_HAVE_CUDA
+/**
+ * Flatten a range of batch genomes into a contiguous staging buffer
+ */
+static void flatten_genome_range(const evocore_eval_batch_t *batch,
+                                 size_t start, size_t count,
+                                 size_t genome_size, uint8_t *dst) {
+    for (size_t i = 0; i < count; i++) {
+        uint8_t *slot = dst + i * genome_size;
+        const evocore_genome_t *genome = batch->genomes[start + i];
+
+        if (genome != NULL && genome->data != NULL) {
+            size_t copy = genome->size < genome_size ? genome->size : genome_size;
+            memcpy(slot, genome->data, copy);
+            if (copy < genome_size) {
+                memset(slot + copy, 0, genome_size - copy);
+            }
+        } else {
+            memset(slot, 0, genome_size);
+        }
+    }
+}
+
+/**
+ * Launch the batch's fitness kernel: the domain-supplied launcher when
+ * one is bound, the built-in benchmark kernel otherwise
+ */
+static int gpu_launch_batch(const evocore_eval_batch_t *batch,
+                            const void *d_genomes, void *d_fitnesses,
+                            size_t genome_size, int count, void *stream) {
+    if (batch->gpu_kernel != NULL) {
+        return batch->gpu_kernel(d_genomes, d_fitnesses, genome_size,
+                                 count, stream, batch->gpu_kernel_context);
+    }
+    return cuda_batch_evaluate(d_genomes, d_fitnesses, genome_size,
+                               count, 0 /* FITNESS_SPHERE */, stream);
+}
+#endif /* EVOCORE_HAVE_CUDA */
+
+#if defined(EVOCORE_HAVE_CUDA) && defined(EVOCORE_HAVE_PTHREADS)
+
+/**
+ * One device's share of a sharded batch
+ */
+typedef struct {
+    const evocore_eval_batch_t *batch;
+    int device_id;
+    size_t start;
+    size_t count;
+    size_t genome_size;
+    size_t evaluated;
+    double elapsed_ms;
+} gpu_shard_task_t;
+
+/**
+ * Worker thread: evaluate one shard on its own device and stream
+ *
+ * CUDA device selection is per-thread, so each shard gets a dedicated
+ * thread bound to its device.
+ */
+static void* gpu_shard_worker(void *arg) {
+    gpu_shard_task_t *task = (gpu_shard_task_t*)arg;
+
+    if (task->count == 0) {
+        return NULL;
+    }
+    if (cudaSetDevice(task->device_id) != cudaSuccess) {
+        return NULL;
+    }
+
+    double start_ms = get_time_ms();
+    size_t genome_bytes = task->count * task->genome_size;
+
+    uint8_t *flat = (uint8_t*)evocore_malloc(genome_bytes);
+    if (flat == NULL) {
+        return NULL;
+    }
+    flatten_genome_range(task->batch, task->start, task->count,
+                         task->genome_size, flat);
+
+    cudaStream_t stream = NULL;
+    void *d_genomes = NULL;
+    void *d_fitnesses = NULL;
+
+    bool ok = cudaStreamCreate(&stream) == cudaSuccess &&
+              cudaMalloc(&d_genomes, genome_bytes) == cudaSuccess &&
+              cudaMalloc(&d_fitnesses,
+                         task->count * sizeof(double)) == cudaSuccess &&
+              cudaMemcpyAsync(d_genomes, flat, genome_bytes,
+                              cudaMemcpyHostToDevice, stream) == cudaSuccess &&
+              gpu_launch_batch(task->batch, d_genomes, d_fitnesses,
+                               task->genome_size, (int)task->count,
+                               stream) > 0 &&
+              cudaMemcpyAsync(task->batch->fitnesses + task->start,
+                              d_fitnesses, task->count * sizeof(double),
+                              cudaMemcpyDeviceToHost, stream) == cudaSuccess &&
+              cudaStreamSynchronize(stream) == cudaSuccess;
+
+    if (d_genomes) cudaFree(d_genomes);
+    if (d_fitnesses) cudaFree(d_fitnesses);
+    if (stream) cudaStreamDestroy(stream);
+    evocore_free(flat);
+
+    if (ok) {
+        task->evaluated = task->count;
+        task->elapsed_ms = get_time_ms() - start_ms;
+    }
+
+    return NULL;
+}
+
+/**
+ * Split a batch across all devices proportionally to their measured
+ * throughput (multiprocessor count before any measurement exists)
+ *
+ * Returns true when every shard completed; on partial failure the
+ * caller retries on the single-device path.
+ */
+static bool gpu_evaluate_sharded(evocore_gpu_context_t *ctx,
+                                 const evocore_eval_batch_t *batch,
+                                 evocore_eval_result_t *result) {
+    double start_ms = get_time_ms();
+
+    double weights[EVOCORE_MAX_GPUS];
+    double total_weight = 0.0;
+    for (int d = 0; d < ctx->device_count; d++) {
+        if (ctx->device_throughput[d] > 0.0) {
+            weights[d] = ctx->device_throughput[d];
+        } else {
+            weights[d] = ctx->devices[d].multiprocessor_count > 0 ?
+                         (double)ctx->devices[d].multiprocessor_count : 1.0;
+        }
+        total_weight += weights[d];
+    }
+
+    gpu_shard_task_t tasks[EVOCORE_MAX_GPUS];
+    pthread_t threads[EVOCORE_MAX_GPUS];
+    size_t assigned = 0;
+
+    for (int d = 0; d < ctx->device_count; d++) {
+        size_t count;
+        if (d == ctx->device_count - 1) {
+            count = batch->count - assigned;  /* Remainder to last device */
+        } else {
+            count = (size_t)((double)batch->count * weights[d] / total_weight);
+            if (assigned + count > batch->count) {
+                count = batch->count - assigned;
+            }
+        }
+
+        tasks[d].batch = batch;
+        tasks[d].device_id = ctx->devices[d].device_id;
+        tasks[d].start = assigned;
+        tasks[d].count = count;
+        tasks[d].genome_size = batch->genome_size;
+        tasks[d].evaluated = 0;
+        tasks[d].elapsed_ms = 0.0;
+        assigned += count;
+
+        pthread_create(&threads[d], NULL, gpu_shard_worker, &tasks[d]);
+    }
+
+    size_t evaluated = 0;
+    for (int d = 0; d < ctx->device_count; d++) {
+        pthread_join(threads[d], NULL);
+        evaluated += tasks[d].evaluated;
+
+        /* Update the throughput estimate that drives future splits */
+        if (tasks[d].evaluated > 0 && tasks[d].elapsed_ms > 0.0) {
+            double tput = (double)tasks[d].evaluated / tasks[d].elapsed_ms;
+            if (ctx->device_throughput[d] > 0.0) {
+                ctx->device_throughput[d] =
+                    0.7 * ctx->device_throughput[d] + 0.3 * tput;
+            } else {
+                ctx->device_throughput[d] = tput;
+            }
+        }
+    }
+
+    if (evaluated < batch->count) {
+        return false;
+    }
+
+    result->evaluated = evaluated;
+    result->used_gpu = true;
+    result->gpu_time_ms = get_time_ms() - start_ms;
+    return true;
+}
+
+#endif /* EVOCORE_HAVE_CUDA && EVOCORE_HAVE_PTHREADS */
+
+/*========================================================================
+ * Batch Size Autotuning (internal)
+ *========================================================================*/
+
+/**
+ * Find the autotune entry for a device/kernel/genome-size triple
+ *
+ * Caller must hold stats_lock. When create is true and no entry
+ * exists, a fresh search is seeded from evocore_gpu_recommend_batch_size.
+ * Persisted entries are saved without a kernel pointer (function
+ * addresses are not stable across runs); the first lookup with a
+ * matching device and genome size claims them.
+ */
+static gpu_autotune_entry_t* gpu_autotune_find(evocore_gpu_context_t *ctx,
+                                               evocore_gpu_kernel_launch_t kernel,
+                                               size_t genome_size,
+                                               bool create) {
+    int device_id = ctx->cuda_available ? ctx->current_device : -1;
+    gpu_autotune_entry_t *free_slot = NULL;
+    gpu_autotune_entry_t *wildcard = NULL;
+
+    for (int i = 0; i < GPU_AUTOTUNE_ENTRIES; i++) {
+        gpu_autotune_entry_t *e = &ctx->autotune[i];
+        if (!e->in_use) {
+            if (free_slot == NULL) free_slot = e;
+            continue;
+        }
+        if (e->device_id != device_id || e->genome_size != genome_size) {
+            continue;
+        }
+        if (e->kernel == kernel) {
+            return e;
+        }
+        if (e->seeded && e->kernel == NULL && wildcard == NULL) {
+            wildcard = e;
+        }
+    }
+
+    if (wildcard != NULL) {
+        wildcard->kernel = kernel;
+        wildcard->seeded = false;
+        return wildcard;
+    }
+
+    if (!create || free_slot == NULL) {
+        return NULL;
+    }
+
+    memset(free_slot, 0, sizeof(*free_slot));
+    free_slot->in_use = true;
+    free_slot->device_id = device_id;
+    free_slot->kernel = kernel;
+    free_slot->genome_size = genome_size;
+    free_slot->current_size = evocore_gpu_recommend_batch_size(ctx, genome_size);
+    if (free_slot->current_size < GPU_AUTOTUNE_MIN_BATCH) {
+        free_slot->current_size = GPU_AUTOTUNE_MIN_BATCH;
+    }
+    free_slot->step = free_slot->current_size / 2;
+    if (free_slot->step < 1) free_slot->step = 1;
+    free_slot->direction = 1;
+    free_slot->tuned_size = free_slot->current_size;
+    return free_slot;
+}
+
+/**
+ * Feed one measured batch into the hill-climbing search
+ *
+ * Called from evocore_gpu_evaluate_batch with stats_lock released;
+ * takes the lock itself. Batches whose size is far from the current
+ * proposal (callers are free to pick any batch size) are ignored as
+ * unrepresentative.
+ */
+static void gpu_autotune_record(evocore_gpu_context_t *ctx,
+                                const evocore_eval_batch_t *batch,
+                                const evocore_eval_result_t *result) {
+    if (result->evaluated == 0) {
+        return;
+    }
+    double elapsed_ms = result->used_gpu ? result->gpu_time_ms
+                                         : result->cpu_time_ms;
+    if (elapsed_ms <= 0.0) {
+        return;
+    }
+
+#ifdef EVOCORE_HAVE_PTHREADS
+    pthread_mutex_lock(&ctx->stats_lock);
+#endif
+    gpu_autotune_entry_t *e = gpu_autotune_find(ctx, batch->gpu_kernel,
+                                                batch->genome_size, true);
+    if (e == NULL || e->converged) {
+        goto done;
+    }
+
+    double ratio = (double)result->evaluated / (double)e->current_size;
+    if (ratio < 0.75 || ratio > 1.25) {
+        goto done;
+    }
+
+    double throughput = (double)result->evaluated / elapsed_ms;
+    if (e->samples == 0) {
+        e->ewma_throughput = throughput;
+    } else {
+        e->ewma_throughput += GPU_AUTOTUNE_EWMA_ALPHA *
+                              (throughput - e->ewma_throughput);
+    }
+    e->samples++;
+    if (e->samples < GPU_AUTOTUNE_MIN_SAMPLES) {
+        goto done;
+    }
+
+    if (e->ewma_throughput > e->tuned_throughput) {
+        e->tuned_throughput = e->ewma_throughput;
+        e->tuned_size = e->current_size;
+    }
+
+    if (e->prev_throughput > 0.0 &&
+        e->ewma_throughput < e->prev_throughput * 0.98) {
+        /* Regression: turn around and narrow the search */
+        e->direction = -e->direction;
+        e->step /= 2;
+    }
+    e->prev_throughput = e->ewma_throughput;
+
+    if (e->step == 0 || e->step < e->current_size / 20) {
+        /* Step is below ~5% of the size: settle on the best seen */
+        e->current_size = e->tuned_size;
+        e->converged = true;
+    } else {
+        if (e->direction > 0) {
+            e->current_size += e->step;
+        } else if (e->current_size > e->step + GPU_AUTOTUNE_MIN_BATCH) {
+            e->current_size -= e->step;
+        } else {
+            e->current_size = GPU_AUTOTUNE_MIN_BATCH;
+        }
+        e->samples = 0;  /* Measure the new proposal afresh */
+    }
+
+done:
+#ifdef EVOCORE_HAVE_PTHREADS
+    pthread_mutex_unlock(&ctx->stats_lock);
+#endif
+    return;
+}
+
 evocore_error_t evocore_gpu_evaluate_batch(evocore_gpu_context_t *ctx,
                                        const evocore_eval_batch_t *batch,
                                        evocore_fitness_func_t fitness_func,
@@ -306,14 +694,27 @@ evocore_error_t evocore_gpu_evaluate_batch(evocore_gpu_context_t *ctx,
     memset(result, 0, sizeof(evocore_eval_result_t));
     result->evaluated = 0;
 
+    EVOCORE_TRACE_BEGIN(trace_start);
+
     /* Try GPU first if available */
     if (ctx->cuda_available && ctx->gpu_enabled) {
 #ifdef EVOCORE_HAVE_CUDA
+#ifdef EVOCORE_HAVE_PTHREADS
+        /* Shard across all devices when enabled; on partial failure
+         * fall through and retry on the current device */
+        if (ctx->sharding_enabled && ctx->device_count > 1 &&
+            batch->count >= (size_t)ctx->device_count) {
+            gpu_evaluate_sharded(ctx, batch, result);
+        }
+#endif
+
         double gpu_start = get_time_ms();
 
-        /* Flatten genome data for GPU transfer */
+        /* Flatten genome data for GPU transfer (skipped when sharding
+         * already completed the batch) */
         size_t total_size = batch->genome_size * batch->count;
-        uint8_t *flat_genomes = (uint8_t*)evocore_malloc(total_size);
+        uint8_t *flat_genomes = result->evaluated > 0 ?
+            NULL : (uint8_t*)evocore_malloc(total_size);
         if (flat_genomes) {
             /* Flatten genomes */
             for (size_t i = 0; i < batch->count; i++) {
@@ -339,10 +740,13 @@ evocore_error_t evocore_gpu_evaluate_batch(evocore_gpu_context_t *ctx,
 
             if (d_genomes && d_fitnesses) {
                 /* Evaluate on GPU */
-                int cuda_result = cuda_batch_evaluate_sync(d_genomes, d_fitnesses,
-                                                           batch->genome_size,
-                                                           batch->count,
-                                                           0);  /* FITNESS_SPHERE */
+                int cuda_result = gpu_launch_batch(batch, d_genomes, d_fitnesses,
+                                                   batch->genome_size,
+                                                   (int)batch->count, NULL);
+                if (cuda_result > 0 &&
+                    cudaDeviceSynchronize() != cudaSuccess) {
+                    cuda_result = 0;
+                }
 
                 if (cuda_result > 0) {
                     /* Copy results back */
@@ -378,6 +782,8 @@ evocore_error_t evocore_gpu_evaluate_batch(evocore_gpu_context_t *ctx,
 #ifdef EVOCORE_HAVE_PTHREADS
             pthread_mutex_unlock(&ctx->stats_lock);
 #endif
+            gpu_autotune_record(ctx, batch, result);
+            EVOCORE_TRACE_END(trace_start, "gpu_batch");
             return EVOCORE_OK;
         }
 #endif
@@ -455,6 +861,11 @@ evocore_error_t evocore_gpu_evaluate_batch(evocore_gpu_context_t *ctx,
     pthread_mutex_unlock(&ctx->stats_lock);
 #endif
 
+    /* The CPU engine benefits from tuning too (thread chunking) */
+    gpu_autotune_record(ctx, batch, result);
+
+    EVOCORE_TRACE_END(trace_start, "gpu_batch");
+
     return EVOCORE_OK;
 }
 
@@ -476,6 +887,16 @@ evocore_error_t evocore_cpu_evaluate_batch(const evocore_eval_batch_t *batch,
 
     double start_time = get_time_ms();
 
+    /* Domain batch evaluator amortizes setup across the whole batch
+     * and handles its own parallelism - prefer it when bound */
+    if (batch->batch_eval != NULL) {
+        batch->batch_eval(batch->genomes, batch->fitnesses, batch->count,
+                          batch->batch_eval_context);
+        result->evaluated = batch->count;
+        result->cpu_time_ms = get_time_ms() - start_time;
+        return EVOCORE_OK;
+    }
+
 #ifdef EVOCORE_HAVE_PTHREADS
     /* Determine thread count */
     if (num_threads <= 0) {
@@ -536,6 +957,474 @@ evocore_error_t evocore_cpu_evaluate_batch(const evocore_eval_batch_t *batch,
     return EVOCORE_OK;
 }
 
+/*========================================================================
+ * Persistent Evaluation Sessions
+ *========================================================================*/
+
+#define EVOCORE_GPU_SESSION_STREAMS 2
+
+struct evocore_gpu_eval_session_s {
+    evocore_gpu_context_t *ctx;
+    size_t max_batch_size;     /* Genomes per pipelined chunk */
+    size_t genome_size;
+    bool device_ready;         /* Persistent device buffers allocated */
+
+#ifdef EVOCORE_HAVE_CUDA
+    cudaStream_t streams[EVOCORE_GPU_SESSION_STREAMS];
+    uint8_t *h_genomes[EVOCORE_GPU_SESSION_STREAMS];    /* Pinned staging */
+    double *h_fitnesses[EVOCORE_GPU_SESSION_STREAMS];   /* Pinned results */
+    void *d_genomes[EVOCORE_GPU_SESSION_STREAMS];
+    void *d_fitnesses[EVOCORE_GPU_SESSION_STREAMS];
+#endif
+};
+
+evocore_gpu_eval_session_t* evocore_gpu_eval_session_create(
+    evocore_gpu_context_t *ctx,
+    size_t max_batch_size,
+    size_t genome_size) {
+
+    if (ctx == NULL || !ctx->initialized ||
+        max_batch_size == 0 || genome_size == 0) {
+        return NULL;
+    }
+
+    evocore_gpu_eval_session_t *session =
+        evocore_calloc(1, sizeof(evocore_gpu_eval_session_t));
+    if (session == NULL) {
+        return NULL;
+    }
+
+    session->ctx = ctx;
+    session->max_batch_size = max_batch_size;
+    session->genome_size = genome_size;
+    session->device_ready = false;
+
+#ifdef EVOCORE_HAVE_CUDA
+    if (ctx->cuda_available && ctx->gpu_enabled) {
+        bool ok = true;
+        size_t genome_bytes = max_batch_size * genome_size;
+        size_t fitness_bytes = max_batch_size * sizeof(double);
+
+        for (int s = 0; ok && s < EVOCORE_GPU_SESSION_STREAMS; s++) {
+            ok = cudaStreamCreate(&session->streams[s]) == cudaSuccess &&
+                 cudaHostAlloc((void**)&session->h_genomes[s], genome_bytes,
+                               cudaHostAllocDefault) == cudaSuccess &&
+                 cudaHostAlloc((void**)&session->h_fitnesses[s], fitness_bytes,
+                               cudaHostAllocDefault) == cudaSuccess &&
+                 cudaMalloc(&session->d_genomes[s], genome_bytes) == cudaSuccess &&
+                 cudaMalloc(&session->d_fitnesses[s], fitness_bytes) == cudaSuccess;
+        }
+
+        if (ok) {
+            session->device_ready = true;
+        } else {
+            /* Keep the session; evaluation falls back to the
+             * per-batch path */
+            evocore_log_warn("GPU session buffer allocation failed, "
+                            "falling back to per-batch transfers");
+            for (int s = 0; s < EVOCORE_GPU_SESSION_STREAMS; s++) {
+                if (session->streams[s]) cudaStreamDestroy(session->streams[s]);
+                if (session->h_genomes[s]) cudaFreeHost(session->h_genomes[s]);
+                if (session->h_fitnesses[s]) cudaFreeHost(session->h_fitnesses[s]);
+                if (session->d_genomes[s]) cudaFree(session->d_genomes[s]);
+                if (session->d_fitnesses[s]) cudaFree(session->d_fitnesses[s]);
+                session->streams[s] = NULL;
+                session->h_genomes[s] = NULL;
+                session->h_fitnesses[s] = NULL;
+                session->d_genomes[s] = NULL;
+                session->d_fitnesses[s] = NULL;
+            }
+        }
+    }
+#endif
+
+    return session;
+}
+
+evocore_error_t evocore_gpu_eval_session_evaluate(
+    evocore_gpu_eval_session_t *session,
+    const evocore_eval_batch_t *batch,
+    evocore_fitness_func_t fitness_func,
+    void *user_context,
+    evocore_eval_result_t *result) {
+
+    if (session == NULL || session->ctx == NULL) {
+        return EVOCORE_ERR_NULL_PTR;
+    }
+    if (batch == NULL || batch->genomes == NULL || batch->fitnesses == NULL) {
+        return EVOCORE_ERR_NULL_PTR;
+    }
+    if (result == NULL) {
+        return EVOCORE_ERR_NULL_PTR;
+    }
+    if (batch->genome_size > session->genome_size) {
+        return EVOCORE_ERR_INVALID_ARG;
+    }
+
+    /* Without persistent device buffers, use the regular path */
+    if (!session->device_ready) {
+        return evocore_gpu_evaluate_batch(session->ctx, batch, fitness_func,
+                                        user_context, result);
+    }
+
+#ifdef EVOCORE_HAVE_CUDA
+    evocore_gpu_context_t *ctx = session->ctx;
+
+    memset(result, 0, sizeof(evocore_eval_result_t));
+    double gpu_start = get_time_ms();
+
+    /* Pipeline chunks round-robin across the streams: while one chunk's
+     * kernel and copies run, the next chunk is staged into the other
+     * stream's pinned buffer */
+    size_t genome_size = session->genome_size;
+    size_t chunk_cap = session->max_batch_size;
+    size_t pending_start[EVOCORE_GPU_SESSION_STREAMS];
+    size_t pending_count[EVOCORE_GPU_SESSION_STREAMS] = {0};
+    bool ok = true;
+
+    size_t chunk_index = 0;
+    for (size_t start = 0; ok && start < batch->count; start += chunk_cap) {
+        size_t count = batch->count - start;
+        if (count > chunk_cap) count = chunk_cap;
+
+        int s = (int)(chunk_index % EVOCORE_GPU_SESSION_STREAMS);
+
+        /* Harvest the chunk previously issued on this stream before
+         * reusing its buffers */
+        if (pending_count[s] > 0) {
+            ok = cudaStreamSynchronize(session->streams[s]) == cudaSuccess;
+            if (ok) {
+                memcpy(batch->fitnesses + pending_start[s],
+                       session->h_fitnesses[s],
+                       pending_count[s] * sizeof(double));
+                result->evaluated += pending_count[s];
+            }
+            pending_count[s] = 0;
+        }
+        if (!ok) break;
+
+        flatten_genome_range(batch, start, count, genome_size,
+                             session->h_genomes[s]);
+
+        ok = cudaMemcpyAsync(session->d_genomes[s], session->h_genomes[s],
+                             count * genome_size, cudaMemcpyHostToDevice,
+                             session->streams[s]) == cudaSuccess;
+        if (ok) {
+            ok = gpu_launch_batch(batch, session->d_genomes[s],
+                                  session->d_fitnesses[s],
+                                  genome_size, (int)count,
+                                  session->streams[s]) > 0;
+        }
+        if (ok) {
+            ok = cudaMemcpyAsync(session->h_fitnesses[s],
+                                 session->d_fitnesses[s],
+                                 count * sizeof(double),
+                                 cudaMemcpyDeviceToHost,
+                                 session->streams[s]) == cudaSuccess;
+        }
+
+        if (ok) {
+            pending_start[s] = start;
+            pending_count[s] = count;
+        }
+        chunk_index++;
+    }
+
+    /* Drain whatever is still in flight */
+    for (int s = 0; s < EVOCORE_GPU_SESSION_STREAMS; s++) {
+        if (pending_count[s] > 0) {
+            if (cudaStreamSynchronize(session->streams[s]) == cudaSuccess && ok) {
+                memcpy(batch->fitnesses + pending_start[s],
+                       session->h_fitnesses[s],
+                       pending_count[s] * sizeof(double));
+                result->evaluated += pending_count[s];
+            }
+            pending_count[s] = 0;
+        }
+    }
+
+    result->gpu_time_ms = get_time_ms() - gpu_start;
+    result->used_gpu = true;
+
+    if (!ok || result->evaluated < batch->count) {
+        snprintf(ctx->last_error, sizeof(ctx->last_error),
+                 "GPU session evaluation failed: %s", cuda_get_error_string());
+        /* Retry the whole batch on the fallback path */
+        return evocore_gpu_evaluate_batch(ctx, batch, fitness_func,
+                                        user_context, result);
+    }
+
+#ifdef EVOCORE_HAVE_PTHREADS
+    pthread_mutex_lock(&ctx->stats_lock);
+#endif
+    ctx->stats.total_evaluations += result->evaluated;
+    ctx->stats.gpu_evaluations += result->evaluated;
+    ctx->stats.total_gpu_time_ms += result->gpu_time_ms;
+    ctx->stats.avg_gpu_time_ms = ctx->stats.total_gpu_time_ms /
+                                 (ctx->stats.gpu_evaluations > 0 ?
+                                  ctx->stats.gpu_evaluations : 1);
+#ifdef EVOCORE_HAVE_PTHREADS
+    pthread_mutex_unlock(&ctx->stats_lock);
+#endif
+
+    return EVOCORE_OK;
+#else
+    return evocore_gpu_evaluate_batch(session->ctx, batch, fitness_func,
+                                    user_context, result);
+#endif
+}
+
+void evocore_gpu_eval_session_destroy(evocore_gpu_eval_session_t *session) {
+    if (session == NULL) {
+        return;
+    }
+
+#ifdef EVOCORE_HAVE_CUDA
+    if (session->device_ready) {
+        for (int s = 0; s < EVOCORE_GPU_SESSION_STREAMS; s++) {
+            cudaStreamSynchronize(session->streams[s]);
+            cudaStreamDestroy(session->streams[s]);
+            cudaFreeHost(session->h_genomes[s]);
+            cudaFreeHost(session->h_fitnesses[s]);
+            cudaFree(session->d_genomes[s]);
+            cudaFree(session->d_fitnesses[s]);
+        }
+    }
+#endif
+
+    evocore_free(session);
+}
+
+/*========================================================================
+ * Pipelined Generation Evaluation
+ *========================================================================*/
+
+static void pipeline_accumulate(evocore_eval_result_t *total,
+                                const evocore_eval_result_t *part) {
+    if (!total) return;
+
+    total->evaluated += part->evaluated;
+    total->gpu_time_ms += part->gpu_time_ms;
+    total->cpu_time_ms += part->cpu_time_ms;
+    total->used_gpu = total->used_gpu || part->used_gpu;
+}
+
+/**
+ * Sequential fallback when no worker thread is available
+ */
+static evocore_error_t gpu_evaluate_pipelined_serial(
+    evocore_gpu_context_t *ctx,
+    evocore_eval_batch_t *staging[2],
+    size_t batch_count,
+    evocore_pipeline_produce_func_t produce,
+    evocore_pipeline_consume_func_t consume,
+    evocore_fitness_func_t fitness_func,
+    void *user_context,
+    evocore_eval_result_t *result) {
+
+    for (size_t i = 0; i < batch_count; i++) {
+        evocore_eval_batch_t *batch = staging[i & 1];
+        EVOCORE_CHECK(produce(batch, i, user_context));
+
+        evocore_eval_result_t part;
+        EVOCORE_CHECK(evocore_gpu_evaluate_batch(ctx, batch, fitness_func,
+                                               user_context, &part));
+        pipeline_accumulate(result, &part);
+
+        if (consume) {
+            EVOCORE_CHECK(consume(batch, i, &part, user_context));
+        }
+    }
+
+    return EVOCORE_OK;
+}
+
+#ifdef EVOCORE_HAVE_PTHREADS
+
+/**
+ * Single-slot handoff between the producing thread and the evaluation
+ * worker: the caller submits one batch at a time and harvests it
+ * before reusing that staging buffer
+ */
+typedef struct {
+    evocore_gpu_context_t *ctx;
+    evocore_fitness_func_t fitness_func;
+    void *user_context;
+
+    pthread_mutex_t lock;
+    pthread_cond_t submit_cond;    /* Signalled when a batch is submitted */
+    pthread_cond_t done_cond;      /* Signalled when a batch completes */
+    evocore_eval_batch_t *inflight;
+    evocore_eval_result_t inflight_result;
+    evocore_error_t inflight_err;
+    bool done;                     /* Completed result awaiting harvest */
+    bool stop;
+} gpu_pipeline_t;
+
+static void* gpu_pipeline_worker(void *arg) {
+    gpu_pipeline_t *pl = (gpu_pipeline_t*)arg;
+
+    pthread_mutex_lock(&pl->lock);
+    for (;;) {
+        while (!pl->inflight && !pl->stop) {
+            pthread_cond_wait(&pl->submit_cond, &pl->lock);
+        }
+        if (!pl->inflight) {
+            break;  /* Stopping with nothing queued */
+        }
+
+        evocore_eval_batch_t *batch = pl->inflight;
+        pthread_mutex_unlock(&pl->lock);
+
+        evocore_eval_result_t part;
+        evocore_error_t err = evocore_gpu_evaluate_batch(pl->ctx, batch,
+                                                       pl->fitness_func,
+                                                       pl->user_context,
+                                                       &part);
+
+        pthread_mutex_lock(&pl->lock);
+        pl->inflight_result = part;
+        pl->inflight_err = err;
+        pl->inflight = NULL;
+        pl->done = true;
+        pthread_cond_signal(&pl->done_cond);
+    }
+    pthread_mutex_unlock(&pl->lock);
+
+    return NULL;
+}
+
+static void gpu_pipeline_submit(gpu_pipeline_t *pl,
+                                evocore_eval_batch_t *batch) {
+    pthread_mutex_lock(&pl->lock);
+    pl->inflight = batch;
+    pl->done = false;
+    pthread_cond_signal(&pl->submit_cond);
+    pthread_mutex_unlock(&pl->lock);
+}
+
+static evocore_error_t gpu_pipeline_wait(gpu_pipeline_t *pl,
+                                     evocore_eval_result_t *part) {
+    pthread_mutex_lock(&pl->lock);
+    while (!pl->done) {
+        pthread_cond_wait(&pl->done_cond, &pl->lock);
+    }
+    *part = pl->inflight_result;
+    evocore_error_t err = pl->inflight_err;
+    pl->done = false;
+    pthread_mutex_unlock(&pl->lock);
+
+    return err;
+}
+
+#endif /* EVOCORE_HAVE_PTHREADS */
+
+evocore_error_t evocore_gpu_evaluate_pipelined(
+    evocore_gpu_context_t *ctx,
+    evocore_eval_batch_t *staging[2],
+    size_t batch_count,
+    evocore_pipeline_produce_func_t produce,
+    evocore_pipeline_consume_func_t consume,
+    evocore_fitness_func_t fitness_func,
+    void *user_context,
+    evocore_eval_result_t *result) {
+
+    if (!ctx || !staging || !staging[0] || !staging[1] || !produce) {
+        return EVOCORE_ERR_NULL_PTR;
+    }
+
+    if (result) {
+        memset(result, 0, sizeof(evocore_eval_result_t));
+    }
+    if (batch_count == 0) {
+        return EVOCORE_OK;
+    }
+
+#ifdef EVOCORE_HAVE_PTHREADS
+    gpu_pipeline_t pl;
+    memset(&pl, 0, sizeof(pl));
+    pl.ctx = ctx;
+    pl.fitness_func = fitness_func;
+    pl.user_context = user_context;
+    pthread_mutex_init(&pl.lock, NULL);
+    pthread_cond_init(&pl.submit_cond, NULL);
+    pthread_cond_init(&pl.done_cond, NULL);
+
+    pthread_t worker;
+    if (pthread_create(&worker, NULL, gpu_pipeline_worker, &pl) != 0) {
+        pthread_mutex_destroy(&pl.lock);
+        pthread_cond_destroy(&pl.submit_cond);
+        pthread_cond_destroy(&pl.done_cond);
+        return gpu_evaluate_pipelined_serial(ctx, staging, batch_count,
+                                             produce, consume, fitness_func,
+                                             user_context, result);
+    }
+
+    /* While sub-batch i runs on the worker, this thread harvests i-1
+     * and produces i+1 into the other staging buffer */
+    evocore_error_t err = EVOCORE_OK;
+    bool pending = false;
+    size_t pending_index = 0;
+
+    for (size_t i = 0; i < batch_count; i++) {
+        evocore_eval_batch_t *batch = staging[i & 1];
+
+        err = produce(batch, i, user_context);
+        if (err != EVOCORE_OK) break;
+
+        if (pending) {
+            evocore_eval_result_t part;
+            err = gpu_pipeline_wait(&pl, &part);
+            if (err == EVOCORE_OK) {
+                pipeline_accumulate(result, &part);
+                if (consume) {
+                    err = consume(staging[pending_index & 1], pending_index,
+                                  &part, user_context);
+                }
+            }
+            pending = false;
+            if (err != EVOCORE_OK) break;
+        }
+
+        gpu_pipeline_submit(&pl, batch);
+        pending = true;
+        pending_index = i;
+    }
+
+    /* Drain the last sub-batch still in flight */
+    if (pending) {
+        evocore_eval_result_t part;
+        evocore_error_t drain_err = gpu_pipeline_wait(&pl, &part);
+        if (err == EVOCORE_OK) {
+            err = drain_err;
+        }
+        if (drain_err == EVOCORE_OK) {
+            pipeline_accumulate(result, &part);
+            if (consume && err == EVOCORE_OK) {
+                err = consume(staging[pending_index & 1], pending_index,
+                              &part, user_context);
+            }
+        }
+    }
+
+    pthread_mutex_lock(&pl.lock);
+    pl.stop = true;
+    pthread_cond_signal(&pl.submit_cond);
+    pthread_mutex_unlock(&pl.lock);
+    pthread_join(worker, NULL);
+
+    pthread_mutex_destroy(&pl.lock);
+    pthread_cond_destroy(&pl.submit_cond);
+    pthread_cond_destroy(&pl.done_cond);
+
+    return err;
+#else
+    return gpu_evaluate_pipelined_serial(ctx, staging, batch_count, produce,
+                                         consume, fitness_func, user_context,
+                                         result);
+#endif
+}
+
 /*========================================================================
  * Memory Management (Stubs for CPU fallback)
  *========================================================================*/
@@ -684,6 +1573,165 @@ bool evocore_gpu_batch_fits(const evocore_gpu_context_t *ctx,
     return required <= dev->free_memory;
 }
 
+/*========================================================================
+ * Batch Size Autotuning (public API)
+ *========================================================================*/
+
+/* Display name used to key persisted entries (CPU-executed batches
+ * have no device) */
+static const char* gpu_autotune_device_name(const evocore_gpu_context_t *ctx,
+                                            int device_id) {
+    if (device_id < 0 || device_id >= ctx->device_count) {
+        return "cpu";
+    }
+    return ctx->devices[device_id].name;
+}
+
+size_t evocore_gpu_autotune_batch_size(evocore_gpu_context_t *ctx,
+                                     evocore_gpu_kernel_launch_t kernel,
+                                     size_t genome_size) {
+    if (ctx == NULL || !ctx->initialized || genome_size == 0) {
+        return evocore_gpu_recommend_batch_size(ctx, genome_size);
+    }
+
+#ifdef EVOCORE_HAVE_PTHREADS
+    pthread_mutex_lock(&ctx->stats_lock);
+#endif
+    gpu_autotune_entry_t *e = gpu_autotune_find(ctx, kernel, genome_size, true);
+    size_t size = e != NULL ? e->current_size
+                            : evocore_gpu_recommend_batch_size(ctx, genome_size);
+#ifdef EVOCORE_HAVE_PTHREADS
+    pthread_mutex_unlock(&ctx->stats_lock);
+#endif
+    return size;
+}
+
+bool evocore_gpu_autotune_converged(const evocore_gpu_context_t *ctx,
+                                  evocore_gpu_kernel_launch_t kernel,
+                                  size_t genome_size) {
+    if (ctx == NULL || !ctx->initialized) {
+        return false;
+    }
+
+    /* Lookup without create does not mutate; cast away const like
+     * the mutex would require anyway */
+    evocore_gpu_context_t *mctx = (evocore_gpu_context_t*)ctx;
+#ifdef EVOCORE_HAVE_PTHREADS
+    pthread_mutex_lock(&mctx->stats_lock);
+#endif
+    gpu_autotune_entry_t *e = gpu_autotune_find(mctx, kernel, genome_size, false);
+    bool converged = e != NULL && e->converged;
+#ifdef EVOCORE_HAVE_PTHREADS
+    pthread_mutex_unlock(&mctx->stats_lock);
+#endif
+    return converged;
+}
+
+bool evocore_gpu_autotune_save(const evocore_gpu_context_t *ctx,
+                             const char *path) {
+    if (ctx == NULL || !ctx->initialized || path == NULL) {
+        return false;
+    }
+
+    FILE *f = fopen(path, "w");
+    if (f == NULL) {
+        return false;
+    }
+
+    fprintf(f, "evocore-gpu-autotune 1\n");
+    for (int i = 0; i < GPU_AUTOTUNE_ENTRIES; i++) {
+        const gpu_autotune_entry_t *e = &ctx->autotune[i];
+        if (!e->in_use || e->tuned_throughput <= 0.0) {
+            continue;
+        }
+
+        /* Kernel pointers are meaningless in a file: collapse entries
+         * for the same device and genome size, keeping the one with
+         * the best measured throughput */
+        bool best = true;
+        for (int j = 0; j < GPU_AUTOTUNE_ENTRIES; j++) {
+            const gpu_autotune_entry_t *o = &ctx->autotune[j];
+            if (j == i || !o->in_use ||
+                o->device_id != e->device_id ||
+                o->genome_size != e->genome_size) {
+                continue;
+            }
+            if (o->tuned_throughput > e->tuned_throughput ||
+                (o->tuned_throughput == e->tuned_throughput && j < i)) {
+                best = false;
+                break;
+            }
+        }
+        if (!best) {
+            continue;
+        }
+
+        fprintf(f, "%s\t%zu\t%zu\t%.3f\n",
+                gpu_autotune_device_name(ctx, e->device_id),
+                e->genome_size, e->tuned_size, e->tuned_throughput);
+    }
+
+    fclose(f);
+    return true;
+}
+
+bool evocore_gpu_autotune_load(evocore_gpu_context_t *ctx, const char *path) {
+    if (ctx == NULL || !ctx->initialized || path == NULL) {
+        return false;
+    }
+
+    FILE *f = fopen(path, "r");
+    if (f == NULL) {
+        return false;
+    }
+
+    char line[512];
+    if (fgets(line, sizeof(line), f) == NULL ||
+        strncmp(line, "evocore-gpu-autotune", 20) != 0) {
+        fclose(f);
+        return false;
+    }
+
+    int device_id = ctx->cuda_available ? ctx->current_device : -1;
+    const char *device_name = gpu_autotune_device_name(ctx, device_id);
+
+#ifdef EVOCORE_HAVE_PTHREADS
+    pthread_mutex_lock(&ctx->stats_lock);
+#endif
+    while (fgets(line, sizeof(line), f) != NULL) {
+        char name[256];
+        size_t genome_size = 0, tuned_size = 0;
+        double throughput = 0.0;
+        if (sscanf(line, "%255[^\t]\t%zu\t%zu\t%lf",
+                   name, &genome_size, &tuned_size, &throughput) != 4) {
+            continue;
+        }
+        /* Only entries for the device we are running on apply */
+        if (strcmp(name, device_name) != 0 ||
+            genome_size == 0 || tuned_size == 0) {
+            continue;
+        }
+
+        gpu_autotune_entry_t *e = gpu_autotune_find(ctx, NULL, genome_size,
+                                                    true);
+        if (e == NULL) {
+            continue;
+        }
+        e->kernel = NULL;
+        e->current_size = tuned_size;
+        e->tuned_size = tuned_size;
+        e->tuned_throughput = throughput;
+        e->converged = true;
+        e->seeded = true;
+    }
+#ifdef EVOCORE_HAVE_PTHREADS
+    pthread_mutex_unlock(&ctx->stats_lock);
+#endif
+
+    fclose(f);
+    return true;
+}
+
 evocore_error_t evocore_gpu_synchronize(evocore_gpu_context_t *ctx) {
     if (ctx == NULL || !ctx->initialized) {
         return EVOCORE_ERR_NULL_PTR;
@@ -748,3 +1796,17 @@ bool evocore_gpu_get_enabled(const evocore_gpu_context_t *ctx) {
     }
     return ctx->gpu_enabled;
 }
+
+void evocore_gpu_set_sharding(evocore_gpu_context_t *ctx, bool enabled) {
+    if (ctx == NULL || !ctx->initialized) {
+        return;
+    }
+    ctx->sharding_enabled = enabled;
+}
+
+bool evocore_gpu_get_sharding(const evocore_gpu_context_t *ctx) {
+    if (ctx == NULL || !ctx->initialized) {
+        return false;
+    }
+    return ctx->sharding_enabled;
+}
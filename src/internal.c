@@ -4,16 +4,27 @@
 #include <string.h>
 #include <ctype.h>
 #include <stdio.h>
+#include <malloc.h>
+#include <math.h>
+#include <stdint.h>
 
 /*========================================================================
  * Memory Allocation Wrappers
  *========================================================================*/
 
+/*
+ * Tracked sizes come from malloc_usable_size so frees can be
+ * accounted without per-block headers - the value is consistent
+ * between allocation and free for the same block.
+ */
+
 void* evocore_malloc(size_t size) {
     if (size == 0) return NULL;
     void *ptr = malloc(size);
     if (ptr == NULL) {
         fprintf(stderr, "evocore: Failed to allocate %zu bytes\n", size);
+    } else {
+        evocore_memory_track_alloc(malloc_usable_size(ptr));
     }
     return ptr;
 }
@@ -24,19 +35,32 @@ void* evocore_calloc(size_t count, size_t size) {
     if (ptr == NULL) {
         fprintf(stderr, "evocore: Failed to allocate %zu elements of %zu bytes\n",
                 count, size);
+    } else {
+        evocore_memory_track_alloc(malloc_usable_size(ptr));
     }
     return ptr;
 }
 
 void* evocore_realloc(void *ptr, size_t size) {
+    size_t old_size = ptr != NULL ? malloc_usable_size(ptr) : 0;
     void *new_ptr = realloc(ptr, size);
     if (new_ptr == NULL && size > 0) {
         fprintf(stderr, "evocore: Failed to reallocate to %zu bytes\n", size);
+        return NULL;
+    }
+    if (ptr != NULL) {
+        evocore_memory_track_free(old_size);
+    }
+    if (new_ptr != NULL) {
+        evocore_memory_track_alloc(malloc_usable_size(new_ptr));
     }
     return new_ptr;
 }
 
 void evocore_free(void *ptr) {
+    if (ptr != NULL) {
+        evocore_memory_track_free(malloc_usable_size(ptr));
+    }
     free(ptr);
 }
 
@@ -86,3 +110,326 @@ char* evocore_string_trim_newline(char *str) {
     }
     return str;
 }
+
+/*========================================================================
+ * Fast Number Formatting
+ *========================================================================*/
+
+/* Power-of-ten table covering the exponents stats values live in;
+ * anything outside falls back to pow() */
+static double pow10i(int e) {
+    static const double table[16] = {
+        1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7,
+        1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15
+    };
+    if (e >= 0 && e < 16) return table[e];
+    if (e > -16 && e < 0) return 1.0 / table[-e];
+    return pow(10.0, e);
+}
+
+size_t evocore_format_double(char *buf, double value) {
+    /* Specials and extreme exponents take the slow path */
+    if (!isfinite(value)) {
+        return (size_t)snprintf(buf, 32, "%.6g", value);
+    }
+
+    char *p = buf;
+    if (signbit(value)) {
+        *p++ = '-';
+        value = -value;
+    }
+    if (value == 0.0) {
+        *p++ = '0';
+        return (size_t)(p - buf);
+    }
+
+    int e = (int)floor(log10(value));
+    if (e < -290 || e > 290) {
+        /* Scaling would overflow; rare enough not to matter */
+        return (size_t)snprintf(buf, 32, "%.6g", value);
+    }
+
+    /* Round to 6 significant digits as an integer in [100000, 999999] */
+    uint64_t digits = (uint64_t)(value * pow10i(5 - e) + 0.5);
+    if (digits >= 1000000) {
+        e++;
+        digits = (uint64_t)(value * pow10i(5 - e) + 0.5);
+    } else if (digits < 100000) {
+        e--;
+        digits = (uint64_t)(value * pow10i(5 - e) + 0.5);
+    }
+
+    /* Strip trailing zeros (the %g convention) */
+    int ndig = 6;
+    while (ndig > 1 && digits % 10 == 0) {
+        digits /= 10;
+        ndig--;
+    }
+
+    char dbuf[8];
+    for (int i = ndig - 1; i >= 0; i--) {
+        dbuf[i] = (char)('0' + (digits % 10));
+        digits /= 10;
+    }
+
+    if (e >= -4 && e < 6) {
+        /* Fixed notation */
+        if (e >= ndig - 1) {
+            memcpy(p, dbuf, (size_t)ndig);
+            p += ndig;
+            for (int i = 0; i < e - (ndig - 1); i++) *p++ = '0';
+        } else if (e >= 0) {
+            memcpy(p, dbuf, (size_t)(e + 1));
+            p += e + 1;
+            *p++ = '.';
+            memcpy(p, dbuf + e + 1, (size_t)(ndig - e - 1));
+            p += ndig - e - 1;
+        } else {
+            *p++ = '0';
+            *p++ = '.';
+            for (int i = 0; i < -e - 1; i++) *p++ = '0';
+            memcpy(p, dbuf, (size_t)ndig);
+            p += ndig;
+        }
+    } else {
+        /* Exponential notation, %g style: d.ddddde[+-]XX */
+        *p++ = dbuf[0];
+        if (ndig > 1) {
+            *p++ = '.';
+            memcpy(p, dbuf + 1, (size_t)(ndig - 1));
+            p += ndig - 1;
+        }
+        *p++ = 'e';
+        int ae = e;
+        if (ae < 0) {
+            *p++ = '-';
+            ae = -ae;
+        } else {
+            *p++ = '+';
+        }
+        if (ae >= 100) {
+            *p++ = (char)('0' + ae / 100);
+            ae %= 100;
+        }
+        *p++ = (char)('0' + ae / 10);
+        *p++ = (char)('0' + ae % 10);
+    }
+
+    return (size_t)(p - buf);
+}
+
+/*========================================================================
+ * Streaming JSON Reader
+ *========================================================================*/
+
+bool evocore_json_reader_init(evocore_json_reader_t *reader, FILE *f,
+                              evocore_arena_t *arena, size_t buf_size) {
+    if (!reader || !f || !arena || buf_size == 0) return false;
+
+    memset(reader, 0, sizeof(*reader));
+    reader->buf = evocore_malloc(buf_size);
+    if (!reader->buf) return false;
+
+    reader->f = f;
+    reader->arena = arena;
+    reader->buf_size = buf_size;
+    return true;
+}
+
+void evocore_json_reader_cleanup(evocore_json_reader_t *reader) {
+    if (!reader) return;
+    evocore_free(reader->buf);
+    evocore_free(reader->scratch);
+    memset(reader, 0, sizeof(*reader));
+}
+
+/* Raw next byte, or -1 at EOF */
+static int json_next_byte(evocore_json_reader_t *reader) {
+    if (reader->pos >= reader->len) {
+        if (reader->eof) return -1;
+        reader->len = fread(reader->buf, 1, reader->buf_size, reader->f);
+        reader->pos = 0;
+        if (reader->len == 0) {
+            reader->eof = true;
+            return -1;
+        }
+    }
+    return (unsigned char)reader->buf[reader->pos++];
+}
+
+static int json_peek_byte(evocore_json_reader_t *reader) {
+    int c = json_next_byte(reader);
+    if (c >= 0) reader->pos--;
+    return c;
+}
+
+int evocore_json_peek(evocore_json_reader_t *reader) {
+    for (;;) {
+        int c = json_peek_byte(reader);
+        if (c != ' ' && c != '\t' && c != '\n' && c != '\r') {
+            return c;
+        }
+        reader->pos++;
+    }
+}
+
+bool evocore_json_expect(evocore_json_reader_t *reader, char c) {
+    if (evocore_json_peek(reader) != (unsigned char)c) return false;
+    reader->pos++;
+    return true;
+}
+
+bool evocore_json_try(evocore_json_reader_t *reader, char c) {
+    if (evocore_json_peek(reader) != (unsigned char)c) return false;
+    reader->pos++;
+    return true;
+}
+
+static bool json_scratch_put(evocore_json_reader_t *reader, size_t *len,
+                             char c) {
+    if (*len + 4 >= reader->scratch_cap) {
+        size_t new_cap = reader->scratch_cap ? reader->scratch_cap * 2 : 256;
+        char *grown = evocore_realloc(reader->scratch, new_cap);
+        if (!grown) return false;
+        reader->scratch = grown;
+        reader->scratch_cap = new_cap;
+    }
+    reader->scratch[(*len)++] = c;
+    return true;
+}
+
+static int json_hex_nibble(int c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+char* evocore_json_read_string(evocore_json_reader_t *reader) {
+    if (!evocore_json_expect(reader, '"')) return NULL;
+
+    size_t len = 0;
+    for (;;) {
+        int c = json_next_byte(reader);
+        if (c < 0) return NULL;
+        if (c == '"') break;
+
+        if (c != '\\') {
+            if (!json_scratch_put(reader, &len, (char)c)) return NULL;
+            continue;
+        }
+
+        c = json_next_byte(reader);
+        switch (c) {
+            case '"': case '\\': case '/':
+                if (!json_scratch_put(reader, &len, (char)c)) return NULL;
+                break;
+            case 'b': if (!json_scratch_put(reader, &len, '\b')) return NULL; break;
+            case 'f': if (!json_scratch_put(reader, &len, '\f')) return NULL; break;
+            case 'n': if (!json_scratch_put(reader, &len, '\n')) return NULL; break;
+            case 'r': if (!json_scratch_put(reader, &len, '\r')) return NULL; break;
+            case 't': if (!json_scratch_put(reader, &len, '\t')) return NULL; break;
+            case 'u': {
+                unsigned cp = 0;
+                for (int i = 0; i < 4; i++) {
+                    int nib = json_hex_nibble(json_next_byte(reader));
+                    if (nib < 0) return NULL;
+                    cp = (cp << 4) | (unsigned)nib;
+                }
+                /* UTF-8 encode (BMP only; our writers never emit
+                 * surrogate pairs) */
+                if (cp < 0x80) {
+                    if (!json_scratch_put(reader, &len, (char)cp)) return NULL;
+                } else if (cp < 0x800) {
+                    if (!json_scratch_put(reader, &len, (char)(0xC0 | (cp >> 6))) ||
+                        !json_scratch_put(reader, &len, (char)(0x80 | (cp & 0x3F)))) {
+                        return NULL;
+                    }
+                } else {
+                    if (!json_scratch_put(reader, &len, (char)(0xE0 | (cp >> 12))) ||
+                        !json_scratch_put(reader, &len, (char)(0x80 | ((cp >> 6) & 0x3F))) ||
+                        !json_scratch_put(reader, &len, (char)(0x80 | (cp & 0x3F)))) {
+                        return NULL;
+                    }
+                }
+                break;
+            }
+            default:
+                return NULL;
+        }
+    }
+
+    char *str = evocore_arena_alloc(reader->arena, len + 1);
+    if (!str) return NULL;
+    if (len > 0) memcpy(str, reader->scratch, len);
+    str[len] = '\0';
+    return str;
+}
+
+bool evocore_json_read_number(evocore_json_reader_t *reader, double *out) {
+    if (!out) return false;
+    evocore_json_peek(reader);  /* Position on the first token byte */
+
+    /* Collect the token: number characters plus the nan/inf spellings
+     * the %g-compatible formatter produces */
+    char token[64];
+    size_t len = 0;
+    for (;;) {
+        int c = json_peek_byte(reader);
+        if (c < 0) break;
+        if (!strchr("+-0123456789.eE", c) &&
+            !strchr("nafiNAFI", c)) {
+            break;
+        }
+        if (len + 1 >= sizeof(token)) return false;
+        token[len++] = (char)c;
+        reader->pos++;
+    }
+    if (len == 0) return false;
+    token[len] = '\0';
+
+    char *end = NULL;
+    *out = strtod(token, &end);
+    return end == token + len;
+}
+
+bool evocore_json_skip_value(evocore_json_reader_t *reader) {
+    int c = evocore_json_peek(reader);
+    switch (c) {
+        case '"': {
+            size_t mark = evocore_arena_snapshot(reader->arena);
+            if (!evocore_json_read_string(reader)) return false;
+            evocore_arena_rewind(reader->arena, mark);
+            return true;
+        }
+        case '{':
+        case '[': {
+            char close = c == '{' ? '}' : ']';
+            reader->pos++;
+            if (evocore_json_try(reader, close)) return true;
+            for (;;) {
+                if (c == '{') {
+                    size_t mark = evocore_arena_snapshot(reader->arena);
+                    if (!evocore_json_read_string(reader)) return false;
+                    evocore_arena_rewind(reader->arena, mark);
+                    if (!evocore_json_expect(reader, ':')) return false;
+                }
+                if (!evocore_json_skip_value(reader)) return false;
+                if (evocore_json_try(reader, close)) return true;
+                if (!evocore_json_expect(reader, ',')) return false;
+            }
+        }
+        case 't': case 'f': case 'n':
+        case '-': case '0': case '1': case '2': case '3': case '4':
+        case '5': case '6': case '7': case '8': case '9': {
+            /* Literal or number: consume the bare token */
+            for (;;) {
+                int b = json_peek_byte(reader);
+                if (b < 0 || strchr(",]}\" \t\n\r", b)) return true;
+                reader->pos++;
+            }
+        }
+        default:
+            return false;
+    }
+}
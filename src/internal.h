@@ -3,6 +3,9 @@
 
 #include <stddef.h>
 #include <stdbool.h>
+#include <stdio.h>
+
+#include "evocore/arena.h"
 
 /**
  * Internal shared definitions for evocore
@@ -19,6 +22,15 @@ void* evocore_calloc(size_t count, size_t size);
 void* evocore_realloc(void *ptr, size_t size);
 void evocore_free(void *ptr);
 
+/**
+ * Memory tracking hooks (memory.c)
+ *
+ * Called by the allocation wrappers with the usable block size.
+ * No-ops unless evocore_memory_set_tracking is on.
+ */
+void evocore_memory_track_alloc(size_t size);
+void evocore_memory_track_free(size_t size);
+
 /**
  * String utilities
  */
@@ -27,4 +39,57 @@ bool evocore_string_equals(const char *a, const char *b);
 char* evocore_string_trim(char *str);
 char* evocore_string_trim_newline(char *str);
 
+/**
+ * Fast %.6g-compatible double formatter
+ *
+ * Several times faster than snprintf for the bulk numeric output in
+ * the JSON save paths. buf must hold at least 32 bytes; returns the
+ * number of characters written (no NUL). Falls back to snprintf for
+ * specials and extreme exponents.
+ */
+size_t evocore_format_double(char *buf, double value);
+
+/**
+ * Streaming JSON reader
+ *
+ * Pull tokenizer over a FILE* that reads fixed-size chunks, so large
+ * state files parse in bounded memory instead of being slurped whole.
+ * Strings are allocated from the caller's arena; callers that insert
+ * entries as they parse can snapshot/rewind the arena per entry to
+ * keep peak usage at one entry's worth.
+ */
+typedef struct {
+    FILE *f;
+    evocore_arena_t *arena;  /* String allocations */
+    char *buf;               /* Chunk buffer */
+    size_t buf_size;
+    size_t len;              /* Valid bytes in buf */
+    size_t pos;              /* Read cursor */
+    bool eof;
+    char *scratch;           /* Reused string-assembly buffer */
+    size_t scratch_cap;
+} evocore_json_reader_t;
+
+bool evocore_json_reader_init(evocore_json_reader_t *reader, FILE *f,
+                              evocore_arena_t *arena, size_t buf_size);
+void evocore_json_reader_cleanup(evocore_json_reader_t *reader);
+
+/** Next non-whitespace character without consuming it, or -1 at EOF */
+int evocore_json_peek(evocore_json_reader_t *reader);
+
+/** Consume the next non-whitespace character, failing unless it is c */
+bool evocore_json_expect(evocore_json_reader_t *reader, char c);
+
+/** Consume the next non-whitespace character if it is c */
+bool evocore_json_try(evocore_json_reader_t *reader, char c);
+
+/** Parse a quoted string into the arena (standard escapes + \\uXXXX) */
+char* evocore_json_read_string(evocore_json_reader_t *reader);
+
+/** Parse a number (accepts the nan/inf spellings %g produces) */
+bool evocore_json_read_number(evocore_json_reader_t *reader, double *out);
+
+/** Skip one value of any type, including nested containers */
+bool evocore_json_skip_value(evocore_json_reader_t *reader);
+
 #endif /* EVOCORE_INTERNAL_H */
@@ -0,0 +1,347 @@
+#define _GNU_SOURCE
+#include "evocore/island.h"
+#include "evocore/memory.h"
+#include "evocore/log.h"
+#include "internal.h"
+#include <string.h>
+#include <stdlib.h>
+#include <math.h>
+#include <sched.h>
+#include <unistd.h>
+#include <pthread.h>
+
+/*========================================================================
+ * Migration Rings
+ *========================================================================*/
+
+/**
+ * In-flight migrant
+ *
+ * The genome is a clone owned by the ring slot until the destination
+ * island consumes it.
+ */
+typedef struct {
+    evocore_genome_t *genome;
+    double fitness;
+} island_migrant_t;
+
+/**
+ * Single-producer/single-consumer migrant ring
+ *
+ * Written only by the upstream island's thread and read only by the
+ * owning island's thread, so head and tail each have one writer and
+ * plain atomic loads/stores suffice (no CAS loops, no locks).
+ */
+typedef struct {
+    island_migrant_t *slots;
+    size_t capacity;              /* Power of two */
+    size_t head;                  /* Consumer position (advanced by owner) */
+    size_t tail;                  /* Producer position (advanced by neighbor) */
+} migration_ring_t;
+
+struct evocore_island_model_t {
+    evocore_island_config_t config;
+    evocore_population_t *islands;     /* num_islands populations */
+    migration_ring_t *inboxes;        /* One inbox ring per island */
+    size_t *generation_count;         /* Steps taken per island */
+};
+
+static size_t round_up_pow2(size_t n) {
+    size_t p = 1;
+    while (p < n) p <<= 1;
+    return p;
+}
+
+/* Producer side: called from the upstream island's thread only */
+static bool ring_push(migration_ring_t *ring, evocore_genome_t *genome,
+                      double fitness) {
+    size_t tail = __atomic_load_n(&ring->tail, __ATOMIC_RELAXED);
+    size_t head = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+
+    if (tail - head >= ring->capacity) {
+        return false;  /* Full - caller drops the migrant */
+    }
+
+    island_migrant_t *slot = &ring->slots[tail & (ring->capacity - 1)];
+    slot->genome = genome;
+    slot->fitness = fitness;
+
+    __atomic_store_n(&ring->tail, tail + 1, __ATOMIC_RELEASE);
+    return true;
+}
+
+/* Consumer side: called from the owning island's thread only */
+static bool ring_pop(migration_ring_t *ring, island_migrant_t *out) {
+    size_t head = __atomic_load_n(&ring->head, __ATOMIC_RELAXED);
+    size_t tail = __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE);
+
+    if (head == tail) {
+        return false;  /* Empty */
+    }
+
+    *out = ring->slots[head & (ring->capacity - 1)];
+    __atomic_store_n(&ring->head, head + 1, __ATOMIC_RELEASE);
+    return true;
+}
+
+/*========================================================================
+ * Model Lifecycle
+ *========================================================================*/
+
+evocore_island_model_t* evocore_island_model_create(
+        const evocore_island_config_t *config) {
+    evocore_island_config_t defaults = EVOCORE_ISLAND_DEFAULTS;
+    if (!config) config = &defaults;
+
+    if (config->num_islands == 0 || config->island_capacity == 0 ||
+        config->migration_interval == 0 || config->ring_capacity == 0) {
+        return NULL;
+    }
+
+    evocore_island_model_t *model = evocore_calloc(1, sizeof(*model));
+    if (!model) return NULL;
+
+    model->config = *config;
+    model->config.ring_capacity = round_up_pow2(config->ring_capacity);
+
+    model->islands = evocore_calloc(config->num_islands,
+                                    sizeof(evocore_population_t));
+    model->inboxes = evocore_calloc(config->num_islands,
+                                    sizeof(migration_ring_t));
+    model->generation_count = evocore_calloc(config->num_islands,
+                                             sizeof(size_t));
+    if (!model->islands || !model->inboxes || !model->generation_count) {
+        goto fail;
+    }
+
+    for (size_t i = 0; i < config->num_islands; i++) {
+        if (evocore_population_init(&model->islands[i],
+                                    config->island_capacity) != EVOCORE_OK) {
+            for (size_t j = 0; j < i; j++) {
+                evocore_population_cleanup(&model->islands[j]);
+            }
+            goto fail;
+        }
+    }
+
+    for (size_t i = 0; i < config->num_islands; i++) {
+        model->inboxes[i].slots = evocore_calloc(model->config.ring_capacity,
+                                                 sizeof(island_migrant_t));
+        if (!model->inboxes[i].slots) {
+            for (size_t j = 0; j < config->num_islands; j++) {
+                evocore_population_cleanup(&model->islands[j]);
+                evocore_free(model->inboxes[j].slots);
+            }
+            goto fail;
+        }
+        model->inboxes[i].capacity = model->config.ring_capacity;
+    }
+
+    evocore_log_info("Island model created: %zu islands, capacity %zu, "
+                     "migrate %zu every %zu generations",
+                     config->num_islands, config->island_capacity,
+                     config->migration_count, config->migration_interval);
+    return model;
+
+fail:
+    evocore_free(model->generation_count);
+    evocore_free(model->inboxes);
+    evocore_free(model->islands);
+    evocore_free(model);
+    return NULL;
+}
+
+void evocore_island_model_destroy(evocore_island_model_t *model) {
+    if (!model) return;
+
+    for (size_t i = 0; i < model->config.num_islands; i++) {
+        /* Drain migrants that were never consumed */
+        island_migrant_t migrant;
+        while (ring_pop(&model->inboxes[i], &migrant)) {
+            evocore_genome_cleanup(migrant.genome);
+            evocore_free(migrant.genome);
+        }
+        evocore_free(model->inboxes[i].slots);
+        evocore_population_cleanup(&model->islands[i]);
+    }
+
+    evocore_free(model->generation_count);
+    evocore_free(model->inboxes);
+    evocore_free(model->islands);
+    evocore_free(model);
+}
+
+evocore_population_t* evocore_island_population(evocore_island_model_t *model,
+                                             size_t island) {
+    if (!model || island >= model->config.num_islands) return NULL;
+    return &model->islands[island];
+}
+
+/*========================================================================
+ * Migration
+ *========================================================================*/
+
+/* Find the indices of the k fittest individuals by linear scan -
+ * migration_count is small, so this beats sorting the population. */
+static size_t find_top_k(const evocore_population_t *pop, size_t k,
+                         size_t *out_indices) {
+    size_t found = 0;
+
+    for (size_t want = 0; want < k; want++) {
+        double best = -INFINITY;
+        size_t best_idx = (size_t)-1;
+
+        for (size_t i = 0; i < pop->size; i++) {
+            double f = pop->individuals[i].fitness;
+            if (isnan(f) || f <= best) continue;
+
+            bool taken = false;
+            for (size_t j = 0; j < found; j++) {
+                if (out_indices[j] == i) { taken = true; break; }
+            }
+            if (!taken) {
+                best = f;
+                best_idx = i;
+            }
+        }
+
+        if (best_idx == (size_t)-1) break;
+        out_indices[found++] = best_idx;
+    }
+
+    return found;
+}
+
+/* Replace the current worst individual with an immigrant when the
+ * immigrant is fitter. The migrant genome is always freed here - the
+ * population clones on replace. */
+static void island_immigrate(evocore_population_t *pop,
+                             island_migrant_t *migrant) {
+    evocore_population_refresh_stats(pop);
+
+    size_t worst_idx = (size_t)-1;
+    double worst = INFINITY;
+    for (size_t i = 0; i < pop->size; i++) {
+        double f = pop->individuals[i].fitness;
+        if (isnan(f)) { worst_idx = i; break; }
+        if (f < worst) {
+            worst = f;
+            worst_idx = i;
+        }
+    }
+
+    if (pop->size < pop->capacity) {
+        evocore_population_add(pop, migrant->genome, migrant->fitness);
+    } else if (worst_idx != (size_t)-1 &&
+               (isnan(pop->individuals[worst_idx].fitness) ||
+                migrant->fitness > pop->individuals[worst_idx].fitness)) {
+        evocore_population_replace(pop, worst_idx, migrant->genome,
+                                   migrant->fitness);
+    }
+
+    evocore_genome_cleanup(migrant->genome);
+    evocore_free(migrant->genome);
+}
+
+evocore_error_t evocore_island_step(evocore_island_model_t *model,
+                                size_t island) {
+    if (!model) return EVOCORE_ERR_NULL_PTR;
+    if (island >= model->config.num_islands) return EVOCORE_ERR_INVALID_ARG;
+
+    evocore_population_t *pop = &model->islands[island];
+    model->generation_count[island]++;
+
+    /* Drain this island's inbox */
+    island_migrant_t migrant;
+    while (ring_pop(&model->inboxes[island], &migrant)) {
+        island_immigrate(pop, &migrant);
+    }
+
+    /* Emigrate to the downstream neighbor every K generations */
+    if (model->config.num_islands > 1 && model->config.migration_count > 0 &&
+        model->generation_count[island] % model->config.migration_interval == 0) {
+        size_t next = (island + 1) % model->config.num_islands;
+        migration_ring_t *outbox = &model->inboxes[next];
+
+        size_t indices[16];
+        size_t k = model->config.migration_count;
+        if (k > sizeof(indices) / sizeof(indices[0])) {
+            k = sizeof(indices) / sizeof(indices[0]);
+        }
+        k = find_top_k(pop, k, indices);
+
+        for (size_t i = 0; i < k; i++) {
+            evocore_individual_t *ind = &pop->individuals[indices[i]];
+
+            evocore_genome_t *clone = evocore_malloc(sizeof(evocore_genome_t));
+            if (!clone) return EVOCORE_ERR_OUT_OF_MEMORY;
+
+            if (evocore_genome_clone(ind->genome, clone) != EVOCORE_OK) {
+                evocore_free(clone);
+                return EVOCORE_ERR_OUT_OF_MEMORY;
+            }
+
+            if (!ring_push(outbox, clone, ind->fitness)) {
+                /* Neighbor's inbox is full - drop rather than block */
+                evocore_genome_cleanup(clone);
+                evocore_free(clone);
+                break;
+            }
+        }
+    }
+
+    return EVOCORE_OK;
+}
+
+/*========================================================================
+ * Thread Placement & Monitoring
+ *========================================================================*/
+
+evocore_error_t evocore_island_pin_thread(evocore_island_model_t *model,
+                                      size_t island) {
+    if (!model) return EVOCORE_ERR_NULL_PTR;
+    if (island >= model->config.num_islands) return EVOCORE_ERR_INVALID_ARG;
+
+#ifdef __linux__
+    long num_cores = sysconf(_SC_NPROCESSORS_ONLN);
+    if (num_cores < 1) num_cores = 1;
+
+    cpu_set_t cpuset;
+    CPU_ZERO(&cpuset);
+    CPU_SET((int)(island % (size_t)num_cores), &cpuset);
+
+    if (pthread_setaffinity_np(pthread_self(), sizeof(cpuset), &cpuset) != 0) {
+        evocore_log_warn("Failed to pin island %zu thread", island);
+        return EVOCORE_ERR_INVALID_ARG;
+    }
+    return EVOCORE_OK;
+#else
+    (void)island;
+    return EVOCORE_OK;  /* Affinity is best-effort off Linux */
+#endif
+}
+
+evocore_error_t evocore_island_model_best(const evocore_island_model_t *model,
+                                      double *out_fitness,
+                                      size_t *out_island) {
+    if (!model) return EVOCORE_ERR_NULL_PTR;
+
+    double best = -INFINITY;
+    size_t best_island = 0;
+    bool found = false;
+
+    for (size_t i = 0; i < model->config.num_islands; i++) {
+        const evocore_population_t *pop = &model->islands[i];
+        if (pop->valid_count == 0) continue;
+        if (!found || pop->best_fitness > best) {
+            best = pop->best_fitness;
+            best_island = i;
+            found = true;
+        }
+    }
+
+    if (!found) return EVOCORE_ERR_INVALID_ARG;
+    if (out_fitness) *out_fitness = best;
+    if (out_island) *out_island = best_island;
+    return EVOCORE_OK;
+}
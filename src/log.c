@@ -1,3 +1,4 @@
+#define _GNU_SOURCE
 #include "evocore/log.h"
 #include "internal.h"
 #include <stdio.h>
@@ -6,6 +7,11 @@
 #include <time.h>
 #include <string.h>
 
+#ifdef EVOCORE_HAVE_PTHREADS
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
 /*========================================================================
  * Log State
  *========================================================================*/
@@ -28,6 +34,151 @@ static const char *g_color_levels[] = {
     "\033[35m",  /* FATAL - Magenta */
 };
 
+/*========================================================================
+ * Async Backend
+ *========================================================================*/
+
+/**
+ * Formatted line size; longer messages are truncated
+ */
+#define LOG_LINE_MAX 256
+
+#ifdef EVOCORE_HAVE_PTHREADS
+
+#define LOG_RING_SIZE 1024  /* Slots (power of two) */
+
+/**
+ * One published log line
+ *
+ * seq is a Vyukov-style sequence stamp: a slot is free for ticket t
+ * when seq == t, published when seq == t + 1, and recycled for the
+ * next lap when the consumer stores t + LOG_RING_SIZE.
+ */
+typedef struct {
+    uint64_t seq;
+    evocore_log_level_t level;
+    int prefix_len;             /* Colored portion (timestamp/level/file) */
+    char text[LOG_LINE_MAX];
+} log_slot_t;
+
+/*
+ * Multi-producer ring between logging threads and the flusher. The
+ * flusher is normally the only consumer, but a producer that finds
+ * the ring full claims and discards the oldest unread entry itself
+ * (drop-oldest), so consume must also be multi-consumer safe - hence
+ * the CAS on tail.
+ */
+static log_slot_t g_log_ring[LOG_RING_SIZE];
+static uint64_t g_log_head;
+static uint64_t g_log_tail;
+static uint64_t g_log_dropped;
+static bool g_log_async;        /* Producers check with __atomic */
+static bool g_log_stop;
+static pthread_t g_log_flusher;
+
+/* Claim the entry at tail; false when the ring is empty */
+static bool log_ring_consume(log_slot_t *out) {
+    for (;;) {
+        uint64_t pos = __atomic_load_n(&g_log_tail, __ATOMIC_ACQUIRE);
+        log_slot_t *slot = &g_log_ring[pos & (LOG_RING_SIZE - 1)];
+        uint64_t seq = __atomic_load_n(&slot->seq, __ATOMIC_ACQUIRE);
+
+        if (seq == pos + 1) {
+            if (__atomic_compare_exchange_n(&g_log_tail, &pos, pos + 1,
+                                            false, __ATOMIC_ACQ_REL,
+                                            __ATOMIC_RELAXED)) {
+                if (out != NULL) {
+                    *out = *slot;
+                }
+                __atomic_store_n(&slot->seq, pos + LOG_RING_SIZE,
+                                 __ATOMIC_RELEASE);
+                return true;
+            }
+            /* Lost the race; retry with the new tail */
+        } else if (seq <= pos) {
+            return false;  /* Empty (or a producer is mid-write) */
+        }
+    }
+}
+
+/* Publish one formatted line; never blocks on I/O */
+static void log_ring_publish(evocore_log_level_t level, int prefix_len,
+                             const char *text) {
+    uint64_t ticket = __atomic_fetch_add(&g_log_head, 1, __ATOMIC_ACQ_REL);
+    log_slot_t *slot = &g_log_ring[ticket & (LOG_RING_SIZE - 1)];
+
+    /* Wait for the slot to come around to this lap; when the ring is
+     * full that means discarding the oldest unread entry ourselves */
+    while (__atomic_load_n(&slot->seq, __ATOMIC_ACQUIRE) != ticket) {
+        uint64_t tail = __atomic_load_n(&g_log_tail, __ATOMIC_ACQUIRE);
+        if (ticket - tail >= LOG_RING_SIZE) {
+            if (log_ring_consume(NULL)) {
+                __atomic_fetch_add(&g_log_dropped, 1, __ATOMIC_RELAXED);
+            }
+        }
+        /* Otherwise another thread is mid-slot; spin briefly */
+    }
+
+    slot->level = level;
+    slot->prefix_len = prefix_len;
+    size_t len = strlen(text);
+    if (len >= LOG_LINE_MAX) {
+        len = LOG_LINE_MAX - 1;
+    }
+    memcpy(slot->text, text, len);
+    slot->text[len] = '\0';
+    __atomic_store_n(&slot->seq, ticket + 1, __ATOMIC_RELEASE);
+}
+
+#endif /* EVOCORE_HAVE_PTHREADS */
+
+/* Write one formatted line to the console and log file */
+static void log_emit(evocore_log_level_t level, int prefix_len,
+                     const char *line) {
+    if (g_log_color && prefix_len > 0 && prefix_len <= (int)strlen(line)) {
+        fprintf(stderr, "%s%.*s%s%s\n",
+                g_color_levels[level], prefix_len, line,
+                g_color_reset, line + prefix_len);
+    } else {
+        fprintf(stderr, "%s\n", line);
+    }
+
+    if (g_log_file != NULL) {
+        fprintf(g_log_file, "%s\n", line);
+        fflush(g_log_file);
+    }
+
+    if (level == EVOCORE_LOG_FATAL) {
+        fflush(stderr);
+    }
+}
+
+#ifdef EVOCORE_HAVE_PTHREADS
+
+static void* log_flusher_main(void *arg) {
+    (void)arg;
+    log_slot_t slot;
+
+    while (!__atomic_load_n(&g_log_stop, __ATOMIC_ACQUIRE)) {
+        bool any = false;
+        while (log_ring_consume(&slot)) {
+            log_emit(slot.level, slot.prefix_len, slot.text);
+            any = true;
+        }
+        if (!any) {
+            usleep(1000);
+        }
+    }
+
+    /* Final drain after stop */
+    while (log_ring_consume(&slot)) {
+        log_emit(slot.level, slot.prefix_len, slot.text);
+    }
+    return NULL;
+}
+
+#endif /* EVOCORE_HAVE_PTHREADS */
+
 /*========================================================================
  * Public API
  *========================================================================*/
@@ -70,6 +221,50 @@ void evocore_log_close(void) {
     }
 }
 
+bool evocore_log_set_async(bool enabled) {
+#ifdef EVOCORE_HAVE_PTHREADS
+    if (enabled) {
+        if (__atomic_load_n(&g_log_async, __ATOMIC_ACQUIRE)) {
+            return true;
+        }
+
+        for (uint64_t i = 0; i < LOG_RING_SIZE; i++) {
+            g_log_ring[i].seq = i;
+        }
+        g_log_head = 0;
+        g_log_tail = 0;
+        g_log_stop = false;
+
+        if (pthread_create(&g_log_flusher, NULL, log_flusher_main, NULL) != 0) {
+            return false;
+        }
+        __atomic_store_n(&g_log_async, true, __ATOMIC_RELEASE);
+        return true;
+    }
+
+    if (!__atomic_load_n(&g_log_async, __ATOMIC_ACQUIRE)) {
+        return true;
+    }
+
+    /* New messages go synchronous again, then drain and join */
+    __atomic_store_n(&g_log_async, false, __ATOMIC_RELEASE);
+    __atomic_store_n(&g_log_stop, true, __ATOMIC_RELEASE);
+    pthread_join(g_log_flusher, NULL);
+    return true;
+#else
+    (void)enabled;
+    return false;
+#endif
+}
+
+uint64_t evocore_log_dropped(void) {
+#ifdef EVOCORE_HAVE_PTHREADS
+    return __atomic_load_n(&g_log_dropped, __ATOMIC_RELAXED);
+#else
+    return 0;
+#endif
+}
+
 void evocore_log_message(evocore_log_level_t level,
                        const char *file,
                        int line,
@@ -93,38 +288,34 @@ void evocore_log_message(evocore_log_level_t level,
         filename = last_slash + 1;
     }
 
-    /* Format the message */
-    va_list args;
-    va_start(args, fmt);
+    /* Format the full line into a thread-local buffer so the async
+     * path never touches shared state before publishing */
+#ifdef EVOCORE_HAVE_PTHREADS
+    static __thread char line_buf[LOG_LINE_MAX];
+#else
+    static char line_buf[LOG_LINE_MAX];
+#endif
 
-    /* Console output */
-    if (g_log_color) {
-        fprintf(stderr, "%s%s %-5s %s:%d%s ",
-                g_color_levels[level], time_buf,
-                g_log_level_names[level], filename, line,
-                g_color_reset);
-    } else {
-        fprintf(stderr, "%s %-5s %s:%d ",
-                time_buf, g_log_level_names[level], filename, line);
+    int prefix_len = snprintf(line_buf, sizeof(line_buf), "%s %-5s %s:%d ",
+                              time_buf, g_log_level_names[level],
+                              filename, line);
+    if (prefix_len < 0 || prefix_len >= (int)sizeof(line_buf)) {
+        prefix_len = (int)sizeof(line_buf) - 1;
     }
 
-    vfprintf(stderr, fmt, args);
-    fprintf(stderr, "\n");
+    va_list args;
+    va_start(args, fmt);
+    vsnprintf(line_buf + prefix_len, sizeof(line_buf) - prefix_len, fmt, args);
     va_end(args);
 
-    /* File output (no colors) */
-    if (g_log_file != NULL) {
-        va_start(args, fmt);
-        fprintf(g_log_file, "%s %-5s %s:%d ",
-                time_buf, g_log_level_names[level], filename, line);
-        vfprintf(g_log_file, fmt, args);
-        fprintf(g_log_file, "\n");
-        fflush(g_log_file);
-        va_end(args);
+#ifdef EVOCORE_HAVE_PTHREADS
+    /* FATAL exits right after logging, so it always flushes inline */
+    if (level != EVOCORE_LOG_FATAL &&
+        __atomic_load_n(&g_log_async, __ATOMIC_ACQUIRE)) {
+        log_ring_publish(level, prefix_len, line_buf);
+        return;
     }
+#endif
 
-    /* Flush for fatal errors */
-    if (level == EVOCORE_LOG_FATAL) {
-        fflush(stderr);
-    }
+    log_emit(level, prefix_len, line_buf);
 }
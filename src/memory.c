@@ -5,28 +5,122 @@
 #define _GNU_SOURCE
 #include "evocore/memory.h"
 #include "evocore/log.h"
+#include "internal.h"
 #include <stdio.h>
 #include <string.h>
+#include <stdint.h>
 
 /*========================================================================
  * Memory Tracking State
  *========================================================================*/
 
-static struct {
-    bool enabled;
-    size_t total_allocated;
-    size_t current_allocated;
-    size_t peak_allocated;
-    size_t allocation_count;
-    size_t free_count;
-} g_memory_tracking = {
-    .enabled = false,
-    .total_allocated = 0,
-    .current_allocated = 0,
-    .peak_allocated = 0,
-    .allocation_count = 0,
-    .free_count = 0
-};
+/**
+ * Number of per-thread counter slots
+ *
+ * Each thread claims one slot on its first tracked operation; threads
+ * beyond the limit share the last slot. Slots are never reclaimed so
+ * counts from exited threads keep contributing to the aggregate.
+ */
+#define MEMORY_TRACK_SLOTS 128
+
+/**
+ * Per-thread counters, one cache line each
+ *
+ * Every tracked alloc/free updates only its own thread's slot with
+ * relaxed atomics, so 32 evaluation threads never ping-pong a shared
+ * line. current_allocated is a signed delta: a thread that frees
+ * blocks allocated elsewhere goes negative and the aggregate stays
+ * correct. evocore_memory_get_stats sums the slots on read.
+ */
+typedef struct {
+    uint64_t total_allocated;
+    int64_t current_allocated;
+    uint64_t allocation_count;
+    uint64_t free_count;
+    char pad[64 - 4 * sizeof(uint64_t)];
+} __attribute__((aligned(64))) memory_track_slot_t;
+
+static memory_track_slot_t g_track_slots[MEMORY_TRACK_SLOTS];
+static size_t g_track_slot_next;
+static bool g_track_enabled;
+static uint64_t g_track_peak;  /* Sampled at aggregation points */
+
+static __thread memory_track_slot_t *tls_track_slot;
+
+/* Claim this thread's counter slot on first use */
+static memory_track_slot_t* memory_track_slot(void) {
+    if (tls_track_slot == NULL) {
+        size_t idx = __atomic_fetch_add(&g_track_slot_next, 1,
+                                        __ATOMIC_RELAXED);
+        if (idx >= MEMORY_TRACK_SLOTS) {
+            idx = MEMORY_TRACK_SLOTS - 1;  /* Shared overflow slot */
+        }
+        tls_track_slot = &g_track_slots[idx];
+    }
+    return tls_track_slot;
+}
+
+void evocore_memory_track_alloc(size_t size) {
+    if (!__atomic_load_n(&g_track_enabled, __ATOMIC_RELAXED)) {
+        return;
+    }
+    memory_track_slot_t *slot = memory_track_slot();
+    __atomic_fetch_add(&slot->total_allocated, size, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&slot->current_allocated, (int64_t)size,
+                       __ATOMIC_RELAXED);
+    __atomic_fetch_add(&slot->allocation_count, 1, __ATOMIC_RELAXED);
+}
+
+void evocore_memory_track_free(size_t size) {
+    if (!__atomic_load_n(&g_track_enabled, __ATOMIC_RELAXED)) {
+        return;
+    }
+    memory_track_slot_t *slot = memory_track_slot();
+    __atomic_fetch_sub(&slot->current_allocated, (int64_t)size,
+                       __ATOMIC_RELAXED);
+    __atomic_fetch_add(&slot->free_count, 1, __ATOMIC_RELAXED);
+}
+
+/* Sum every slot; also advances the sampled peak */
+static void memory_track_aggregate(evocore_memory_stats_t *stats) {
+    uint64_t total = 0, allocs = 0, frees = 0;
+    int64_t current = 0;
+
+    size_t used = __atomic_load_n(&g_track_slot_next, __ATOMIC_RELAXED);
+    if (used > MEMORY_TRACK_SLOTS) {
+        used = MEMORY_TRACK_SLOTS;
+    }
+
+    for (size_t i = 0; i < used; i++) {
+        memory_track_slot_t *slot = &g_track_slots[i];
+        total += __atomic_load_n(&slot->total_allocated, __ATOMIC_RELAXED);
+        current += __atomic_load_n(&slot->current_allocated, __ATOMIC_RELAXED);
+        allocs += __atomic_load_n(&slot->allocation_count, __ATOMIC_RELAXED);
+        frees += __atomic_load_n(&slot->free_count, __ATOMIC_RELAXED);
+    }
+
+    if (current < 0) {
+        current = 0;  /* Frees observed before their allocs */
+    }
+
+    /* Peak is sampled whenever the aggregate is computed */
+    uint64_t peak = __atomic_load_n(&g_track_peak, __ATOMIC_RELAXED);
+    while ((uint64_t)current > peak &&
+           !__atomic_compare_exchange_n(&g_track_peak, &peak,
+                                        (uint64_t)current, false,
+                                        __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+        /* Retry with the updated peak */
+    }
+    if ((uint64_t)current > peak) {
+        peak = (uint64_t)current;
+    }
+
+    stats->total_allocated = (size_t)total;
+    stats->current_allocated = (size_t)current;
+    stats->peak_allocated = (size_t)peak;
+    stats->allocation_count = (size_t)allocs;
+    stats->free_count = (size_t)frees;
+}
 
 /*========================================================================
  * Memory Management Functions
@@ -36,46 +130,56 @@ void evocore_memory_get_stats(evocore_memory_stats_t *stats) {
     if (!stats) {
         return;
     }
-
-    stats->total_allocated = g_memory_tracking.total_allocated;
-    stats->current_allocated = g_memory_tracking.current_allocated;
-    stats->peak_allocated = g_memory_tracking.peak_allocated;
-    stats->allocation_count = g_memory_tracking.allocation_count;
-    stats->free_count = g_memory_tracking.free_count;
+    memory_track_aggregate(stats);
 }
 
 void evocore_memory_reset_stats(void) {
-    g_memory_tracking.total_allocated = 0;
-    g_memory_tracking.current_allocated = 0;
-    g_memory_tracking.peak_allocated = 0;
-    g_memory_tracking.allocation_count = 0;
-    g_memory_tracking.free_count = 0;
+    size_t used = __atomic_load_n(&g_track_slot_next, __ATOMIC_RELAXED);
+    if (used > MEMORY_TRACK_SLOTS) {
+        used = MEMORY_TRACK_SLOTS;
+    }
+    for (size_t i = 0; i < used; i++) {
+        memory_track_slot_t *slot = &g_track_slots[i];
+        __atomic_store_n(&slot->total_allocated, 0, __ATOMIC_RELAXED);
+        __atomic_store_n(&slot->current_allocated, 0, __ATOMIC_RELAXED);
+        __atomic_store_n(&slot->allocation_count, 0, __ATOMIC_RELAXED);
+        __atomic_store_n(&slot->free_count, 0, __ATOMIC_RELAXED);
+    }
+    __atomic_store_n(&g_track_peak, 0, __ATOMIC_RELAXED);
 }
 
 void evocore_memory_set_tracking(bool enable) {
-    g_memory_tracking.enabled = enable;
+    __atomic_store_n(&g_track_enabled, enable, __ATOMIC_RELEASE);
 }
 
 size_t evocore_memory_check_leaks(void) {
-    /* Current allocations that haven't been freed */
-    if (g_memory_tracking.enabled) {
-        size_t leaked = g_memory_tracking.allocation_count - g_memory_tracking.free_count;
-        return leaked;
+    if (!__atomic_load_n(&g_track_enabled, __ATOMIC_RELAXED)) {
+        return 0;
     }
-    return 0;
+    evocore_memory_stats_t stats;
+    memory_track_aggregate(&stats);
+    if (stats.allocation_count <= stats.free_count) {
+        return 0;
+    }
+    return stats.allocation_count - stats.free_count;
 }
 
 void evocore_memory_dump_stats(void) {
+    evocore_memory_stats_t stats;
+    memory_track_aggregate(&stats);
+
+    bool enabled = __atomic_load_n(&g_track_enabled, __ATOMIC_RELAXED);
+
     evocore_log_info("=== Memory Statistics ===");
-    evocore_log_info("Tracking: %s", g_memory_tracking.enabled ? "enabled" : "disabled");
-    evocore_log_info("Total Allocated: %zu bytes", g_memory_tracking.total_allocated);
-    evocore_log_info("Current Allocated: %zu bytes", g_memory_tracking.current_allocated);
-    evocore_log_info("Peak Allocated: %zu bytes", g_memory_tracking.peak_allocated);
-    evocore_log_info("Allocations: %zu", g_memory_tracking.allocation_count);
-    evocore_log_info("Frees: %zu", g_memory_tracking.free_count);
-
-    if (g_memory_tracking.enabled && g_memory_tracking.allocation_count > g_memory_tracking.free_count) {
+    evocore_log_info("Tracking: %s", enabled ? "enabled" : "disabled");
+    evocore_log_info("Total Allocated: %zu bytes", stats.total_allocated);
+    evocore_log_info("Current Allocated: %zu bytes", stats.current_allocated);
+    evocore_log_info("Peak Allocated: %zu bytes", stats.peak_allocated);
+    evocore_log_info("Allocations: %zu", stats.allocation_count);
+    evocore_log_info("Frees: %zu", stats.free_count);
+
+    if (enabled && stats.allocation_count > stats.free_count) {
         evocore_log_warn("Potential leaks: %zu allocations",
-                        g_memory_tracking.allocation_count - g_memory_tracking.free_count);
+                        stats.allocation_count - stats.free_count);
     }
 }
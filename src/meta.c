@@ -322,6 +322,53 @@ static int compare_meta_individuals(const void *a, const void *b) {
     return 0;
 }
 
+static void swap_meta_individuals(evocore_meta_individual_t *a,
+                                  evocore_meta_individual_t *b) {
+    evocore_meta_individual_t tmp = *a;
+    *a = *b;
+    *b = tmp;
+}
+
+/* Quickselect: after the call the k fittest individuals occupy [0, k)
+ * in arbitrary order. The evolve step only needs the elite and the
+ * replacement tail identified, not a full O(n log n) ordering. */
+static void meta_select_top(evocore_meta_individual_t *arr, int n, int k) {
+    if (k <= 0 || k >= n) return;
+
+    int lo = 0, hi = n - 1;
+    while (lo < hi) {
+        /* Median of lo/mid/hi, parked at hi as the pivot */
+        int mid = lo + (hi - lo) / 2;
+        if (compare_meta_individuals(&arr[mid], &arr[lo]) < 0) {
+            swap_meta_individuals(&arr[lo], &arr[mid]);
+        }
+        if (compare_meta_individuals(&arr[hi], &arr[lo]) < 0) {
+            swap_meta_individuals(&arr[lo], &arr[hi]);
+        }
+        if (compare_meta_individuals(&arr[hi], &arr[mid]) < 0) {
+            swap_meta_individuals(&arr[mid], &arr[hi]);
+        }
+        swap_meta_individuals(&arr[mid], &arr[hi]);
+
+        const evocore_meta_individual_t pivot = arr[hi];
+        int store = lo;
+        for (int i = lo; i < hi; i++) {
+            if (compare_meta_individuals(&arr[i], &pivot) < 0) {
+                swap_meta_individuals(&arr[i], &arr[store]);
+                store++;
+            }
+        }
+        swap_meta_individuals(&arr[store], &arr[hi]);
+
+        if (store >= k) {
+            if (store == k) break;
+            hi = store - 1;
+        } else {
+            lo = store + 1;
+        }
+    }
+}
+
 evocore_error_t evocore_meta_population_init(evocore_meta_population_t *meta_pop,
                                           int size,
                                           unsigned int *seed) {
@@ -399,8 +446,33 @@ evocore_error_t evocore_meta_population_evolve(evocore_meta_population_t *meta_p
 
     unsigned int local_seed = seed ? *seed : (unsigned int)time(NULL);
 
-    /* Sort by fitness */
-    evocore_meta_population_sort(meta_pop);
+    /* Elitism: keep top 30% */
+    int elite_count = (int)(meta_pop->count * 0.3);
+    if (elite_count < 1) elite_count = 1;
+
+    /* Replace bottom 50% with children of elite */
+    int replace_start = meta_pop->count - (int)(meta_pop->count * 0.5);
+
+    /* Partial selection instead of a full sort: two O(n) partitions
+     * push the bottom half to the tail and the elite to the front.
+     * Order within each band doesn't matter - parents are drawn
+     * randomly from the elite - so the O(n log n) comparison work of
+     * evocore_meta_population_sort is skipped. */
+    meta_select_top(meta_pop->individuals, meta_pop->count, replace_start);
+    meta_select_top(meta_pop->individuals, replace_start, elite_count);
+
+    /* Move the best of the elite to the front */
+    int best_idx = 0;
+    for (int i = 1; i < elite_count; i++) {
+        if (compare_meta_individuals(&meta_pop->individuals[i],
+                                     &meta_pop->individuals[best_idx]) < 0) {
+            best_idx = i;
+        }
+    }
+    if (best_idx != 0) {
+        swap_meta_individuals(&meta_pop->individuals[0],
+                              &meta_pop->individuals[best_idx]);
+    }
 
     /* Update best */
     evocore_meta_individual_t *best = &meta_pop->individuals[0];
@@ -409,13 +481,6 @@ evocore_error_t evocore_meta_population_evolve(evocore_meta_population_t *meta_p
         evocore_meta_params_clone(&best->params, &meta_pop->best_params);
     }
 
-    /* Elitism: keep top 30% */
-    int elite_count = (int)(meta_pop->count * 0.3);
-    if (elite_count < 1) elite_count = 1;
-
-    /* Replace bottom 50% with children of elite */
-    int replace_start = meta_pop->count - (int)(meta_pop->count * 0.5);
-
     for (int i = replace_start; i < meta_pop->count; i++) {
         /* Select two parents from elite */
         int p1 = rand_r(&local_seed) % elite_count;
@@ -0,0 +1,542 @@
+/**
+ * Evocore Distributed Meta-Evolution Implementation
+ *
+ * Poll-driven TCP coordinator plus a blocking worker loop. The
+ * coordinator is single-threaded: accept, task assignment, and result
+ * application all happen inside evocore_meta_coordinator_poll so no
+ * locking is needed around the meta-population.
+ */
+
+#define _GNU_SOURCE
+#include "evocore/meta_dist.h"
+#include "internal.h"
+#include "evocore/log.h"
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+#include <netdb.h>
+
+/*========================================================================
+ * Wire Protocol
+ *========================================================================*/
+
+#define META_DIST_MAGIC 0x45564d44u  /* "EVMD" */
+#define META_DIST_VERSION 1
+
+#define META_DIST_MAX_WORKERS 64
+
+enum {
+    MSG_HELLO = 1,      /* worker -> coord: version + sizeof(params) */
+    MSG_TASK = 2,       /* coord -> worker: task id + raw params */
+    MSG_RESULT = 3,     /* worker -> coord: task id + fitness */
+    MSG_SHUTDOWN = 4    /* coord -> worker: no payload */
+};
+
+typedef struct {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t type;
+    uint32_t payload_size;
+} msg_header_t;
+
+typedef struct {
+    uint16_t version;
+    uint16_t reserved;
+    uint32_t params_size;   /* sizeof(evocore_meta_params_t) on the worker */
+} msg_hello_t;
+
+typedef struct {
+    uint32_t task_id;
+    evocore_meta_params_t params;
+} msg_task_t;
+
+typedef struct {
+    uint32_t task_id;
+    double fitness;
+} msg_result_t;
+
+/*========================================================================
+ * Coordinator State
+ *========================================================================*/
+
+typedef struct {
+    int individual;         /* Index into the meta-population */
+    bool queued;            /* Waiting for a worker */
+    bool done;              /* Result applied */
+} dist_task_t;
+
+typedef struct {
+    int fd;                 /* -1 when slot is free */
+    bool ready;             /* Handshake completed */
+    int task;               /* In-flight task index, -1 if idle */
+} dist_worker_t;
+
+struct evocore_meta_coordinator {
+    evocore_meta_population_t *meta_pop;
+    int listen_fd;
+    uint16_t port;
+
+    dist_worker_t workers[META_DIST_MAX_WORKERS];
+
+    dist_task_t *tasks;
+    size_t task_count;
+    size_t tasks_remaining;
+
+    evocore_meta_coordinator_stats_t stats;
+};
+
+/*========================================================================
+ * Socket Helpers
+ *========================================================================*/
+
+/* Blocking exact-length I/O; short transfers only happen on EOF/error */
+static bool sock_read_full(int fd, void *buf, size_t size) {
+    char *p = (char*)buf;
+    while (size > 0) {
+        ssize_t n = read(fd, p, size);
+        if (n <= 0) {
+            if (n < 0 && errno == EINTR) continue;
+            return false;
+        }
+        p += n;
+        size -= (size_t)n;
+    }
+    return true;
+}
+
+static bool sock_write_full(int fd, const void *buf, size_t size) {
+    const char *p = (const char*)buf;
+    while (size > 0) {
+        /* MSG_NOSIGNAL: a peer dropping mid-send must surface as EPIPE
+         * so the disconnect/requeue path runs, not kill us with
+         * SIGPIPE */
+        ssize_t n = send(fd, p, size, MSG_NOSIGNAL);
+        if (n <= 0) {
+            if (n < 0 && errno == EINTR) continue;
+            return false;
+        }
+        p += n;
+        size -= (size_t)n;
+    }
+    return true;
+}
+
+static bool sock_send_msg(int fd, uint16_t type, const void *payload,
+                          size_t payload_size) {
+    msg_header_t header;
+    header.magic = META_DIST_MAGIC;
+    header.version = META_DIST_VERSION;
+    header.type = type;
+    header.payload_size = (uint32_t)payload_size;
+
+    if (!sock_write_full(fd, &header, sizeof(header))) return false;
+    if (payload_size > 0 && !sock_write_full(fd, payload, payload_size)) {
+        return false;
+    }
+    return true;
+}
+
+static bool sock_recv_header(int fd, msg_header_t *header) {
+    if (!sock_read_full(fd, header, sizeof(*header))) return false;
+    return header->magic == META_DIST_MAGIC &&
+           header->version == META_DIST_VERSION;
+}
+
+static double dist_now_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e3 + ts.tv_nsec / 1e6;
+}
+
+/*========================================================================
+ * Coordinator
+ *========================================================================*/
+
+evocore_meta_coordinator_t* evocore_meta_coordinator_create(
+    evocore_meta_population_t *meta_pop,
+    uint16_t port
+) {
+    if (!meta_pop || !meta_pop->initialized) return NULL;
+
+    evocore_meta_coordinator_t *coord =
+        evocore_calloc(1, sizeof(evocore_meta_coordinator_t));
+    if (!coord) return NULL;
+
+    coord->meta_pop = meta_pop;
+    for (int i = 0; i < META_DIST_MAX_WORKERS; i++) {
+        coord->workers[i].fd = -1;
+        coord->workers[i].task = -1;
+    }
+
+    coord->listen_fd = socket(AF_INET, SOCK_STREAM, 0);
+    if (coord->listen_fd < 0) {
+        evocore_log_error("Coordinator socket() failed: %s", strerror(errno));
+        evocore_free(coord);
+        return NULL;
+    }
+
+    int one = 1;
+    setsockopt(coord->listen_fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+
+    struct sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_ANY);
+    addr.sin_port = htons(port);
+
+    if (bind(coord->listen_fd, (struct sockaddr*)&addr, sizeof(addr)) < 0 ||
+        listen(coord->listen_fd, META_DIST_MAX_WORKERS) < 0) {
+        evocore_log_error("Coordinator bind/listen failed: %s",
+                          strerror(errno));
+        close(coord->listen_fd);
+        evocore_free(coord);
+        return NULL;
+    }
+
+    socklen_t addr_len = sizeof(addr);
+    if (getsockname(coord->listen_fd, (struct sockaddr*)&addr,
+                    &addr_len) == 0) {
+        coord->port = ntohs(addr.sin_port);
+    }
+
+    evocore_log_info("Meta coordinator listening on port %u", coord->port);
+    return coord;
+}
+
+uint16_t evocore_meta_coordinator_port(
+    const evocore_meta_coordinator_t *coord
+) {
+    return coord ? coord->port : 0;
+}
+
+evocore_error_t evocore_meta_coordinator_dispatch(
+    evocore_meta_coordinator_t *coord,
+    int trials_per_individual
+) {
+    if (!coord) return EVOCORE_ERR_NULL_PTR;
+    if (trials_per_individual < 1) return EVOCORE_ERR_INVALID_ARG;
+    if (coord->tasks_remaining > 0) {
+        return EVOCORE_ERR_INVALID_ARG;  /* Previous dispatch unfinished */
+    }
+
+    size_t count = (size_t)coord->meta_pop->count *
+                   (size_t)trials_per_individual;
+    dist_task_t *tasks = evocore_calloc(count, sizeof(dist_task_t));
+    if (!tasks) return EVOCORE_ERR_OUT_OF_MEMORY;
+
+    evocore_free(coord->tasks);
+    coord->tasks = tasks;
+    coord->task_count = count;
+    coord->tasks_remaining = count;
+
+    size_t t = 0;
+    for (int i = 0; i < coord->meta_pop->count; i++) {
+        for (int r = 0; r < trials_per_individual; r++) {
+            coord->tasks[t].individual = i;
+            coord->tasks[t].queued = true;
+            t++;
+        }
+    }
+
+    return EVOCORE_OK;
+}
+
+/* Hand the next queued task to an idle, ready worker */
+static void coord_assign_task(evocore_meta_coordinator_t *coord,
+                              dist_worker_t *worker) {
+    for (size_t t = 0; t < coord->task_count; t++) {
+        if (!coord->tasks[t].queued) continue;
+
+        msg_task_t msg;
+        msg.task_id = (uint32_t)t;
+        msg.params =
+            coord->meta_pop->individuals[coord->tasks[t].individual].params;
+
+        if (!sock_send_msg(worker->fd, MSG_TASK, &msg, sizeof(msg))) {
+            return;  /* Poll loop will reap the broken connection */
+        }
+
+        coord->tasks[t].queued = false;
+        worker->task = (int)t;
+        coord->stats.tasks_dispatched++;
+        return;
+    }
+}
+
+static void coord_drop_worker(evocore_meta_coordinator_t *coord,
+                              dist_worker_t *worker) {
+    if (worker->task >= 0 && !coord->tasks[worker->task].done) {
+        coord->tasks[worker->task].queued = true;
+        coord->stats.tasks_requeued++;
+        evocore_log_warn("Worker dropped, requeueing task %d", worker->task);
+    }
+    close(worker->fd);
+    worker->fd = -1;
+    worker->ready = false;
+    worker->task = -1;
+    coord->stats.workers_connected--;
+}
+
+static void coord_handle_worker(evocore_meta_coordinator_t *coord,
+                                dist_worker_t *worker) {
+    msg_header_t header;
+    if (!sock_recv_header(worker->fd, &header)) {
+        coord_drop_worker(coord, worker);
+        return;
+    }
+
+    if (header.type == MSG_HELLO && header.payload_size == sizeof(msg_hello_t)) {
+        msg_hello_t hello;
+        if (!sock_read_full(worker->fd, &hello, sizeof(hello)) ||
+            hello.version != META_DIST_VERSION ||
+            hello.params_size != sizeof(evocore_meta_params_t)) {
+            evocore_log_warn("Worker handshake mismatch, dropping");
+            coord_drop_worker(coord, worker);
+            return;
+        }
+        worker->ready = true;
+        return;
+    }
+
+    if (header.type == MSG_RESULT &&
+        header.payload_size == sizeof(msg_result_t)) {
+        msg_result_t result;
+        if (!sock_read_full(worker->fd, &result, sizeof(result)) ||
+            result.task_id >= coord->task_count ||
+            worker->task != (int)result.task_id) {
+            coord_drop_worker(coord, worker);
+            return;
+        }
+
+        dist_task_t *task = &coord->tasks[result.task_id];
+        if (!task->done) {
+            evocore_meta_individual_t *ind =
+                &coord->meta_pop->individuals[task->individual];
+            evocore_meta_individual_record_fitness(ind, result.fitness);
+            ind->meta_fitness =
+                evocore_meta_individual_average_fitness(ind);
+            task->done = true;
+            coord->tasks_remaining--;
+            coord->stats.results_applied++;
+        }
+        worker->task = -1;
+        return;
+    }
+
+    evocore_log_warn("Unexpected message type %u from worker", header.type);
+    coord_drop_worker(coord, worker);
+}
+
+evocore_error_t evocore_meta_coordinator_poll(
+    evocore_meta_coordinator_t *coord,
+    int timeout_ms,
+    size_t *out_pending
+) {
+    if (!coord) return EVOCORE_ERR_NULL_PTR;
+
+    struct pollfd fds[META_DIST_MAX_WORKERS + 1];
+    dist_worker_t *fd_worker[META_DIST_MAX_WORKERS + 1];
+    nfds_t nfds = 0;
+
+    fds[nfds].fd = coord->listen_fd;
+    fds[nfds].events = POLLIN;
+    fd_worker[nfds] = NULL;
+    nfds++;
+
+    for (int i = 0; i < META_DIST_MAX_WORKERS; i++) {
+        if (coord->workers[i].fd < 0) continue;
+        fds[nfds].fd = coord->workers[i].fd;
+        fds[nfds].events = POLLIN;
+        fd_worker[nfds] = &coord->workers[i];
+        nfds++;
+    }
+
+    int n = poll(fds, nfds, timeout_ms);
+    if (n < 0 && errno != EINTR) {
+        return EVOCORE_ERR_NET;
+    }
+
+    for (nfds_t i = 0; n > 0 && i < nfds; i++) {
+        if (!(fds[i].revents & (POLLIN | POLLHUP | POLLERR))) continue;
+
+        if (fd_worker[i] == NULL) {
+            /* New worker connection */
+            int fd = accept(coord->listen_fd, NULL, NULL);
+            if (fd < 0) continue;
+
+            int slot = -1;
+            for (int w = 0; w < META_DIST_MAX_WORKERS; w++) {
+                if (coord->workers[w].fd < 0) { slot = w; break; }
+            }
+            if (slot < 0) {
+                evocore_log_warn("Worker limit reached, refusing connection");
+                close(fd);
+                continue;
+            }
+
+            int one = 1;
+            setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+            coord->workers[slot].fd = fd;
+            coord->workers[slot].ready = false;
+            coord->workers[slot].task = -1;
+            coord->stats.workers_connected++;
+        } else {
+            coord_handle_worker(coord, fd_worker[i]);
+        }
+    }
+
+    /* Keep every ready worker busy */
+    if (coord->tasks_remaining > 0) {
+        for (int i = 0; i < META_DIST_MAX_WORKERS; i++) {
+            dist_worker_t *worker = &coord->workers[i];
+            if (worker->fd >= 0 && worker->ready && worker->task < 0) {
+                coord_assign_task(coord, worker);
+            }
+        }
+    }
+
+    if (out_pending) {
+        *out_pending = coord->tasks_remaining;
+    }
+    return EVOCORE_OK;
+}
+
+evocore_error_t evocore_meta_coordinator_wait(
+    evocore_meta_coordinator_t *coord,
+    int timeout_ms
+) {
+    if (!coord) return EVOCORE_ERR_NULL_PTR;
+
+    double deadline = timeout_ms >= 0 ? dist_now_ms() + timeout_ms : 0.0;
+
+    while (coord->tasks_remaining > 0) {
+        int slice = 100;
+        if (timeout_ms >= 0) {
+            double left = deadline - dist_now_ms();
+            if (left <= 0.0) return EVOCORE_ERR_TIMEOUT;
+            if (left < slice) slice = (int)left + 1;
+        }
+        EVOCORE_CHECK(evocore_meta_coordinator_poll(coord, slice, NULL));
+    }
+    return EVOCORE_OK;
+}
+
+evocore_error_t evocore_meta_coordinator_get_stats(
+    const evocore_meta_coordinator_t *coord,
+    evocore_meta_coordinator_stats_t *stats
+) {
+    if (!coord || !stats) return EVOCORE_ERR_NULL_PTR;
+    *stats = coord->stats;
+    return EVOCORE_OK;
+}
+
+void evocore_meta_coordinator_free(evocore_meta_coordinator_t *coord) {
+    if (!coord) return;
+
+    for (int i = 0; i < META_DIST_MAX_WORKERS; i++) {
+        if (coord->workers[i].fd >= 0) {
+            sock_send_msg(coord->workers[i].fd, MSG_SHUTDOWN, NULL, 0);
+            close(coord->workers[i].fd);
+        }
+    }
+    close(coord->listen_fd);
+    evocore_free(coord->tasks);
+    evocore_free(coord);
+}
+
+/*========================================================================
+ * Worker
+ *========================================================================*/
+
+evocore_error_t evocore_meta_worker_run(
+    const char *host,
+    uint16_t port,
+    evocore_meta_trial_func_t trial,
+    void *context
+) {
+    if (!host || !trial) return EVOCORE_ERR_NULL_PTR;
+
+    struct addrinfo hints;
+    memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_INET;
+    hints.ai_socktype = SOCK_STREAM;
+
+    char port_str[8];
+    snprintf(port_str, sizeof(port_str), "%u", port);
+
+    struct addrinfo *addrs = NULL;
+    if (getaddrinfo(host, port_str, &hints, &addrs) != 0 || !addrs) {
+        evocore_log_error("Worker could not resolve %s", host);
+        return EVOCORE_ERR_NET;
+    }
+
+    int fd = socket(addrs->ai_family, addrs->ai_socktype,
+                    addrs->ai_protocol);
+    if (fd < 0 ||
+        connect(fd, addrs->ai_addr, addrs->ai_addrlen) < 0) {
+        evocore_log_error("Worker connect to %s:%u failed: %s",
+                          host, port, strerror(errno));
+        if (fd >= 0) close(fd);
+        freeaddrinfo(addrs);
+        return EVOCORE_ERR_NET;
+    }
+    freeaddrinfo(addrs);
+
+    int one = 1;
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+
+    msg_hello_t hello;
+    hello.version = META_DIST_VERSION;
+    hello.reserved = 0;
+    hello.params_size = sizeof(evocore_meta_params_t);
+    if (!sock_send_msg(fd, MSG_HELLO, &hello, sizeof(hello))) {
+        close(fd);
+        return EVOCORE_ERR_NET;
+    }
+
+    evocore_log_info("Worker connected to %s:%u", host, port);
+
+    evocore_error_t err = EVOCORE_OK;
+    for (;;) {
+        msg_header_t header;
+        if (!sock_recv_header(fd, &header)) {
+            err = EVOCORE_ERR_NET;
+            break;
+        }
+
+        if (header.type == MSG_SHUTDOWN) {
+            break;  /* Clean shutdown */
+        }
+
+        if (header.type != MSG_TASK ||
+            header.payload_size != sizeof(msg_task_t)) {
+            err = EVOCORE_ERR_PROTOCOL;
+            break;
+        }
+
+        msg_task_t task;
+        if (!sock_read_full(fd, &task, sizeof(task))) {
+            err = EVOCORE_ERR_NET;
+            break;
+        }
+
+        msg_result_t result;
+        result.task_id = task.task_id;
+        result.fitness = trial(&task.params, context);
+
+        if (!sock_send_msg(fd, MSG_RESULT, &result, sizeof(result))) {
+            err = EVOCORE_ERR_NET;
+            break;
+        }
+    }
+
+    close(fd);
+    return err;
+}
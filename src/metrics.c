@@ -0,0 +1,342 @@
+/**
+ * Evocore Asynchronous Metrics Export
+ *
+ * Lock-free SPSC ring between the evolution loop and a background
+ * exporter thread that writes CSV, JSON lines, or StatsD datagrams.
+ */
+
+#define _GNU_SOURCE
+#include "evocore/metrics.h"
+#include "evocore/memory.h"
+#include "evocore/log.h"
+#include "internal.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <sys/time.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <netdb.h>
+
+/*========================================================================
+ * Sample Ring
+ *========================================================================*/
+
+/*
+ * Single-producer/single-consumer sample ring. Written only by the
+ * evolution loop and read only by the exporter thread, so head and
+ * tail each have one writer and plain atomic loads/stores suffice
+ * (same scheme as the island migration rings).
+ */
+typedef struct {
+    evocore_metric_sample_t *slots;
+    size_t capacity;              /* Power of two */
+    size_t head;                  /* Consumer position (exporter) */
+    size_t tail;                  /* Producer position (evolution loop) */
+} sample_ring_t;
+
+struct evocore_metrics_t {
+    evocore_metrics_config_t config;
+    sample_ring_t ring;
+    char prefix[EVOCORE_METRIC_NAME_MAX];
+
+    /* Sink */
+    FILE *file;                   /* CSV/JSON output */
+    int statsd_fd;                /* UDP socket, -1 unless StatsD */
+    struct sockaddr_in statsd_addr;
+
+    /* Exporter thread */
+    pthread_t exporter;
+    bool exporter_running;
+    bool stop;                    /* Read with __atomic by the exporter */
+
+    /* Counters */
+    uint64_t pushed;              /* Producer-side, plain (single writer) */
+    uint64_t dropped;
+    uint64_t exported;            /* Consumer-side */
+};
+
+static size_t round_up_pow2(size_t n) {
+    size_t p = 1;
+    while (p < n) p <<= 1;
+    return p;
+}
+
+static uint64_t wall_clock_ms(void) {
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return (uint64_t)tv.tv_sec * 1000 + (uint64_t)tv.tv_usec / 1000;
+}
+
+/* Producer side: called from the evolution loop only */
+static bool ring_push(sample_ring_t *ring, const evocore_metric_sample_t *sample) {
+    size_t tail = __atomic_load_n(&ring->tail, __ATOMIC_RELAXED);
+    size_t head = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+
+    if (tail - head >= ring->capacity) {
+        return false;  /* Full - caller drops the sample */
+    }
+
+    ring->slots[tail & (ring->capacity - 1)] = *sample;
+    __atomic_store_n(&ring->tail, tail + 1, __ATOMIC_RELEASE);
+    return true;
+}
+
+/* Consumer side: called from the exporter thread only */
+static bool ring_pop(sample_ring_t *ring, evocore_metric_sample_t *out) {
+    size_t head = __atomic_load_n(&ring->head, __ATOMIC_RELAXED);
+    size_t tail = __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE);
+
+    if (head == tail) {
+        return false;  /* Empty */
+    }
+
+    *out = ring->slots[head & (ring->capacity - 1)];
+    __atomic_store_n(&ring->head, head + 1, __ATOMIC_RELEASE);
+    return true;
+}
+
+/*========================================================================
+ * Sinks
+ *========================================================================*/
+
+static void sink_write(evocore_metrics_t *metrics,
+                       const evocore_metric_sample_t *sample) {
+    switch (metrics->config.format) {
+        case EVOCORE_METRICS_CSV:
+            fprintf(metrics->file, "%llu,%llu,%s,%.10g\n",
+                    (unsigned long long)sample->timestamp_ms,
+                    (unsigned long long)sample->generation,
+                    sample->name, sample->value);
+            break;
+
+        case EVOCORE_METRICS_JSON:
+            fprintf(metrics->file,
+                    "{\"ts\": %llu, \"gen\": %llu, \"name\": \"%s\", "
+                    "\"value\": %.10g}\n",
+                    (unsigned long long)sample->timestamp_ms,
+                    (unsigned long long)sample->generation,
+                    sample->name, sample->value);
+            break;
+
+        case EVOCORE_METRICS_STATSD: {
+            char datagram[128];
+            int len = snprintf(datagram, sizeof(datagram), "%s.%s:%.10g|g",
+                               metrics->prefix, sample->name, sample->value);
+            if (len > 0) {
+                sendto(metrics->statsd_fd, datagram, (size_t)len, 0,
+                       (struct sockaddr*)&metrics->statsd_addr,
+                       sizeof(metrics->statsd_addr));
+            }
+            break;
+        }
+    }
+}
+
+/* Drain everything currently in the ring; returns samples written */
+static size_t drain_ring(evocore_metrics_t *metrics) {
+    evocore_metric_sample_t sample;
+    size_t written = 0;
+
+    while (ring_pop(&metrics->ring, &sample)) {
+        sink_write(metrics, &sample);
+        written++;
+    }
+
+    if (written > 0 && metrics->file) {
+        fflush(metrics->file);
+    }
+
+    __atomic_add_fetch(&metrics->exported, written, __ATOMIC_RELAXED);
+    return written;
+}
+
+static void* exporter_main(void *arg) {
+    evocore_metrics_t *metrics = (evocore_metrics_t*)arg;
+
+    while (!__atomic_load_n(&metrics->stop, __ATOMIC_ACQUIRE)) {
+        drain_ring(metrics);
+        usleep(metrics->config.flush_interval_ms * 1000);
+    }
+
+    /* Final drain so nothing pushed before destroy is lost */
+    drain_ring(metrics);
+    return NULL;
+}
+
+/*========================================================================
+ * Pipeline Management
+ *========================================================================*/
+
+evocore_metrics_t* evocore_metrics_create(const evocore_metrics_config_t *config) {
+    evocore_metrics_config_t defaults = EVOCORE_METRICS_DEFAULTS;
+    if (!config) config = &defaults;
+
+    if (config->ring_capacity == 0 || config->flush_interval_ms == 0) {
+        return NULL;
+    }
+
+    evocore_metrics_t *metrics = evocore_calloc(1, sizeof(*metrics));
+    if (!metrics) return NULL;
+
+    metrics->config = *config;
+    metrics->statsd_fd = -1;
+    snprintf(metrics->prefix, sizeof(metrics->prefix), "%s",
+             config->prefix ? config->prefix : "evocore");
+
+    metrics->ring.capacity = round_up_pow2(config->ring_capacity);
+    metrics->ring.slots = evocore_calloc(metrics->ring.capacity,
+                                         sizeof(evocore_metric_sample_t));
+    if (!metrics->ring.slots) {
+        evocore_free(metrics);
+        return NULL;
+    }
+
+    /* Open the sink */
+    if (config->format == EVOCORE_METRICS_STATSD) {
+        if (!config->statsd_host || config->statsd_port <= 0) {
+            evocore_free(metrics->ring.slots);
+            evocore_free(metrics);
+            return NULL;
+        }
+
+        metrics->statsd_fd = socket(AF_INET, SOCK_DGRAM, 0);
+        if (metrics->statsd_fd < 0) {
+            evocore_free(metrics->ring.slots);
+            evocore_free(metrics);
+            return NULL;
+        }
+
+        metrics->statsd_addr.sin_family = AF_INET;
+        metrics->statsd_addr.sin_port = htons((uint16_t)config->statsd_port);
+        if (inet_pton(AF_INET, config->statsd_host,
+                      &metrics->statsd_addr.sin_addr) != 1) {
+            struct hostent *host = gethostbyname(config->statsd_host);
+            if (!host) {
+                evocore_log_warn("Cannot resolve StatsD host '%s'",
+                                 config->statsd_host);
+                close(metrics->statsd_fd);
+                evocore_free(metrics->ring.slots);
+                evocore_free(metrics);
+                return NULL;
+            }
+            memcpy(&metrics->statsd_addr.sin_addr, host->h_addr_list[0],
+                   sizeof(struct in_addr));
+        }
+    } else {
+        if (!config->path) {
+            evocore_free(metrics->ring.slots);
+            evocore_free(metrics);
+            return NULL;
+        }
+
+        metrics->file = fopen(config->path, "w");
+        if (!metrics->file) {
+            evocore_log_warn("Cannot open metrics output '%s'", config->path);
+            evocore_free(metrics->ring.slots);
+            evocore_free(metrics);
+            return NULL;
+        }
+
+        if (config->format == EVOCORE_METRICS_CSV) {
+            fprintf(metrics->file, "timestamp_ms,generation,name,value\n");
+        }
+    }
+
+    if (pthread_create(&metrics->exporter, NULL, exporter_main, metrics) != 0) {
+        if (metrics->file) fclose(metrics->file);
+        if (metrics->statsd_fd >= 0) close(metrics->statsd_fd);
+        evocore_free(metrics->ring.slots);
+        evocore_free(metrics);
+        return NULL;
+    }
+    metrics->exporter_running = true;
+
+    return metrics;
+}
+
+void evocore_metrics_destroy(evocore_metrics_t *metrics) {
+    if (!metrics) return;
+
+    if (metrics->exporter_running) {
+        __atomic_store_n(&metrics->stop, true, __ATOMIC_RELEASE);
+        pthread_join(metrics->exporter, NULL);
+    }
+
+    if (metrics->file) fclose(metrics->file);
+    if (metrics->statsd_fd >= 0) close(metrics->statsd_fd);
+
+    evocore_free(metrics->ring.slots);
+    evocore_free(metrics);
+}
+
+/*========================================================================
+ * Producer API
+ *========================================================================*/
+
+bool evocore_metrics_push(evocore_metrics_t *metrics,
+                          const char *name,
+                          double value,
+                          uint64_t generation) {
+    if (!metrics || !name) return false;
+
+    evocore_metric_sample_t sample;
+    sample.timestamp_ms = wall_clock_ms();
+    sample.generation = generation;
+    sample.value = value;
+    snprintf(sample.name, sizeof(sample.name), "%s", name);
+
+    if (!ring_push(&metrics->ring, &sample)) {
+        metrics->dropped++;
+        return false;
+    }
+
+    metrics->pushed++;
+    return true;
+}
+
+void evocore_metrics_progress_callback(const evocore_stats_t *stats,
+                                       void *user_data) {
+    evocore_metrics_t *metrics = (evocore_metrics_t*)user_data;
+    if (!metrics || !stats) return;
+
+    uint64_t gen = (uint64_t)stats->current_generation;
+
+    evocore_metrics_push(metrics, "fitness.best", stats->best_fitness_current, gen);
+    evocore_metrics_push(metrics, "fitness.avg", stats->avg_fitness_current, gen);
+    evocore_metrics_push(metrics, "fitness.worst", stats->worst_fitness_current, gen);
+    evocore_metrics_push(metrics, "fitness.best_ever", stats->best_fitness_ever, gen);
+    evocore_metrics_push(metrics, "fitness.variance", stats->fitness_variance, gen);
+    evocore_metrics_push(metrics, "time.generation_ms", stats->generation_time_ms, gen);
+    evocore_metrics_push(metrics, "time.eval_ms", stats->eval_time_ms, gen);
+    evocore_metrics_push(metrics, "evaluations",
+                         (double)stats->total_evaluations, gen);
+}
+
+/*========================================================================
+ * Introspection
+ *========================================================================*/
+
+void evocore_metrics_flush(evocore_metrics_t *metrics) {
+    if (!metrics) return;
+
+    uint64_t target = metrics->pushed;
+    while (__atomic_load_n(&metrics->exported, __ATOMIC_ACQUIRE) < target) {
+        usleep(1000);
+    }
+}
+
+void evocore_metrics_get_stats(const evocore_metrics_t *metrics,
+                               uint64_t *out_pushed,
+                               uint64_t *out_dropped,
+                               uint64_t *out_exported) {
+    if (!metrics) return;
+    if (out_pushed) *out_pushed = metrics->pushed;
+    if (out_dropped) *out_dropped = metrics->dropped;
+    if (out_exported) {
+        *out_exported = __atomic_load_n(&metrics->exported, __ATOMIC_ACQUIRE);
+    }
+}
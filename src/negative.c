@@ -107,27 +107,85 @@ evocore_failure_severity_t evocore_classify_failure(
  *========================================================================*/
 
 /**
- * Calculate genome similarity (0.0 to 1.0)
- * Based on normalized Hamming distance
+ * Build the byte histogram sketch for a genome
+ *
+ * Counts bytes by high nibble into EVOCORE_NEGATIVE_SKETCH_BUCKETS buckets.
+ */
+static void genome_sketch(
+    const evocore_genome_t *genome,
+    uint32_t sketch[EVOCORE_NEGATIVE_SKETCH_BUCKETS]
+) {
+    memset(sketch, 0, EVOCORE_NEGATIVE_SKETCH_BUCKETS * sizeof(uint32_t));
+    if (!genome || !genome->data) return;
+
+    const unsigned char *bytes = (const unsigned char*)genome->data;
+    for (size_t i = 0; i < genome->size; i++) {
+        sketch[bytes[i] >> 4]++;
+    }
+}
+
+/**
+ * Lower bound on the Hamming distance between two genomes, from sketches
+ *
+ * A mismatching byte position shifts at most one count in each histogram,
+ * so the L1 distance between the sketches is at most twice the number of
+ * mismatches. The bound is only meaningful when both sketches cover the
+ * same byte range (equal genome sizes).
+ */
+static size_t sketch_min_mismatches(const uint32_t *a, const uint32_t *b) {
+    size_t diff = 0;
+    for (size_t i = 0; i < EVOCORE_NEGATIVE_SKETCH_BUCKETS; i++) {
+        diff += (a[i] > b[i]) ? (a[i] - b[i]) : (b[i] - a[i]);
+    }
+    return diff / 2;
+}
+
+/**
+ * Test a candidate genome against one failure record
+ *
+ * Similarity is the normalized Hamming match over the smaller genome,
+ * as before, but the scan is two-stage: the record's histogram sketch
+ * gives a lower bound on the mismatch count from a single cache line,
+ * rejecting the overwhelmingly common dissimilar record without touching
+ * its genome bytes, and survivors get a byte scan that aborts as soon as
+ * the mismatch budget implied by the threshold is exhausted.
+ *
+ * Returns true and writes the exact similarity only when it reaches the
+ * threshold; the budget is deliberately one mismatch generous so the
+ * exact division below stays the arbiter on the boundary.
  */
-static double genome_similarity(const evocore_genome_t *a, const evocore_genome_t *b) {
-    if (!a || !b) return 0.0;
-    if (!a->data || !b->data) return 0.0;
+static bool record_matches(
+    const evocore_failure_record_t *record,
+    const evocore_genome_t *genome,
+    const uint32_t *candidate_sketch,
+    double threshold,
+    double *similarity_out
+) {
+    const evocore_genome_t *stored = record->genome;
+    if (!stored || !stored->data || !genome->data) return false;
+
+    size_t min_size = genome->size < stored->size ? genome->size : stored->size;
+    if (min_size == 0) return false;
 
-    /* Use smaller size for comparison */
-    size_t min_size = a->size < b->size ? a->size : b->size;
+    size_t budget = (size_t)((1.0 - threshold) * (double)min_size) + 1;
 
-    if (min_size == 0) return 0.0;
+    if (genome->size == stored->size &&
+        sketch_min_mismatches(candidate_sketch, record->sketch) > budget) {
+        return false;
+    }
 
-    /* Count matching bytes */
-    size_t matching = 0;
+    const unsigned char *a = (const unsigned char*)genome->data;
+    const unsigned char *b = (const unsigned char*)stored->data;
+    size_t mismatches = 0;
     for (size_t i = 0; i < min_size; i++) {
-        if (((unsigned char*)a->data)[i] == ((unsigned char*)b->data)[i]) {
-            matching++;
-        }
+        if (a[i] != b[i] && ++mismatches > budget) return false;
     }
 
-    return (double)matching / min_size;
+    double similarity = (double)(min_size - mismatches) / (double)min_size;
+    if (similarity < threshold) return false;
+
+    *similarity_out = similarity;
+    return true;
 }
 
 /**
@@ -177,6 +235,7 @@ static evocore_failure_record_t* failure_record_create(
     record->first_seen = time(NULL);
     record->last_seen = record->first_seen;
     record->is_active = true;
+    genome_sketch(record->genome, record->sketch);
 
     return record;
 }
@@ -311,14 +370,22 @@ evocore_error_t evocore_negative_learning_record_failure_severity(
     /* Update generation */
     neg->current_generation = generation;
 
-    /* Check for similar existing failure */
+    /* Check for similar existing failure (matcher only reports records
+     * at or above the similarity threshold) */
+    uint32_t candidate_sketch[EVOCORE_NEGATIVE_SKETCH_BUCKETS];
+    genome_sketch(genome, candidate_sketch);
+
     double best_similarity = 0.0;
     size_t best_index = neg->count;  /* Default to new */
 
     for (size_t i = 0; i < neg->count; i++) {
         if (!neg->failures[i].is_active) continue;
 
-        double sim = genome_similarity(genome, neg->failures[i].genome);
+        double sim;
+        if (!record_matches(&neg->failures[i], genome, candidate_sketch,
+                            neg->similarity_threshold, &sim)) {
+            continue;
+        }
         if (sim > best_similarity) {
             best_similarity = sim;
             best_index = i;
@@ -326,7 +393,7 @@ evocore_error_t evocore_negative_learning_record_failure_severity(
     }
 
     /* If similar enough, update existing record */
-    if (best_index < neg->count && best_similarity >= neg->similarity_threshold) {
+    if (best_index < neg->count) {
         evocore_failure_record_t *record = &neg->failures[best_index];
 
         record->repeat_count++;
@@ -407,6 +474,10 @@ evocore_error_t evocore_negative_learning_check_penalty(
     if (!neg || !genome || !penalty_out) return EVOCORE_ERR_NULL_PTR;
 
     *penalty_out = 0.0;
+    if (neg->count == 0) return EVOCORE_OK;
+
+    uint32_t candidate_sketch[EVOCORE_NEGATIVE_SKETCH_BUCKETS];
+    genome_sketch(genome, candidate_sketch);
 
     double max_weighted_penalty = 0.0;
 
@@ -414,8 +485,11 @@ evocore_error_t evocore_negative_learning_check_penalty(
         evocore_failure_record_t *record = &neg->failures[i];
         if (!record->is_active) continue;
 
-        double similarity = genome_similarity(genome, record->genome);
-        if (similarity < neg->similarity_threshold) continue;
+        double similarity;
+        if (!record_matches(record, genome, candidate_sketch,
+                            neg->similarity_threshold, &similarity)) {
+            continue;
+        }
 
         /* Weight penalty by similarity */
         double weighted_penalty = record->penalty_score * similarity;
@@ -470,6 +544,9 @@ evocore_error_t evocore_negative_learning_find_similar(
     *failure_out = NULL;
     if (similarity_out) *similarity_out = 0.0;
 
+    uint32_t candidate_sketch[EVOCORE_NEGATIVE_SKETCH_BUCKETS];
+    genome_sketch(genome, candidate_sketch);
+
     double best_similarity = 0.0;
     evocore_failure_record_t *best_record = NULL;
 
@@ -477,14 +554,18 @@ evocore_error_t evocore_negative_learning_find_similar(
         evocore_failure_record_t *record = &neg->failures[i];
         if (!record->is_active) continue;
 
-        double sim = genome_similarity(genome, record->genome);
+        double sim;
+        if (!record_matches(record, genome, candidate_sketch,
+                            neg->similarity_threshold, &sim)) {
+            continue;
+        }
         if (sim > best_similarity) {
             best_similarity = sim;
             best_record = record;
         }
     }
 
-    if (best_record && best_similarity >= neg->similarity_threshold) {
+    if (best_record) {
         *failure_out = best_record;
         if (similarity_out) *similarity_out = best_similarity;
         return EVOCORE_OK;
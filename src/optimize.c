@@ -6,16 +6,25 @@
 
 #define _GNU_SOURCE
 #include "evocore/optimize.h"
+#include "evocore/stats.h"
 #include "evocore/log.h"
 #include "internal.h"
 #include <stdio.h>
 #include <stdlib.h>
+#include <stdint.h>
 #include <string.h>
 #include <time.h>
 #include <math.h>
 #include <sys/time.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
 #include <pthread.h>
 
+#ifdef __linux__
+#include <sched.h>
+#endif
+
 #ifdef OMP_SUPPORT
 #include <omp.h>
 #endif
@@ -26,6 +35,16 @@
 
 #define MEMPOOL_BLOCK_MAGIC 0xDEADBEEF
 
+/* Per-thread cache sizing: threads go to the shared pool only once
+ * every MEMPOOL_TCACHE_BATCH allocations/frees instead of on every call */
+#define MEMPOOL_TCACHE_CAPACITY 64
+#define MEMPOOL_TCACHE_BATCH    32
+
+/* Size-class pools: power-of-two classes from 32 bytes up; 16 classes
+ * covers requests through 1 MiB */
+#define MEMPOOL_MIN_CLASS_SIZE  32
+#define MEMPOOL_MAX_CLASSES     16
+
 typedef struct mempool_block {
     struct mempool_block *next;
     size_t capacity;
@@ -34,38 +53,210 @@ typedef struct mempool_block {
     unsigned char data[];
 } mempool_block_t;
 
-struct evocore_mempool_t {
-    size_t genome_size;
-    size_t block_size;
+/* Free chunks are chained through their own first bytes */
+typedef struct mempool_chunk {
+    struct mempool_chunk *next;
+} mempool_chunk_t;
+
+/* One size class: a fixed pool is simply a pool with a single class */
+typedef struct {
+    size_t chunk_size;            /* Rounded up to hold a freelist link */
     size_t num_blocks;
     mempool_block_t *blocks;
-    mempool_block_t *free_list;
-    pthread_mutex_t mutex;
+    mempool_chunk_t *free_list;   /* Shared freelist, touched only in batches */
+
+    /* Per-class statistics for utilization monitoring */
+    size_t total_allocations;
+    size_t current_allocations;
+} mempool_class_t;
+
+/* Thread-local chunk caches, created lazily per (thread, pool) pair */
+typedef struct mempool_tcache {
+    struct {
+        void *items[MEMPOOL_TCACHE_CAPACITY];
+        size_t count;
+    } cls[MEMPOOL_MAX_CLASSES];
+} mempool_tcache_t;
+
+struct evocore_mempool_t {
+    size_t genome_size;           /* Fixed chunk payload; largest class for sized pools */
+    size_t block_size;
+    size_t class_count;           /* 1 for fixed-size pools */
+    mempool_class_t classes[MEMPOOL_MAX_CLASSES];
+    pthread_mutex_t mutex;        /* Guards blocks/free_lists during rebalancing */
+    pthread_key_t tcache_key;
 
-    /* Statistics */
+    /* Pool-wide statistics */
     size_t total_allocations;
     size_t current_allocations;
 };
 
+/**
+ * Map a requested size to its class index; pool->class_count when the
+ * request exceeds every class
+ */
+static size_t mempool_class_for(const evocore_mempool_t *pool, size_t size) {
+    for (size_t c = 0; c < pool->class_count; c++) {
+        if (size <= pool->classes[c].chunk_size) {
+            return c;
+        }
+    }
+    return pool->class_count;
+}
+
+static void mempool_tcache_destructor(void *arg) {
+    /* Chunks held by an exiting thread stay retired until pool destroy;
+     * they belong to pool-owned blocks, so nothing leaks */
+    evocore_free(arg);
+}
+
+static mempool_tcache_t* mempool_get_tcache(evocore_mempool_t *pool) {
+    mempool_tcache_t *cache = pthread_getspecific(pool->tcache_key);
+    if (!cache) {
+        cache = evocore_calloc(1, sizeof(mempool_tcache_t));
+        if (!cache) return NULL;
+        pthread_setspecific(pool->tcache_key, cache);
+    }
+    return cache;
+}
+
+/* Refill one class of a thread cache from the shared pool. Called with
+ * mutex NOT held. */
+static size_t mempool_tcache_refill(evocore_mempool_t *pool,
+                                    mempool_tcache_t *cache,
+                                    size_t class_index) {
+    mempool_class_t *cls = &pool->classes[class_index];
+    size_t got = 0;
+
+    pthread_mutex_lock(&pool->mutex);
+
+    /* First drain the shared freelist */
+    while (got < MEMPOOL_TCACHE_BATCH && cls->free_list) {
+        cache->cls[class_index].items[cache->cls[class_index].count++] =
+            cls->free_list;
+        cls->free_list = cls->free_list->next;
+        got++;
+    }
+
+    /* Then carve fresh chunks out of the newest block */
+    while (got < MEMPOOL_TCACHE_BATCH) {
+        mempool_block_t *block = cls->blocks;
+
+        if (!block || block->used >= block->capacity) {
+            size_t block_bytes = sizeof(mempool_block_t) +
+                               (pool->block_size * cls->chunk_size);
+            mempool_block_t *new_block = (mempool_block_t*)evocore_malloc(block_bytes);
+            if (!new_block) break;
+
+            new_block->next = cls->blocks;
+            new_block->capacity = pool->block_size;
+            new_block->used = 0;
+            new_block->magic = MEMPOOL_BLOCK_MAGIC;
+
+            cls->blocks = new_block;
+            cls->num_blocks++;
+            block = new_block;
+        }
+
+        cache->cls[class_index].items[cache->cls[class_index].count++] =
+            block->data + (block->used * cls->chunk_size);
+        block->used++;
+        got++;
+    }
+
+    pthread_mutex_unlock(&pool->mutex);
+
+    return got;
+}
+
+/* Return half of an overflowing thread cache class to the shared freelist */
+static void mempool_tcache_flush(evocore_mempool_t *pool,
+                                 mempool_tcache_t *cache,
+                                 size_t class_index) {
+    mempool_class_t *cls = &pool->classes[class_index];
+
+    pthread_mutex_lock(&pool->mutex);
+
+    while (cache->cls[class_index].count >
+           MEMPOOL_TCACHE_CAPACITY - MEMPOOL_TCACHE_BATCH) {
+        mempool_chunk_t *chunk = (mempool_chunk_t*)
+            cache->cls[class_index].items[--cache->cls[class_index].count];
+        chunk->next = cls->free_list;
+        cls->free_list = chunk;
+    }
+
+    pthread_mutex_unlock(&pool->mutex);
+}
+
+/**
+ * Shared constructor: class sizes are filled in by the entry points
+ */
+static evocore_mempool_t* mempool_create_common(size_t block_size) {
+    evocore_mempool_t *pool = (evocore_mempool_t*)evocore_calloc(1, sizeof(evocore_mempool_t));
+    if (!pool) {
+        return NULL;
+    }
+
+    pool->block_size = block_size;
+
+    pthread_mutex_init(&pool->mutex, NULL);
+
+    if (pthread_key_create(&pool->tcache_key, mempool_tcache_destructor) != 0) {
+        pthread_mutex_destroy(&pool->mutex);
+        evocore_free(pool);
+        return NULL;
+    }
+
+    return pool;
+}
+
 evocore_mempool_t* evocore_mempool_create(size_t genome_size, size_t block_size) {
     if (genome_size == 0 || block_size == 0) {
         return NULL;
     }
 
-    evocore_mempool_t *pool = (evocore_mempool_t*)evocore_calloc(1, sizeof(evocore_mempool_t));
+    evocore_mempool_t *pool = mempool_create_common(block_size);
     if (!pool) {
         return NULL;
     }
 
     pool->genome_size = genome_size;
-    pool->block_size = block_size;
-    pool->num_blocks = 0;
-    pool->blocks = NULL;
-    pool->free_list = NULL;
-    pool->total_allocations = 0;
-    pool->current_allocations = 0;
+    pool->class_count = 1;
+    pool->classes[0].chunk_size = genome_size < sizeof(mempool_chunk_t)
+                                  ? sizeof(mempool_chunk_t) : genome_size;
 
-    pthread_mutex_init(&pool->mutex, NULL);
+    return pool;
+}
+
+evocore_mempool_t* evocore_mempool_create_sized(size_t max_genome_size,
+                                                size_t block_size) {
+    if (max_genome_size == 0 || block_size == 0) {
+        return NULL;
+    }
+
+    evocore_mempool_t *pool = mempool_create_common(block_size);
+    if (!pool) {
+        return NULL;
+    }
+
+    /* Power-of-two classes from the minimum up to the first class that
+     * covers max_genome_size */
+    size_t chunk = MEMPOOL_MIN_CLASS_SIZE;
+    size_t count = 0;
+    while (count < MEMPOOL_MAX_CLASSES) {
+        pool->classes[count++].chunk_size = chunk;
+        if (chunk >= max_genome_size) break;
+        chunk *= 2;
+    }
+
+    if (pool->classes[count - 1].chunk_size < max_genome_size) {
+        /* max_genome_size outruns the class table */
+        evocore_mempool_destroy(pool);
+        return NULL;
+    }
+
+    pool->class_count = count;
+    pool->genome_size = pool->classes[count - 1].chunk_size;
 
     return pool;
 }
@@ -73,14 +264,25 @@ evocore_mempool_t* evocore_mempool_create(size_t genome_size, size_t block_size)
 void evocore_mempool_destroy(evocore_mempool_t *pool) {
     if (!pool) return;
 
+    /* Free the calling thread's cache; other threads must be done with
+     * the pool by now (their caches are reclaimed at thread exit) */
+    mempool_tcache_t *cache = pthread_getspecific(pool->tcache_key);
+    if (cache) {
+        pthread_setspecific(pool->tcache_key, NULL);
+        evocore_free(cache);
+    }
+    pthread_key_delete(pool->tcache_key);
+
     pthread_mutex_lock(&pool->mutex);
 
-    /* Free all blocks */
-    mempool_block_t *block = pool->blocks;
-    while (block) {
-        mempool_block_t *next = block->next;
-        evocore_free(block);
-        block = next;
+    /* Free all blocks of every class */
+    for (size_t c = 0; c < pool->class_count; c++) {
+        mempool_block_t *block = pool->classes[c].blocks;
+        while (block) {
+            mempool_block_t *next = block->next;
+            evocore_free(block);
+            block = next;
+        }
     }
 
     pthread_mutex_unlock(&pool->mutex);
@@ -89,73 +291,151 @@ void evocore_mempool_destroy(evocore_mempool_t *pool) {
     evocore_free(pool);
 }
 
-evocore_error_t evocore_mempool_alloc(evocore_mempool_t *pool,
-                                  evocore_genome_t *genome) {
-    if (!pool || !genome) {
-        return EVOCORE_ERR_NULL_PTR;
+/* Hand out one chunk of the given class and wire up the genome */
+static evocore_error_t mempool_alloc_class(evocore_mempool_t *pool,
+                                           evocore_genome_t *genome,
+                                           size_t class_index) {
+    mempool_tcache_t *cache = mempool_get_tcache(pool);
+    if (!cache) {
+        return EVOCORE_ERR_OUT_OF_MEMORY;
     }
 
-    pthread_mutex_lock(&pool->mutex);
-
-    /* Try to find free space in existing blocks */
-    void *ptr = NULL;
-    mempool_block_t *block = pool->blocks;
-
-    while (block) {
-        if (block->used < block->capacity) {
-            ptr = block->data + (block->used * pool->genome_size);
-            block->used++;
-            break;
+    /* Fast path: serve from the thread-local cache without any locking */
+    if (cache->cls[class_index].count == 0) {
+        if (mempool_tcache_refill(pool, cache, class_index) == 0) {
+            return EVOCORE_ERR_OUT_OF_MEMORY;
         }
-        block = block->next;
     }
 
-    /* Need to allocate new block */
-    if (!ptr) {
-        size_t block_bytes = sizeof(mempool_block_t) +
-                           (pool->block_size * pool->genome_size);
-        mempool_block_t *new_block = (mempool_block_t*)evocore_malloc(block_bytes);
+    void *ptr = cache->cls[class_index].items[--cache->cls[class_index].count];
 
-        if (!new_block) {
-            pthread_mutex_unlock(&pool->mutex);
-            return EVOCORE_ERR_OUT_OF_MEMORY;
-        }
+    /* Initialize genome with allocated memory. The capacity records the
+     * class chunk size so evocore_mempool_free can find its way back. */
+    genome->data = ptr;
+    genome->capacity = pool->classes[class_index].chunk_size;
+    genome->size = 0;
+    genome->fingerprint = 0;
 
-        new_block->next = pool->blocks;
-        new_block->capacity = pool->block_size;
-        new_block->used = 1;
-        new_block->magic = MEMPOOL_BLOCK_MAGIC;
+    __atomic_fetch_add(&pool->classes[class_index].total_allocations, 1, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&pool->classes[class_index].current_allocations, 1, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&pool->total_allocations, 1, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&pool->current_allocations, 1, __ATOMIC_RELAXED);
 
-        pool->blocks = new_block;
-        pool->num_blocks++;
+    return EVOCORE_OK;
+}
 
-        ptr = new_block->data;
+evocore_error_t evocore_mempool_alloc(evocore_mempool_t *pool,
+                                  evocore_genome_t *genome) {
+    if (!pool || !genome) {
+        return EVOCORE_ERR_NULL_PTR;
     }
 
-    pthread_mutex_unlock(&pool->mutex);
+    /* Largest class: full genome_size capacity, as the fixed-size API
+     * always did */
+    return mempool_alloc_class(pool, genome, pool->class_count - 1);
+}
 
-    /* Initialize genome with allocated memory */
-    genome->data = ptr;
-    genome->capacity = pool->genome_size;
-    genome->size = 0;
+evocore_error_t evocore_mempool_alloc_sized(evocore_mempool_t *pool,
+                                            evocore_genome_t *genome,
+                                            size_t size) {
+    if (!pool || !genome) {
+        return EVOCORE_ERR_NULL_PTR;
+    }
+    if (size == 0) {
+        return EVOCORE_ERR_INVALID_ARG;
+    }
 
-    pool->total_allocations++;
-    pool->current_allocations++;
+    size_t class_index = mempool_class_for(pool, size);
+    if (class_index >= pool->class_count) {
+        return EVOCORE_ERR_OUT_OF_MEMORY;
+    }
 
-    return EVOCORE_OK;
+    return mempool_alloc_class(pool, genome, class_index);
 }
 
 void evocore_mempool_free(evocore_mempool_t *pool,
                         evocore_genome_t *genome) {
     if (!pool || !genome) return;
 
-    /* For pooled memory, we just mark as freed by clearing data pointer
-     * The actual memory is reused in subsequent allocations */
+    if (genome->data) {
+        /* Recover the class from the recorded capacity */
+        size_t class_index = mempool_class_for(pool, genome->capacity);
+        if (class_index >= pool->class_count) {
+            class_index = pool->class_count - 1;
+        }
+
+        mempool_tcache_t *cache = mempool_get_tcache(pool);
+        if (cache) {
+            /* Fast path: stash in the thread-local cache; flush a batch
+             * back to the shared freelist only when the cache overflows */
+            cache->cls[class_index].items[cache->cls[class_index].count++] =
+                genome->data;
+            if (cache->cls[class_index].count >= MEMPOOL_TCACHE_CAPACITY) {
+                mempool_tcache_flush(pool, cache, class_index);
+            }
+        }
+
+        __atomic_fetch_sub(&pool->classes[class_index].current_allocations, 1, __ATOMIC_RELAXED);
+        __atomic_fetch_sub(&pool->current_allocations, 1, __ATOMIC_RELAXED);
+    }
+
     genome->data = NULL;
     genome->capacity = 0;
     genome->size = 0;
+    genome->fingerprint = 0;
+}
+
+size_t evocore_mempool_get_class_count(const evocore_mempool_t *pool) {
+    return pool ? pool->class_count : 0;
+}
+
+evocore_error_t evocore_mempool_get_class_stats(const evocore_mempool_t *pool,
+                                                size_t class_index,
+                                                size_t *chunk_size,
+                                                size_t *total_allocations,
+                                                size_t *current_allocations,
+                                                size_t *num_blocks,
+                                                size_t *free_chunks) {
+    if (!pool) {
+        return EVOCORE_ERR_NULL_PTR;
+    }
+    if (class_index >= pool->class_count) {
+        return EVOCORE_ERR_INVALID_ARG;
+    }
+
+    const mempool_class_t *cls = &pool->classes[class_index];
+
+    if (chunk_size) {
+        *chunk_size = cls->chunk_size;
+    }
+    if (total_allocations) {
+        *total_allocations = cls->total_allocations;
+    }
+    if (current_allocations) {
+        *current_allocations = cls->current_allocations;
+    }
+    if (num_blocks) {
+        *num_blocks = cls->num_blocks;
+    }
+    if (free_chunks) {
+        size_t free = 0;
+        mempool_block_t *block = cls->blocks;
+        while (block) {
+            if (block->used < block->capacity) {
+                free += (block->capacity - block->used);
+            }
+            block = block->next;
+        }
+        /* Chunks waiting on the shared freelist (thread caches not counted) */
+        mempool_chunk_t *chunk = cls->free_list;
+        while (chunk) {
+            free++;
+            chunk = chunk->next;
+        }
+        *free_chunks = free;
+    }
 
-    pool->current_allocations--;
+    return EVOCORE_OK;
 }
 
 void evocore_mempool_get_stats(const evocore_mempool_t *pool,
@@ -171,31 +451,596 @@ void evocore_mempool_get_stats(const evocore_mempool_t *pool,
     if (current_allocations) {
         *current_allocations = pool->current_allocations;
     }
-    if (total_blocks) {
-        *total_blocks = pool->num_blocks;
-    }
-    if (free_blocks) {
+    if (total_blocks || free_blocks) {
+        size_t blocks = 0;
         size_t free = 0;
-        mempool_block_t *block = pool->blocks;
-        while (block) {
-            if (block->used < block->capacity) {
-                free += (block->capacity - block->used);
+        for (size_t c = 0; c < pool->class_count; c++) {
+            size_t cls_blocks = 0;
+            size_t cls_free = 0;
+            evocore_mempool_get_class_stats(pool, c, NULL, NULL, NULL,
+                                            &cls_blocks, &cls_free);
+            blocks += cls_blocks;
+            free += cls_free;
+        }
+        if (total_blocks) *total_blocks = blocks;
+        if (free_blocks) *free_blocks = free;
+    }
+}
+
+/*========================================================================
+ * Fitness Memoization Cache
+ *======================================================================== */
+
+#define FITNESS_CACHE_PROBE_WINDOW 8
+#define FITNESS_CACHE_DEFAULT_MAX_AGE 4
+
+typedef struct {
+    uint64_t hash;          /* 64-bit content hash */
+    size_t genome_size;     /* Guards against size-differing collisions */
+    size_t generation;      /* Last generation this entry was touched */
+    double fitness;
+    bool used;
+} fitness_cache_entry_t;
+
+struct evocore_fitness_cache_t {
+    fitness_cache_entry_t *entries;
+    size_t capacity;        /* Power of two */
+    size_t max_age;
+    size_t generation;
+    size_t used_count;
+    long long hits;
+    long long misses;
+    /* One lock for the whole table: a probe is nanoseconds against
+     * fitness evaluations in the tens of microseconds and up, so
+     * contention is negligible (same trade-off as the deque locks) */
+    pthread_mutex_t lock;
+};
+
+/* FNV-1a, 64-bit: fast and good enough for genome byte strings */
+static uint64_t fitness_cache_hash(const unsigned char *data, size_t size) {
+    uint64_t h = 0xcbf29ce484222325ULL;
+    for (size_t i = 0; i < size; i++) {
+        h ^= data[i];
+        h *= 0x100000001b3ULL;
+    }
+    return h;
+}
+
+evocore_fitness_cache_t* evocore_fitness_cache_create(size_t capacity,
+                                                   size_t max_age) {
+    if (capacity == 0) return NULL;
+
+    evocore_fitness_cache_t *cache = evocore_calloc(1, sizeof(*cache));
+    if (!cache) return NULL;
+
+    size_t cap = 1;
+    while (cap < capacity) cap <<= 1;
+
+    cache->entries = evocore_calloc(cap, sizeof(fitness_cache_entry_t));
+    if (!cache->entries) {
+        evocore_free(cache);
+        return NULL;
+    }
+
+    cache->capacity = cap;
+    cache->max_age = max_age > 0 ? max_age : FITNESS_CACHE_DEFAULT_MAX_AGE;
+    pthread_mutex_init(&cache->lock, NULL);
+    return cache;
+}
+
+void evocore_fitness_cache_destroy(evocore_fitness_cache_t *cache) {
+    if (!cache) return;
+    pthread_mutex_destroy(&cache->lock);
+    evocore_free(cache->entries);
+    evocore_free(cache);
+}
+
+bool evocore_fitness_cache_lookup(evocore_fitness_cache_t *cache,
+                                 const evocore_genome_t *genome,
+                                 double *out_fitness) {
+    if (!cache || !genome || !genome->data || !out_fitness) return false;
+
+    uint64_t hash = fitness_cache_hash(genome->data, genome->size);
+    bool hit = false;
+
+    pthread_mutex_lock(&cache->lock);
+    for (size_t i = 0; i < FITNESS_CACHE_PROBE_WINDOW; i++) {
+        fitness_cache_entry_t *e =
+            &cache->entries[(hash + i) & (cache->capacity - 1)];
+        if (e->used && e->hash == hash && e->genome_size == genome->size) {
+            /* Entries untouched for max_age generations have expired */
+            if (cache->generation - e->generation > cache->max_age) {
+                e->used = false;
+                cache->used_count--;
+                break;
             }
-            block = block->next;
+            *out_fitness = e->fitness;
+            e->generation = cache->generation;
+            hit = true;
+            break;
         }
-        *free_blocks = free;
     }
+    if (hit) cache->hits++;
+    else cache->misses++;
+    pthread_mutex_unlock(&cache->lock);
+
+    return hit;
+}
+
+void evocore_fitness_cache_insert(evocore_fitness_cache_t *cache,
+                                 const evocore_genome_t *genome,
+                                 double fitness) {
+    if (!cache || !genome || !genome->data || isnan(fitness)) return;
+
+    uint64_t hash = fitness_cache_hash(genome->data, genome->size);
+
+    pthread_mutex_lock(&cache->lock);
+
+    fitness_cache_entry_t *victim = NULL;
+    for (size_t i = 0; i < FITNESS_CACHE_PROBE_WINDOW; i++) {
+        fitness_cache_entry_t *e =
+            &cache->entries[(hash + i) & (cache->capacity - 1)];
+
+        if (e->used && e->hash == hash && e->genome_size == genome->size) {
+            victim = e;  /* Already present - refresh */
+            break;
+        }
+        /* Empty slot beats evicting, otherwise the oldest entry in the
+         * window loses (entries past max_age are by definition oldest) */
+        if (!e->used) {
+            if (!victim || victim->used) victim = e;
+        } else if (!victim ||
+                   (victim->used && e->generation < victim->generation)) {
+            victim = e;
+        }
+    }
+
+    if (victim) {
+        if (!victim->used) cache->used_count++;
+        victim->hash = hash;
+        victim->genome_size = genome->size;
+        victim->generation = cache->generation;
+        victim->fitness = fitness;
+        victim->used = true;
+    }
+
+    pthread_mutex_unlock(&cache->lock);
+}
+
+void evocore_fitness_cache_advance_generation(evocore_fitness_cache_t *cache) {
+    if (!cache) return;
+    pthread_mutex_lock(&cache->lock);
+    cache->generation++;
+    pthread_mutex_unlock(&cache->lock);
+}
+
+void evocore_fitness_cache_get_stats(const evocore_fitness_cache_t *cache,
+                                    long long *out_hits,
+                                    long long *out_misses,
+                                    size_t *out_entries) {
+    if (!cache) return;
+    pthread_mutex_lock((pthread_mutex_t*)&cache->lock);
+    if (out_hits) *out_hits = cache->hits;
+    if (out_misses) *out_misses = cache->misses;
+    if (out_entries) *out_entries = cache->used_count;
+    pthread_mutex_unlock((pthread_mutex_t*)&cache->lock);
+}
+
+/**
+ * Evaluate through the cache when one is attached
+ */
+static double cached_evaluate(evocore_fitness_cache_t *cache,
+                              const evocore_genome_t *genome,
+                              evocore_fitness_func_t fitness_func,
+                              void *user_context) {
+    double fitness;
+    if (cache && evocore_fitness_cache_lookup(cache, genome, &fitness)) {
+        return fitness;
+    }
+    fitness = fitness_func(genome, user_context);
+    if (cache) {
+        evocore_fitness_cache_insert(cache, genome, fitness);
+    }
+    return fitness;
 }
 
 /*========================================================================
  * Parallel Fitness Evaluation
  *======================================================================== */
 
+#ifdef EVOCORE_HAVE_PTHREADS
+
+/**
+ * NUMA topology, discovered from sysfs
+ *
+ * We deliberately avoid a libnuma dependency: the node CPU lists under
+ * /sys/devices/system/node are enough to group pool slots by socket and
+ * pin the helper threads. Memory placement then falls out of the
+ * kernel's first-touch policy - each worker's contiguous block of the
+ * population is touched (and thus paged in) from the socket that keeps
+ * evaluating it. On non-Linux systems, or when sysfs is absent, the
+ * topology collapses to a single node and the pool behaves as before.
+ */
+#define NUMA_MAX_NODES 16
+
+typedef struct {
+    int node_count;                    /* 1 = flat / unknown topology */
+#ifdef __linux__
+    cpu_set_t node_cpus[NUMA_MAX_NODES];
+#endif
+} numa_topology_t;
+
+static void numa_topology_detect(numa_topology_t *topo) {
+    topo->node_count = 1;
+
+#ifdef __linux__
+    int nodes = 0;
+    for (int n = 0; n < NUMA_MAX_NODES; n++) {
+        char path[128];
+        snprintf(path, sizeof(path),
+                 "/sys/devices/system/node/node%d/cpulist", n);
+        FILE *f = fopen(path, "r");
+        if (!f) break;
+
+        char list[512];
+        if (!fgets(list, sizeof(list), f)) {
+            fclose(f);
+            break;
+        }
+        fclose(f);
+
+        /* Parse "0-15,64-79" style ranges into a cpu_set_t */
+        CPU_ZERO(&topo->node_cpus[nodes]);
+        char *cursor = list;
+        while (*cursor) {
+            char *end;
+            long lo = strtol(cursor, &end, 10);
+            if (end == cursor) break;
+            long hi = lo;
+            if (*end == '-') {
+                cursor = end + 1;
+                hi = strtol(cursor, &end, 10);
+            }
+            for (long cpu = lo; cpu <= hi && cpu < CPU_SETSIZE; cpu++) {
+                CPU_SET((int)cpu, &topo->node_cpus[nodes]);
+            }
+            cursor = (*end == ',') ? end + 1 : end;
+        }
+
+        if (CPU_COUNT(&topo->node_cpus[nodes]) > 0) {
+            nodes++;
+        }
+    }
+    if (nodes > 1) {
+        topo->node_count = nodes;
+    }
+#endif
+}
+
+/**
+ * Per-item task run by the worker pool
+ */
+typedef void (*pool_task_fn_t)(size_t index, void *task_ctx);
+
+/**
+ * Per-thread deque of pending item indices
+ *
+ * The owner pops from the bottom, thieves take from the top; both ends
+ * are protected by a small per-deque lock, which is cheap relative to
+ * fitness evaluations and keeps the structure simple.
+ */
+typedef struct {
+    size_t *items;
+    size_t capacity;
+    size_t top;       /* Steal end */
+    size_t bottom;    /* Owner end */
+    pthread_mutex_t lock;
+} worksteal_deque_t;
+
+#endif /* EVOCORE_HAVE_PTHREADS */
+
 struct evocore_parallel_ctx_t {
     int num_threads;
     bool initialized;
+    evocore_fitness_cache_t *fitness_cache;   /* Optional, not owned */
+
+#ifdef EVOCORE_HAVE_PTHREADS
+    /* Persistent work-stealing pool: num_threads - 1 helper threads
+     * stay parked between jobs; the submitting thread works too */
+    bool pool_running;
+    bool shutdown;
+    pthread_t *workers;
+    worksteal_deque_t *deques;        /* One per thread, slot 0 = submitter */
+    pthread_mutex_t job_lock;
+    pthread_cond_t job_cond;          /* New job posted */
+    pthread_cond_t done_cond;         /* All items of the job completed */
+    uint64_t job_seq;
+    pool_task_fn_t task;
+    void *task_ctx;
+    size_t remaining;                 /* Items not yet completed */
+    void *worker_args;                /* Owned storage for thread arguments */
+    int numa_nodes;                   /* Detected NUMA nodes (1 = flat) */
+    int *thread_node;                 /* NUMA node owning each pool slot */
+#endif
 };
 
+#ifdef EVOCORE_HAVE_PTHREADS
+
+/**
+ * Take an item from the caller's own deque
+ */
+static bool deque_pop_bottom(worksteal_deque_t *dq, size_t *index) {
+    bool ok = false;
+    pthread_mutex_lock(&dq->lock);
+    if (dq->bottom > dq->top) {
+        *index = dq->items[--dq->bottom];
+        ok = true;
+    }
+    pthread_mutex_unlock(&dq->lock);
+    return ok;
+}
+
+/**
+ * Steal an item from another thread's deque
+ */
+static bool deque_steal(worksteal_deque_t *dq, size_t *index) {
+    bool ok = false;
+    pthread_mutex_lock(&dq->lock);
+    if (dq->top < dq->bottom) {
+        *index = dq->items[dq->top++];
+        ok = true;
+    }
+    pthread_mutex_unlock(&dq->lock);
+    return ok;
+}
+
+/**
+ * Run items until every deque is empty: own deque first, then sweep
+ * the others for work to steal
+ */
+static void pool_participate(evocore_parallel_ctx_t *ctx, int self) {
+    for (;;) {
+        size_t index;
+
+        if (deque_pop_bottom(&ctx->deques[self], &index)) {
+            ctx->task(index, ctx->task_ctx);
+        } else {
+            /* Sweep same-node victims first; crossing the socket is
+             * the migration of last resort, so a NUMA-local straggler
+             * drains its neighbours before pulling remote pages */
+            bool stole = false;
+            for (int pass = 0; pass < 2 && !stole; pass++) {
+                for (int t = 0; t < ctx->num_threads; t++) {
+                    if (t == self) continue;
+                    bool local = !ctx->thread_node ||
+                                 ctx->thread_node[t] == ctx->thread_node[self];
+                    if (local != (pass == 0)) continue;
+                    if (deque_steal(&ctx->deques[t], &index)) {
+                        ctx->task(index, ctx->task_ctx);
+                        stole = true;
+                        break;
+                    }
+                }
+            }
+            if (!stole) {
+                return;  /* Nothing left anywhere */
+            }
+        }
+
+        if (__atomic_sub_fetch(&ctx->remaining, 1, __ATOMIC_ACQ_REL) == 0) {
+            pthread_mutex_lock(&ctx->job_lock);
+            pthread_cond_signal(&ctx->done_cond);
+            pthread_mutex_unlock(&ctx->job_lock);
+        }
+    }
+}
+
+/**
+ * Helper thread main loop: park until a job is posted, work it, repeat
+ */
+typedef struct {
+    evocore_parallel_ctx_t *ctx;
+    int id;
+} pool_worker_arg_t;
+
+static void* pool_worker_main(void *arg) {
+    pool_worker_arg_t *warg = (pool_worker_arg_t*)arg;
+    evocore_parallel_ctx_t *ctx = warg->ctx;
+    int self = warg->id;
+    uint64_t seen_seq = 0;
+
+    for (;;) {
+        pthread_mutex_lock(&ctx->job_lock);
+        while (ctx->job_seq == seen_seq && !ctx->shutdown) {
+            pthread_cond_wait(&ctx->job_cond, &ctx->job_lock);
+        }
+        if (ctx->shutdown) {
+            pthread_mutex_unlock(&ctx->job_lock);
+            break;
+        }
+        seen_seq = ctx->job_seq;
+        pthread_mutex_unlock(&ctx->job_lock);
+
+        EVOCORE_TRACE_BEGIN(trace_start);
+        pool_participate(ctx, self);
+        EVOCORE_TRACE_END(trace_start, "eval_worker");
+    }
+
+    return NULL;
+}
+
+/**
+ * Distribute [0, count) across the deques and run the job to
+ * completion; the calling thread works as slot 0
+ */
+static void pool_run_job(evocore_parallel_ctx_t *ctx, size_t count,
+                         pool_task_fn_t task, void *task_ctx) {
+    ctx->task = task;
+    ctx->task_ctx = task_ctx;
+    __atomic_store_n(&ctx->remaining, count, __ATOMIC_RELEASE);
+
+    /* Contiguous blocks per thread; owners walk their block while
+     * thieves bite from the far end */
+    size_t chunk = (count + ctx->num_threads - 1) / (size_t)ctx->num_threads;
+    for (int t = 0; t < ctx->num_threads; t++) {
+        worksteal_deque_t *dq = &ctx->deques[t];
+        size_t start = (size_t)t * chunk;
+        size_t end = start + chunk;
+        if (start > count) start = count;
+        if (end > count) end = count;
+        size_t n = end - start;
+
+        pthread_mutex_lock(&dq->lock);
+        if (dq->capacity < n) {
+            evocore_free(dq->items);
+            dq->items = (size_t*)evocore_malloc(n * sizeof(size_t));
+            dq->capacity = dq->items ? n : 0;
+        }
+        dq->top = 0;
+        dq->bottom = 0;
+        if (dq->items) {
+            for (size_t i = 0; i < n; i++) {
+                dq->items[i] = start + i;
+            }
+            dq->bottom = n;
+        }
+        pthread_mutex_unlock(&dq->lock);
+
+        if (!dq->items && n > 0) {
+            /* Allocation failed: run this block inline */
+            for (size_t i = start; i < end; i++) {
+                task(i, task_ctx);
+            }
+            __atomic_sub_fetch(&ctx->remaining, n, __ATOMIC_ACQ_REL);
+        }
+    }
+
+    /* Wake the helpers and join in */
+    pthread_mutex_lock(&ctx->job_lock);
+    ctx->job_seq++;
+    pthread_cond_broadcast(&ctx->job_cond);
+    pthread_mutex_unlock(&ctx->job_lock);
+
+    EVOCORE_TRACE_BEGIN(trace_start);
+    pool_participate(ctx, 0);
+    EVOCORE_TRACE_END(trace_start, "eval_worker");
+
+    pthread_mutex_lock(&ctx->job_lock);
+    while (__atomic_load_n(&ctx->remaining, __ATOMIC_ACQUIRE) > 0) {
+        pthread_cond_wait(&ctx->done_cond, &ctx->job_lock);
+    }
+    pthread_mutex_unlock(&ctx->job_lock);
+}
+
+/**
+ * Spin up the persistent pool; on any failure the context stays usable
+ * with the OpenMP fallback paths
+ */
+static void pool_start(evocore_parallel_ctx_t *ctx) {
+    if (ctx->num_threads < 2) {
+        return;
+    }
+
+    ctx->deques = (worksteal_deque_t*)evocore_calloc(ctx->num_threads,
+                                                   sizeof(worksteal_deque_t));
+    ctx->workers = (pthread_t*)evocore_calloc(ctx->num_threads - 1,
+                                            sizeof(pthread_t));
+    pool_worker_arg_t *args = (pool_worker_arg_t*)
+        evocore_calloc(ctx->num_threads - 1, sizeof(pool_worker_arg_t));
+
+    if (!ctx->deques || !ctx->workers || !args) {
+        evocore_free(ctx->deques);
+        evocore_free(ctx->workers);
+        evocore_free(args);
+        ctx->deques = NULL;
+        ctx->workers = NULL;
+        return;
+    }
+
+    pthread_mutex_init(&ctx->job_lock, NULL);
+    pthread_cond_init(&ctx->job_cond, NULL);
+    pthread_cond_init(&ctx->done_cond, NULL);
+    for (int t = 0; t < ctx->num_threads; t++) {
+        pthread_mutex_init(&ctx->deques[t].lock, NULL);
+    }
+
+    /* Group pool slots into contiguous runs per NUMA node so the
+     * contiguous blocks handed out by pool_run_job align with sockets;
+     * helper threads are pinned to their node's CPUs. Slot 0 is the
+     * submitting thread, whose affinity we leave to the caller. */
+    numa_topology_t topo;
+    numa_topology_detect(&topo);
+    ctx->numa_nodes = topo.node_count;
+    if (topo.node_count > 1) {
+        ctx->thread_node = (int*)evocore_malloc(ctx->num_threads *
+                                                sizeof(int));
+        if (ctx->thread_node) {
+            for (int t = 0; t < ctx->num_threads; t++) {
+                ctx->thread_node[t] = (int)(((long)t * topo.node_count) /
+                                            ctx->num_threads);
+            }
+        }
+    }
+
+    ctx->pool_running = true;
+    for (int t = 0; t < ctx->num_threads - 1; t++) {
+        args[t].ctx = ctx;
+        args[t].id = t + 1;  /* Slot 0 belongs to the submitter */
+        if (pthread_create(&ctx->workers[t], NULL,
+                           pool_worker_main, &args[t]) != 0) {
+            /* Shrink to the threads that did start */
+            ctx->num_threads = t + 1;
+            break;
+        }
+#ifdef __linux__
+        if (ctx->thread_node) {
+            /* Best-effort: an EINVAL from an offlined CPU just leaves
+             * the thread free-roaming */
+            pthread_setaffinity_np(ctx->workers[t], sizeof(cpu_set_t),
+                                   &topo.node_cpus[ctx->thread_node[t + 1]]);
+        }
+#endif
+    }
+
+    if (ctx->num_threads < 2) {
+        ctx->pool_running = false;
+    }
+
+    ctx->worker_args = args;  /* Must outlive the threads */
+}
+
+static void pool_stop(evocore_parallel_ctx_t *ctx) {
+    if (!ctx->deques) {
+        return;  /* Pool never started */
+    }
+
+    pthread_mutex_lock(&ctx->job_lock);
+    ctx->shutdown = true;
+    pthread_cond_broadcast(&ctx->job_cond);
+    pthread_mutex_unlock(&ctx->job_lock);
+
+    for (int t = 0; t < ctx->num_threads - 1; t++) {
+        pthread_join(ctx->workers[t], NULL);
+    }
+
+    for (int t = 0; t < ctx->num_threads; t++) {
+        pthread_mutex_destroy(&ctx->deques[t].lock);
+        evocore_free(ctx->deques[t].items);
+    }
+    pthread_mutex_destroy(&ctx->job_lock);
+    pthread_cond_destroy(&ctx->job_cond);
+    pthread_cond_destroy(&ctx->done_cond);
+
+    evocore_free(ctx->worker_args);
+    evocore_free(ctx->workers);
+    evocore_free(ctx->deques);
+    evocore_free(ctx->thread_node);
+    ctx->thread_node = NULL;
+    ctx->pool_running = false;
+}
+
+#endif /* EVOCORE_HAVE_PTHREADS */
+
 evocore_parallel_ctx_t* evocore_parallel_create(int num_threads) {
     evocore_parallel_ctx_t *ctx = (evocore_parallel_ctx_t*)evocore_calloc(1,
                                             sizeof(evocore_parallel_ctx_t));
@@ -216,11 +1061,18 @@ evocore_parallel_ctx_t* evocore_parallel_create(int num_threads) {
     ctx->num_threads = num_threads;
     ctx->initialized = true;
 
+#ifdef EVOCORE_HAVE_PTHREADS
+    pool_start(ctx);
+#endif
+
     return ctx;
 }
 
 void evocore_parallel_destroy(evocore_parallel_ctx_t *ctx) {
     if (ctx) {
+#ifdef EVOCORE_HAVE_PTHREADS
+        pool_stop(ctx);
+#endif
         evocore_free(ctx);
     }
 }
@@ -229,6 +1081,76 @@ int evocore_parallel_get_num_threads(const evocore_parallel_ctx_t *ctx) {
     return ctx ? ctx->num_threads : 1;
 }
 
+int evocore_parallel_get_numa_nodes(const evocore_parallel_ctx_t *ctx) {
+#ifdef EVOCORE_HAVE_PTHREADS
+    if (ctx && ctx->numa_nodes > 0) {
+        return ctx->numa_nodes;
+    }
+#else
+    (void)ctx;
+#endif
+    return 1;
+}
+
+#ifdef EVOCORE_HAVE_PTHREADS
+
+typedef struct {
+    unsigned char *base;
+    size_t item_size;
+    size_t page_size;
+} pool_touch_job_t;
+
+static void pool_touch_item(size_t i, void *arg) {
+    pool_touch_job_t *job = (pool_touch_job_t*)arg;
+    unsigned char *p = job->base + i * job->item_size;
+    unsigned char *end = p + job->item_size;
+
+    /* A write per page is enough to commit it on the toucher's node;
+     * the volatile store keeps the compiler from eliding it */
+    for (; p < end; p += job->page_size) {
+        *(volatile unsigned char*)p = *p;
+    }
+}
+
+#endif /* EVOCORE_HAVE_PTHREADS */
+
+evocore_error_t evocore_parallel_first_touch(evocore_parallel_ctx_t *ctx,
+                                             void *data,
+                                             size_t item_size,
+                                             size_t count) {
+    if (!ctx || !data) return EVOCORE_ERR_NULL_PTR;
+    if (item_size == 0 || count == 0) return EVOCORE_OK;
+
+#ifdef EVOCORE_HAVE_PTHREADS
+    if (ctx->pool_running) {
+        long page = sysconf(_SC_PAGESIZE);
+        pool_touch_job_t job = {
+            .base = (unsigned char*)data,
+            .item_size = item_size,
+            .page_size = page > 0 ? (size_t)page : 4096,
+        };
+        pool_run_job(ctx, count, pool_touch_item, &job);
+        return EVOCORE_OK;
+    }
+#endif
+
+    /* No pool: every page lands on the caller's node anyway, so a
+     * plain sweep preserves the "committed before evaluation" part
+     * of the contract */
+    volatile unsigned char *p = (volatile unsigned char*)data;
+    for (size_t i = 0; i < item_size * count; i += 4096) {
+        p[i] = p[i];
+    }
+    return EVOCORE_OK;
+}
+
+evocore_error_t evocore_parallel_set_fitness_cache(evocore_parallel_ctx_t *ctx,
+                                               evocore_fitness_cache_t *cache) {
+    if (!ctx) return EVOCORE_ERR_NULL_PTR;
+    ctx->fitness_cache = cache;
+    return EVOCORE_OK;
+}
+
 typedef struct {
     evocore_population_t *pop;
     evocore_fitness_func_t fitness_func;
@@ -251,6 +1173,48 @@ static void* parallel_eval_worker(void *arg) {
     return NULL;
 }
 
+#ifdef EVOCORE_HAVE_PTHREADS
+
+/**
+ * Pool task contexts for the evaluate entry points
+ */
+typedef struct {
+    evocore_population_t *pop;
+    evocore_fitness_func_t fitness_func;
+    void *user_context;
+    evocore_fitness_cache_t *cache;
+} pool_pop_job_t;
+
+static void pool_eval_individual(size_t i, void *arg) {
+    pool_pop_job_t *job = (pool_pop_job_t*)arg;
+    evocore_individual_t *ind = &job->pop->individuals[i];
+    if (ind->genome && ind->genome->data) {
+        ind->fitness = cached_evaluate(job->cache, ind->genome,
+                                       job->fitness_func, job->user_context);
+    }
+}
+
+typedef struct {
+    const evocore_genome_t **genomes;
+    double *fitnesses;
+    evocore_fitness_func_t fitness_func;
+    void *user_context;
+    evocore_fitness_cache_t *cache;
+} pool_batch_job_t;
+
+static void pool_eval_batch_item(size_t i, void *arg) {
+    pool_batch_job_t *job = (pool_batch_job_t*)arg;
+    if (job->genomes[i] && job->genomes[i]->data) {
+        job->fitnesses[i] = cached_evaluate(job->cache, job->genomes[i],
+                                            job->fitness_func,
+                                            job->user_context);
+    } else {
+        job->fitnesses[i] = NAN;
+    }
+}
+
+#endif /* EVOCORE_HAVE_PTHREADS */
+
 evocore_error_t evocore_parallel_evaluate_population(evocore_parallel_ctx_t *ctx,
                                                 evocore_population_t *pop,
                                                 evocore_fitness_func_t fitness_func,
@@ -263,13 +1227,29 @@ evocore_error_t evocore_parallel_evaluate_population(evocore_parallel_ctx_t *ctx
         return EVOCORE_OK;
     }
 
+    EVOCORE_PHASE_BEGIN(phase_start);
+
+#ifdef EVOCORE_HAVE_PTHREADS
+    /* Warm persistent workers with stealing: no per-call fork/join,
+     * and a 50 ms genome can't stall a whole chunk */
+    if (ctx->pool_running) {
+        pool_pop_job_t job = { pop, fitness_func, user_context,
+                               ctx->fitness_cache };
+        pool_run_job(ctx, pop->size, pool_eval_individual, &job);
+        pop->stats_dirty = true;
+        EVOCORE_PHASE_END(phase_start, EVOCORE_PHASE_EVALUATION);
+        return EVOCORE_OK;
+    }
+#endif
+
 #ifdef OMP_SUPPORT
     /* Use OpenMP for parallelization */
     #pragma omp parallel for num_threads(ctx->num_threads) schedule(dynamic)
     for (size_t i = 0; i < pop->size; i++) {
         evocore_individual_t *ind = &pop->individuals[i];
         if (ind->genome && ind->genome->data) {
-            ind->fitness = fitness_func(ind->genome, user_context);
+            ind->fitness = cached_evaluate(ctx->fitness_cache, ind->genome,
+                                           fitness_func, user_context);
         }
     }
 #else
@@ -277,11 +1257,57 @@ evocore_error_t evocore_parallel_evaluate_population(evocore_parallel_ctx_t *ctx
     for (size_t i = 0; i < pop->size; i++) {
         evocore_individual_t *ind = &pop->individuals[i];
         if (ind->genome && ind->genome->data) {
-            ind->fitness = fitness_func(ind->genome, user_context);
+            ind->fitness = cached_evaluate(ctx->fitness_cache, ind->genome,
+                                           fitness_func, user_context);
         }
     }
 #endif
 
+    /* Fitness was written directly; cached aggregates are stale */
+    pop->stats_dirty = true;
+
+    EVOCORE_PHASE_END(phase_start, EVOCORE_PHASE_EVALUATION);
+
+    return EVOCORE_OK;
+}
+
+evocore_error_t evocore_parallel_evaluate_packed(evocore_parallel_ctx_t *ctx,
+                                             evocore_packed_population_t *pop,
+                                             evocore_fitness_func_t fitness_func,
+                                             void *user_context) {
+    if (!ctx || !pop || !fitness_func) {
+        return EVOCORE_ERR_NULL_PTR;
+    }
+
+    if (pop->size == 0) {
+        return EVOCORE_OK;
+    }
+
+    EVOCORE_PHASE_BEGIN(phase_start);
+
+#ifdef OMP_SUPPORT
+    /* Static schedule: each thread streams a contiguous slab range */
+    #pragma omp parallel for num_threads(ctx->num_threads) schedule(static)
+    for (size_t i = 0; i < pop->size; i++) {
+        evocore_genome_t view;
+        evocore_genome_view(&view,
+                            pop->genome_data + i * pop->genome_stride,
+                            pop->genome_size);
+        pop->fitness[i] = fitness_func(&view, user_context);
+    }
+#else
+    /* Serial fallback */
+    for (size_t i = 0; i < pop->size; i++) {
+        evocore_genome_t view;
+        evocore_genome_view(&view,
+                            pop->genome_data + i * pop->genome_stride,
+                            pop->genome_size);
+        pop->fitness[i] = fitness_func(&view, user_context);
+    }
+#endif
+
+    EVOCORE_PHASE_END(phase_start, EVOCORE_PHASE_EVALUATION);
+
     return EVOCORE_OK;
 }
 
@@ -299,12 +1325,25 @@ evocore_error_t evocore_parallel_evaluate_batch(evocore_parallel_ctx_t *ctx,
         return EVOCORE_OK;
     }
 
+    EVOCORE_PHASE_BEGIN(phase_start);
+
+#ifdef EVOCORE_HAVE_PTHREADS
+    if (ctx->pool_running) {
+        pool_batch_job_t job = { genomes, fitnesses, fitness_func,
+                                 user_context, ctx->fitness_cache };
+        pool_run_job(ctx, count, pool_eval_batch_item, &job);
+        EVOCORE_PHASE_END(phase_start, EVOCORE_PHASE_EVALUATION);
+        return EVOCORE_OK;
+    }
+#endif
+
 #ifdef OMP_SUPPORT
     /* Use OpenMP for parallelization */
     #pragma omp parallel for num_threads(ctx->num_threads) schedule(dynamic)
     for (size_t i = 0; i < count; i++) {
         if (genomes[i] && genomes[i]->data) {
-            fitnesses[i] = fitness_func(genomes[i], user_context);
+            fitnesses[i] = cached_evaluate(ctx->fitness_cache, genomes[i],
+                                           fitness_func, user_context);
         } else {
             fitnesses[i] = NAN;
         }
@@ -313,16 +1352,283 @@ evocore_error_t evocore_parallel_evaluate_batch(evocore_parallel_ctx_t *ctx,
     /* Serial fallback */
     for (size_t i = 0; i < count; i++) {
         if (genomes[i] && genomes[i]->data) {
-            fitnesses[i] = fitness_func(genomes[i], user_context);
+            fitnesses[i] = cached_evaluate(ctx->fitness_cache, genomes[i],
+                                           fitness_func, user_context);
         } else {
             fitnesses[i] = NAN;
         }
     }
 #endif
 
+    EVOCORE_PHASE_END(phase_start, EVOCORE_PHASE_EVALUATION);
+
     return EVOCORE_OK;
 }
 
+/*========================================================================
+ * Multi-Process Evaluation (crash isolation)
+ *======================================================================== */
+
+/* Per-item evaluation state, written by workers in shared memory */
+#define PROC_ITEM_PENDING 0
+#define PROC_ITEM_RUNNING 1
+#define PROC_ITEM_DONE    2
+#define PROC_ITEM_FAILED  3
+
+/* Respawn cap per worker range, beyond the one-failure-per-crash bound,
+ * to survive pathological ranges where every genome crashes */
+#define PROC_MAX_RESPAWNS_FACTOR 2
+
+struct evocore_process_pool_t {
+    int num_workers;
+    size_t max_genomes;
+    size_t max_genome_size;   /* Slab stride */
+
+    /* One MAP_SHARED mapping: status, fitness and genome slab live here
+     * so forked workers write results in place, no serialization */
+    void *shm;
+    size_t shm_size;
+    volatile int *status;     /* PROC_ITEM_* per slot */
+    double *fitness;
+    size_t *sizes;            /* Genome byte counts per slot */
+    unsigned char *slab;
+
+    size_t crash_count;       /* Workers lost to signals/bad exits */
+    size_t failed_count;      /* Genomes marked failed across evaluations */
+};
+
+evocore_process_pool_t* evocore_process_pool_create(int num_workers,
+                                                    size_t max_genomes,
+                                                    size_t max_genome_size) {
+    if (max_genomes == 0 || max_genome_size == 0) {
+        return NULL;
+    }
+
+    if (num_workers <= 0) {
+        long n = sysconf(_SC_NPROCESSORS_ONLN);
+        num_workers = n > 0 ? (int)n : 1;
+    }
+    if ((size_t)num_workers > max_genomes) {
+        num_workers = (int)max_genomes;
+    }
+
+    evocore_process_pool_t *pool =
+        (evocore_process_pool_t*)evocore_calloc(1, sizeof(evocore_process_pool_t));
+    if (!pool) {
+        return NULL;
+    }
+
+    pool->num_workers = num_workers;
+    pool->max_genomes = max_genomes;
+    pool->max_genome_size = max_genome_size;
+
+    pool->shm_size = max_genomes * (sizeof(int) + sizeof(double) + sizeof(size_t) +
+                                    max_genome_size);
+    pool->shm = mmap(NULL, pool->shm_size, PROT_READ | PROT_WRITE,
+                     MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if (pool->shm == MAP_FAILED) {
+        evocore_free(pool);
+        return NULL;
+    }
+
+    char *p = (char*)pool->shm;
+    pool->status = (volatile int*)p;          p += max_genomes * sizeof(int);
+    pool->fitness = (double*)p;               p += max_genomes * sizeof(double);
+    pool->sizes = (size_t*)p;                 p += max_genomes * sizeof(size_t);
+    pool->slab = (unsigned char*)p;
+
+    return pool;
+}
+
+void evocore_process_pool_destroy(evocore_process_pool_t *pool) {
+    if (!pool) return;
+
+    munmap(pool->shm, pool->shm_size);
+    evocore_free(pool);
+}
+
+/**
+ * Worker body: evaluate every still-pending slot in [start, end).
+ * Runs in a forked child; the RUNNING marker pinpoints the genome that
+ * killed us if the fitness function crashes.
+ */
+static void process_pool_worker(evocore_process_pool_t *pool,
+                                size_t start, size_t end,
+                                evocore_fitness_func_t fitness_func,
+                                void *user_context) {
+    for (size_t i = start; i < end; i++) {
+        if (pool->status[i] != PROC_ITEM_PENDING) {
+            continue;
+        }
+        pool->status[i] = PROC_ITEM_RUNNING;
+
+        evocore_genome_t view;
+        evocore_genome_view(&view, pool->slab + i * pool->max_genome_size,
+                            pool->sizes[i]);
+        pool->fitness[i] = fitness_func(&view, user_context);
+
+        pool->status[i] = PROC_ITEM_DONE;
+    }
+}
+
+/* Fork one worker for a slot range; returns -1 on fork failure */
+static pid_t process_pool_spawn(evocore_process_pool_t *pool,
+                                size_t start, size_t end,
+                                evocore_fitness_func_t fitness_func,
+                                void *user_context) {
+    pid_t pid = fork();
+    if (pid == 0) {
+        process_pool_worker(pool, start, end, fitness_func, user_context);
+        _exit(0);
+    }
+    return pid;
+}
+
+evocore_error_t evocore_process_pool_evaluate(evocore_process_pool_t *pool,
+                                              evocore_population_t *pop,
+                                              evocore_fitness_func_t fitness_func,
+                                              void *user_context,
+                                              evocore_negative_learning_t *neg) {
+    if (!pool || !pop || !fitness_func) {
+        return EVOCORE_ERR_NULL_PTR;
+    }
+    if (pop->size == 0) {
+        return EVOCORE_OK;
+    }
+    if (pop->size > pool->max_genomes) {
+        return EVOCORE_ERR_POP_SIZE;
+    }
+
+    EVOCORE_PHASE_BEGIN(phase_start);
+
+    /* Stage genomes into the shared slab */
+    for (size_t i = 0; i < pop->size; i++) {
+        evocore_genome_t *g = pop->individuals[i].genome;
+        if (!g || !g->data) {
+            pool->status[i] = PROC_ITEM_FAILED;
+            continue;
+        }
+        if (g->size > pool->max_genome_size) {
+            return EVOCORE_ERR_GENOME_TOO_LARGE;
+        }
+        memcpy(pool->slab + i * pool->max_genome_size, g->data, g->size);
+        pool->sizes[i] = g->size;
+        pool->fitness[i] = NAN;
+        pool->status[i] = PROC_ITEM_PENDING;
+    }
+
+    /* Contiguous ranges, same partitioning as the thread pool */
+    size_t chunk = (pop->size + pool->num_workers - 1) / pool->num_workers;
+    struct {
+        pid_t pid;
+        size_t start, end;
+        size_t respawns;
+    } workers[pool->num_workers];
+    int active = 0;
+
+    for (int w = 0; w < pool->num_workers; w++) {
+        size_t start = (size_t)w * chunk;
+        size_t end = start + chunk < pop->size ? start + chunk : pop->size;
+        if (start >= end) break;
+
+        workers[active].start = start;
+        workers[active].end = end;
+        workers[active].respawns = 0;
+        workers[active].pid = process_pool_spawn(pool, start, end,
+                                                 fitness_func, user_context);
+        if (workers[active].pid < 0) {
+            /* Fork failed: evaluate the range in this process */
+            process_pool_worker(pool, start, end, fitness_func, user_context);
+            continue;
+        }
+        active++;
+    }
+
+    /* Reap workers; a crashed worker forfeits the genome it was running
+     * and is respawned to finish the rest of its range */
+    while (active > 0) {
+        int wstatus = 0;
+        pid_t pid = waitpid(-1, &wstatus, 0);
+        if (pid < 0) break;
+
+        int w;
+        for (w = 0; w < active; w++) {
+            if (workers[w].pid == pid) break;
+        }
+        if (w == active) continue;  /* Not ours */
+
+        bool clean = WIFEXITED(wstatus) && WEXITSTATUS(wstatus) == 0;
+        if (!clean) {
+            pool->crash_count++;
+
+            /* The RUNNING slot is the genome that took the worker down */
+            for (size_t i = workers[w].start; i < workers[w].end; i++) {
+                if (pool->status[i] == PROC_ITEM_RUNNING) {
+                    pool->status[i] = PROC_ITEM_FAILED;
+                    evocore_log_warn("Evaluation worker died (genome %zu); "
+                                     "marking failed and respawning", i);
+                    break;
+                }
+            }
+
+            size_t max_respawns = PROC_MAX_RESPAWNS_FACTOR *
+                                  (workers[w].end - workers[w].start);
+            if (workers[w].respawns < max_respawns) {
+                workers[w].respawns++;
+                workers[w].pid = process_pool_spawn(pool, workers[w].start,
+                                                    workers[w].end,
+                                                    fitness_func, user_context);
+                if (workers[w].pid >= 0) {
+                    continue;  /* Worker slot stays active */
+                }
+            }
+
+            /* Respawn budget exhausted or fork failed: give up on the
+             * remainder of this range */
+            for (size_t i = workers[w].start; i < workers[w].end; i++) {
+                if (pool->status[i] == PROC_ITEM_PENDING ||
+                    pool->status[i] == PROC_ITEM_RUNNING) {
+                    pool->status[i] = PROC_ITEM_FAILED;
+                }
+            }
+        }
+
+        workers[w] = workers[active - 1];
+        active--;
+    }
+
+    /* Collect results; crashed genomes go to negative learning */
+    for (size_t i = 0; i < pop->size; i++) {
+        evocore_individual_t *ind = &pop->individuals[i];
+        if (pool->status[i] == PROC_ITEM_DONE) {
+            ind->fitness = pool->fitness[i];
+        } else {
+            ind->fitness = NAN;
+            pool->failed_count++;
+            if (neg && ind->genome && ind->genome->data) {
+                evocore_negative_learning_record_failure_severity(
+                    neg, ind->genome, NAN, EVOCORE_FAILURE_FATAL,
+                    (int)pop->generation);
+            }
+        }
+    }
+
+    pop->stats_dirty = true;
+
+    EVOCORE_PHASE_END(phase_start, EVOCORE_PHASE_EVALUATION);
+
+    return EVOCORE_OK;
+}
+
+void evocore_process_pool_get_stats(const evocore_process_pool_t *pool,
+                                    size_t *crash_count,
+                                    size_t *failed_count) {
+    if (!pool) return;
+
+    if (crash_count) *crash_count = pool->crash_count;
+    if (failed_count) *failed_count = pool->failed_count;
+}
+
 /*========================================================================
  * SIMD Genome Operations
  *======================================================================== */
@@ -351,6 +1657,8 @@ void evocore_simd_mutate_genome(evocore_genome_t *genome,
         return;
     }
 
+    EVOCORE_PHASE_BEGIN(phase_start);
+
     size_t num_bytes = (size_t)(genome->size * rate);
     if (num_bytes < 1) num_bytes = 1;
 
@@ -358,6 +1666,8 @@ void evocore_simd_mutate_genome(evocore_genome_t *genome,
         size_t pos = rand_r(seed) % genome->size;
         ((unsigned char*)genome->data)[pos] ^= (rand_r(seed) & 0xFF);
     }
+
+    EVOCORE_PHASE_END(phase_start, EVOCORE_PHASE_MUTATION);
 }
 
 size_t evocore_simd_genome_hamming_distance(const evocore_genome_t *a,
@@ -6,6 +6,8 @@
 
 #define _GNU_SOURCE
 #include "evocore/persist.h"
+#include "evocore/compress.h"
+#include "evocore/stats.h"
 #include "evocore/log.h"
 #include "evocore/evocore.h"
 #include "internal.h"
@@ -14,10 +16,17 @@
 #include <stdint.h>
 #include <string.h>
 #include <time.h>
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <dirent.h>
 #include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <pthread.h>
 
 /*========================================================================
  * Binary Format Definitions
@@ -84,70 +93,75 @@ static bool json_writer_ensure(json_writer_t *writer, size_t needed) {
     return true;
 }
 
+/* Bytes that cannot be copied through verbatim */
+static inline bool json_needs_escape(unsigned char c) {
+    return c < 32 || c == '"' || c == '\\';
+}
+
 static void json_write_string(json_writer_t *writer, const char *str) {
-    /* Write opening quote */
-    if (!json_writer_ensure(writer, 1)) return;
-    writer->buffer[writer->size++] = '"';
-
-    /* Write escaped string content */
-    for (const char *p = str; *p; p++) {
-        switch (*p) {
-            case '"':
-                if (!json_writer_ensure(writer, 2)) return;
-                writer->buffer[writer->size++] = '\\';
-                writer->buffer[writer->size++] = '"';
-                break;
-            case '\\':
-                if (!json_writer_ensure(writer, 2)) return;
-                writer->buffer[writer->size++] = '\\';
-                writer->buffer[writer->size++] = '\\';
-                break;
-            case '\n':
-                if (!json_writer_ensure(writer, 2)) return;
-                writer->buffer[writer->size++] = '\\';
-                writer->buffer[writer->size++] = 'n';
-                break;
-            case '\r':
-                if (!json_writer_ensure(writer, 2)) return;
-                writer->buffer[writer->size++] = '\\';
-                writer->buffer[writer->size++] = 'r';
-                break;
-            case '\t':
-                if (!json_writer_ensure(writer, 2)) return;
-                writer->buffer[writer->size++] = '\\';
-                writer->buffer[writer->size++] = 't';
-                break;
-            case '\b':
-                if (!json_writer_ensure(writer, 2)) return;
-                writer->buffer[writer->size++] = '\\';
-                writer->buffer[writer->size++] = 'b';
-                break;
-            case '\f':
-                if (!json_writer_ensure(writer, 2)) return;
-                writer->buffer[writer->size++] = '\\';
-                writer->buffer[writer->size++] = 'f';
-                break;
-            default:
-                if (*p < 32) {
+    size_t len = strlen(str);
+
+    /* One reservation for the worst case (every byte -> \u00XX) so the
+     * copy loop never touches the growth path */
+    if (!json_writer_ensure(writer, 2 + 6 * len)) return;
+
+    char *out = writer->buffer + writer->size;
+    *out++ = '"';
+
+    size_t i = 0;
+    while (i < len) {
+        /* Find the end of the escape-free span */
+        size_t start = i;
+#ifdef __AVX2__
+        /* Skip clean 32-byte blocks: stop at the first block containing
+         * a quote, backslash, or control byte */
+        while (i + 32 <= len) {
+            __m256i v = _mm256_loadu_si256((const __m256i*)(str + i));
+            __m256i hit = _mm256_or_si256(
+                _mm256_or_si256(
+                    _mm256_cmpeq_epi8(v, _mm256_set1_epi8('"')),
+                    _mm256_cmpeq_epi8(v, _mm256_set1_epi8('\\'))),
+                _mm256_cmpeq_epi8(_mm256_min_epu8(v, _mm256_set1_epi8(31)),
+                                  v));
+            if (_mm256_movemask_epi8(hit)) break;
+            i += 32;
+        }
+#endif
+        while (i < len && !json_needs_escape((unsigned char)str[i])) {
+            i++;
+        }
+
+        /* Bulk copy the clean span */
+        memcpy(out, str + start, i - start);
+        out += i - start;
+
+        if (i < len) {
+            unsigned char c = (unsigned char)str[i++];
+            *out++ = '\\';
+            switch (c) {
+                case '"':  *out++ = '"';  break;
+                case '\\': *out++ = '\\'; break;
+                case '\n': *out++ = 'n';  break;
+                case '\r': *out++ = 'r';  break;
+                case '\t': *out++ = 't';  break;
+                case '\b': *out++ = 'b';  break;
+                case '\f': *out++ = 'f';  break;
+                default: {
                     /* Control character as \uXXXX */
-                    if (!json_writer_ensure(writer, 6)) return;
-                    writer->buffer[writer->size++] = '\\';
-                    writer->buffer[writer->size++] = 'u';
-                    writer->buffer[writer->size++] = '0';
-                    writer->buffer[writer->size++] = '0';
-                    snprintf(writer->buffer + writer->size, 3, "%02x", (unsigned char)*p);
-                    writer->size += 2;
-                } else {
-                    if (!json_writer_ensure(writer, 1)) return;
-                    writer->buffer[writer->size++] = *p;
+                    static const char hex[] = "0123456789abcdef";
+                    *out++ = 'u';
+                    *out++ = '0';
+                    *out++ = '0';
+                    *out++ = hex[c >> 4];
+                    *out++ = hex[c & 0xF];
+                    break;
                 }
-                break;
+            }
         }
     }
 
-    /* Write closing quote */
-    if (!json_writer_ensure(writer, 1)) return;
-    writer->buffer[writer->size++] = '"';
+    *out++ = '"';
+    writer->size = (size_t)(out - writer->buffer);
     writer->buffer[writer->size] = '\0';
 }
 
@@ -705,6 +719,20 @@ evocore_error_t evocore_population_save(const evocore_population_t *pop,
         return err;
     }
 
+    /* Transparent block compression when requested */
+    if (options && options->compression_level > 0) {
+        void *frame = NULL;
+        size_t frame_size = 0;
+        err = evocore_compress_frame(buffer, buffer_size, &frame, &frame_size);
+        if (err != EVOCORE_OK) {
+            evocore_free(buffer);
+            return err;
+        }
+        evocore_free(buffer);
+        buffer = (char*)frame;
+        buffer_size = frame_size;
+    }
+
     FILE *f = fopen(filepath, "wb");
     if (!f) {
         evocore_free(buffer);
@@ -762,6 +790,20 @@ evocore_error_t evocore_population_load(const char *filepath,
         return EVOCORE_ERR_FILE_READ;
     }
 
+    /* Compressed checkpoints are detected by their frame magic */
+    if (evocore_compress_frame_detect(buffer, file_size)) {
+        void *raw = NULL;
+        size_t raw_size = 0;
+        evocore_error_t derr = evocore_decompress_frame(buffer, file_size,
+                                                      &raw, &raw_size);
+        evocore_free(buffer);
+        if (derr != EVOCORE_OK) {
+            return derr;
+        }
+        buffer = (char*)raw;
+        file_size = (long)raw_size;
+    }
+
     evocore_error_t err = evocore_population_deserialize(buffer, file_size, pop, domain);
     evocore_free(buffer);
 
@@ -1300,22 +1342,42 @@ evocore_error_t evocore_checkpoint_save(const evocore_checkpoint_t *checkpoint,
     json_write_newline(&writer);
     json_write_object_end(&writer);
 
+    /* Transparent block compression when requested */
+    void *frame = NULL;
+    const char *out_buf = writer.buffer;
+    size_t out_size = writer.size;
+    if (opts.compression_level > 0) {
+        size_t frame_size = 0;
+        evocore_error_t cerr = evocore_compress_frame(writer.buffer,
+                                                    writer.size,
+                                                    &frame, &frame_size);
+        if (cerr != EVOCORE_OK) {
+            json_writer_free(&writer);
+            return cerr;
+        }
+        out_buf = (const char*)frame;
+        out_size = frame_size;
+    }
+
     /* Write to file */
+    EVOCORE_TRACE_BEGIN(trace_start);
     FILE *f = fopen(filepath, "wb");
     if (!f) {
+        evocore_free(frame);
         json_writer_free(&writer);
         return EVOCORE_ERR_FILE_NOT_FOUND;
     }
 
     size_t total_written = 0;
-    size_t remaining = writer.size;
-    const char *ptr = writer.buffer;
+    size_t remaining = out_size;
+    const char *ptr = out_buf;
 
     /* Handle partial writes */
     while (remaining > 0) {
         size_t written = fwrite(ptr, 1, remaining, f);
         if (written == 0) {
             fclose(f);
+            evocore_free(frame);
             json_writer_free(&writer);
             return EVOCORE_ERR_FILE_WRITE;
         }
@@ -1326,8 +1388,11 @@ evocore_error_t evocore_checkpoint_save(const evocore_checkpoint_t *checkpoint,
 
     fflush(f);
     fclose(f);
+    evocore_free(frame);
     json_writer_free(&writer);
 
+    EVOCORE_TRACE_END(trace_start, "checkpoint_write");
+
     return EVOCORE_OK;
 }
 
@@ -1370,6 +1435,20 @@ evocore_error_t evocore_checkpoint_load(const char *filepath,
         return EVOCORE_ERR_FILE_READ;
     }
 
+    /* Compressed checkpoints are detected by their frame magic */
+    if (evocore_compress_frame_detect(buffer, file_size)) {
+        void *raw = NULL;
+        size_t raw_size = 0;
+        evocore_error_t derr = evocore_decompress_frame(buffer, file_size,
+                                                      &raw, &raw_size);
+        evocore_free(buffer);
+        if (derr != EVOCORE_OK) {
+            return derr;
+        }
+        buffer = (char*)raw;
+        file_size = (long)raw_size;
+    }
+
     /* Parse checkpoint JSON - simplified */
     memset(checkpoint, 0, sizeof(*checkpoint));
 
@@ -1479,12 +1558,84 @@ void evocore_checkpoint_free(evocore_checkpoint_t *checkpoint) {
  * Auto-Checkpoint Manager
  *========================================================================*/
 
+#define CHECKPOINT_DEFAULT_MAX_PENDING 2
+#define CHECKPOINT_DEFAULT_FULL_EVERY 10
+
+/**
+ * Queued snapshot waiting for the background writer
+ */
+typedef struct checkpoint_job {
+    evocore_checkpoint_t checkpoint;
+    char filepath[512];
+    struct checkpoint_job *next;
+} checkpoint_job_t;
+
 struct evocore_checkpoint_manager_t {
     evocore_auto_checkpoint_config_t config;
     int generations_since_last;
     int checkpoint_count;
+
+    /* Async writer state (only used when config.async is set) */
+    pthread_t writer;
+    pthread_mutex_t lock;
+    pthread_cond_t work_cond;    /* Signalled when a job is queued */
+    pthread_cond_t drain_cond;   /* Signalled when a job finishes */
+    checkpoint_job_t *queue_head;
+    checkpoint_job_t *queue_tail;
+    int pending;
+    bool writer_running;
+    bool shutting_down;
+
+    /* Delta-mode state (only used when config.delta is set) */
+    uint64_t *base_hashes;       /* Genome hashes at the last base */
+    size_t base_hash_count;
+    int deltas_since_full;
 };
 
+/**
+ * Background writer thread: drains the snapshot queue to disk
+ */
+static void* checkpoint_writer_main(void *arg) {
+    evocore_checkpoint_manager_t *manager = (evocore_checkpoint_manager_t*)arg;
+
+    pthread_mutex_lock(&manager->lock);
+    for (;;) {
+        while (!manager->queue_head && !manager->shutting_down) {
+            pthread_cond_wait(&manager->work_cond, &manager->lock);
+        }
+
+        checkpoint_job_t *job = manager->queue_head;
+        if (!job) {
+            break;  /* Shutting down with an empty queue */
+        }
+
+        manager->queue_head = job->next;
+        if (!manager->queue_head) {
+            manager->queue_tail = NULL;
+        }
+        pthread_mutex_unlock(&manager->lock);
+
+        evocore_serial_options_t opts = EVOCORE_SERIAL_DEFAULTS;
+        opts.compression_level = manager->config.compress ? 6 : 0;
+        evocore_error_t err = evocore_checkpoint_save(&job->checkpoint,
+                                                    job->filepath, &opts);
+        if (err != EVOCORE_OK) {
+            evocore_log_warn("Async checkpoint save failed: %d", err);
+        } else {
+            evocore_log_info("Created checkpoint: %s", job->filepath);
+        }
+        evocore_checkpoint_free(&job->checkpoint);
+        evocore_free(job);
+
+        pthread_mutex_lock(&manager->lock);
+        manager->pending--;
+        pthread_cond_broadcast(&manager->drain_cond);
+    }
+    pthread_mutex_unlock(&manager->lock);
+
+    return NULL;
+}
+
 evocore_checkpoint_manager_t* evocore_checkpoint_manager_create(
     const evocore_auto_checkpoint_config_t *config) {
 
@@ -1516,13 +1667,115 @@ evocore_checkpoint_manager_t* evocore_checkpoint_manager_create(
         }
     }
 
+    if (manager->config.delta && manager->config.full_every <= 0) {
+        manager->config.full_every = CHECKPOINT_DEFAULT_FULL_EVERY;
+    }
+
+    /* Spawn the background writer for async mode */
+    if (manager->config.async) {
+        if (manager->config.max_pending <= 0) {
+            manager->config.max_pending = CHECKPOINT_DEFAULT_MAX_PENDING;
+        }
+        pthread_mutex_init(&manager->lock, NULL);
+        pthread_cond_init(&manager->work_cond, NULL);
+        pthread_cond_init(&manager->drain_cond, NULL);
+
+        if (pthread_create(&manager->writer, NULL,
+                           checkpoint_writer_main, manager) == 0) {
+            manager->writer_running = true;
+        } else {
+            evocore_log_warn("Failed to start checkpoint writer thread, "
+                            "falling back to synchronous checkpoints");
+            pthread_mutex_destroy(&manager->lock);
+            pthread_cond_destroy(&manager->work_cond);
+            pthread_cond_destroy(&manager->drain_cond);
+            manager->config.async = false;
+        }
+    }
+
     return manager;
 }
 
 void evocore_checkpoint_manager_destroy(evocore_checkpoint_manager_t *manager) {
-    if (manager) {
-        evocore_free(manager);
+    if (!manager) return;
+
+    if (manager->writer_running) {
+        /* Let the writer drain the queue, then join it */
+        pthread_mutex_lock(&manager->lock);
+        manager->shutting_down = true;
+        pthread_cond_broadcast(&manager->work_cond);
+        pthread_mutex_unlock(&manager->lock);
+
+        pthread_join(manager->writer, NULL);
+        pthread_mutex_destroy(&manager->lock);
+        pthread_cond_destroy(&manager->work_cond);
+        pthread_cond_destroy(&manager->drain_cond);
+    }
+
+    evocore_free(manager->base_hashes);
+    evocore_free(manager);
+}
+
+/**
+ * Re-snapshot genome hashes so the next delta is relative to the file
+ * just written rather than the original base (chained deltas stay
+ * small; evocore_population_load_chain replays them in order)
+ */
+static evocore_error_t checkpoint_manager_snapshot_hashes(
+    evocore_checkpoint_manager_t *manager, const evocore_population_t *pop) {
+
+    uint64_t *hashes = NULL;
+    if (pop->size > 0) {
+        hashes = (uint64_t*)evocore_calloc(pop->size, sizeof(uint64_t));
+        if (!hashes) {
+            return EVOCORE_ERR_OUT_OF_MEMORY;
+        }
+        for (size_t i = 0; i < pop->size; i++) {
+            hashes[i] = evocore_genome_hash(pop->individuals[i].genome);
+        }
     }
+
+    evocore_free(manager->base_hashes);
+    manager->base_hashes = hashes;
+    manager->base_hash_count = pop->size;
+
+    return EVOCORE_OK;
+}
+
+/**
+ * Delta-mode checkpoint: a full binary base every full_every intervals,
+ * deltas of changed individuals in between
+ */
+static evocore_error_t checkpoint_manager_delta_update(
+    evocore_checkpoint_manager_t *manager, const evocore_population_t *pop) {
+
+    bool full = !manager->base_hashes ||
+                manager->deltas_since_full >= manager->config.full_every;
+
+    char filepath[512];
+    snprintf(filepath, sizeof(filepath), "%s/checkpoint_%zu_g%zu.%s",
+             manager->config.directory, (size_t)time(NULL),
+             (size_t)pop->generation, full ? "base" : "delta");
+
+    evocore_error_t err;
+    if (full) {
+        err = evocore_population_save_mmap(pop, filepath);
+    } else {
+        err = evocore_population_save_delta(pop, manager->base_hashes,
+                                          manager->base_hash_count, filepath);
+    }
+    if (err != EVOCORE_OK) {
+        evocore_log_warn("Failed to save %s checkpoint: %d",
+                        full ? "base" : "delta", err);
+        return err;
+    }
+
+    EVOCORE_CHECK(checkpoint_manager_snapshot_hashes(manager, pop));
+    manager->deltas_since_full = full ? 0 : manager->deltas_since_full + 1;
+
+    evocore_log_info("Created %s checkpoint: %s",
+                    full ? "base" : "delta", filepath);
+    return EVOCORE_OK;
 }
 
 evocore_error_t evocore_checkpoint_manager_update(evocore_checkpoint_manager_t *manager,
@@ -1543,7 +1796,19 @@ evocore_error_t evocore_checkpoint_manager_update(evocore_checkpoint_manager_t *
     if (manager->config.every_n_generations > 0 &&
         manager->generations_since_last >= manager->config.every_n_generations) {
 
-        /* Create checkpoint */
+        if (manager->config.delta) {
+            /* Delta mode bypasses the JSON snapshot path: bases and
+             * deltas are compact binary files written inline, even when
+             * async is configured */
+            evocore_error_t err = checkpoint_manager_delta_update(manager, pop);
+            if (err == EVOCORE_OK) {
+                manager->generations_since_last = 0;
+            }
+            return err;
+        }
+
+        /* Create checkpoint - this snapshots the population into heap
+         * buffers, so the live population can keep evolving */
         evocore_checkpoint_t checkpoint;
         evocore_error_t err = evocore_checkpoint_create(&checkpoint, pop, domain, meta_pop);
         if (err != EVOCORE_OK) {
@@ -1551,21 +1816,50 @@ evocore_error_t evocore_checkpoint_manager_update(evocore_checkpoint_manager_t *
             return err;
         }
 
-        /* Save checkpoint */
         char filepath[512];
         snprintf(filepath, sizeof(filepath), "%s/checkpoint_%zu.json",
                  manager->config.directory,
                  (size_t)checkpoint.timestamp);
 
-        err = evocore_checkpoint_save(&checkpoint, filepath, NULL);
-        evocore_checkpoint_free(&checkpoint);
+        if (manager->writer_running) {
+            /* Hand the snapshot to the background writer */
+            checkpoint_job_t *job = (checkpoint_job_t*)
+                evocore_calloc(1, sizeof(checkpoint_job_t));
+            if (!job) {
+                evocore_checkpoint_free(&checkpoint);
+                return EVOCORE_ERR_OUT_OF_MEMORY;
+            }
+            job->checkpoint = checkpoint;
+            memcpy(job->filepath, filepath, sizeof(job->filepath));
 
-        if (err != EVOCORE_OK) {
-            evocore_log_warn("Failed to save checkpoint: %d", err);
-            return err;
-        }
+            pthread_mutex_lock(&manager->lock);
+            /* Backpressure: don't let snapshots pile up unboundedly */
+            while (manager->pending >= manager->config.max_pending) {
+                pthread_cond_wait(&manager->drain_cond, &manager->lock);
+            }
+            if (manager->queue_tail) {
+                manager->queue_tail->next = job;
+            } else {
+                manager->queue_head = job;
+            }
+            manager->queue_tail = job;
+            manager->pending++;
+            pthread_cond_signal(&manager->work_cond);
+            pthread_mutex_unlock(&manager->lock);
+        } else {
+            /* Synchronous path */
+            evocore_serial_options_t opts = EVOCORE_SERIAL_DEFAULTS;
+            opts.compression_level = manager->config.compress ? 6 : 0;
+            err = evocore_checkpoint_save(&checkpoint, filepath, &opts);
+            evocore_checkpoint_free(&checkpoint);
 
-        evocore_log_info("Created checkpoint: %s", filepath);
+            if (err != EVOCORE_OK) {
+                evocore_log_warn("Failed to save checkpoint: %d", err);
+                return err;
+            }
+
+            evocore_log_info("Created checkpoint: %s", filepath);
+        }
 
         /* Cleanup old checkpoints */
         if (manager->config.max_checkpoints > 0) {
@@ -1583,6 +1877,35 @@ evocore_error_t evocore_checkpoint_manager_update(evocore_checkpoint_manager_t *
     return EVOCORE_OK;
 }
 
+int evocore_checkpoint_manager_pending(evocore_checkpoint_manager_t *manager) {
+    if (!manager || !manager->writer_running) {
+        return 0;
+    }
+
+    pthread_mutex_lock(&manager->lock);
+    int pending = manager->pending;
+    pthread_mutex_unlock(&manager->lock);
+
+    return pending;
+}
+
+evocore_error_t evocore_checkpoint_manager_flush(evocore_checkpoint_manager_t *manager) {
+    if (!manager) {
+        return EVOCORE_ERR_NULL_PTR;
+    }
+    if (!manager->writer_running) {
+        return EVOCORE_OK;
+    }
+
+    pthread_mutex_lock(&manager->lock);
+    while (manager->pending > 0) {
+        pthread_cond_wait(&manager->drain_cond, &manager->lock);
+    }
+    pthread_mutex_unlock(&manager->lock);
+
+    return EVOCORE_OK;
+}
+
 char** evocore_checkpoint_list(const char *directory, int *count) {
     if (!directory || !count) {
         return NULL;
@@ -1649,6 +1972,489 @@ evocore_error_t evocore_checkpoint_info(const char *filepath,
     return evocore_checkpoint_load(filepath, checkpoint);
 }
 
+/*========================================================================
+ * Memory-Mapped Binary Checkpoints
+ *========================================================================*/
+
+/**
+ * Fixed header for the mmap checkpoint format
+ *
+ * Followed by population_size offset-table entries, then genome bytes
+ * at cache-line-aligned file offsets.
+ */
+typedef struct __attribute__((packed)) {
+    uint32_t magic;
+    uint8_t version_major;
+    uint8_t version_minor;
+    uint16_t reserved;
+    uint64_t timestamp;
+    uint64_t population_size;
+    uint64_t capacity;
+    uint64_t generation;
+    uint64_t table_offset;    /* File offset of the entry table */
+    uint64_t file_size;       /* Total file size for validation */
+    uint32_t table_checksum;  /* CRC32 over the entry table */
+} evocore_mmap_header_t;
+
+/**
+ * Per-individual entry in the offset table
+ */
+typedef struct __attribute__((packed)) {
+    uint64_t genome_offset;   /* File offset of genome bytes (aligned) */
+    uint64_t genome_size;     /* Genome size in bytes */
+    double fitness;
+} evocore_mmap_entry_t;
+
+static size_t mmap_align_offset(size_t offset) {
+    return (offset + EVOCORE_CACHE_LINE_SIZE - 1) &
+           ~((size_t)EVOCORE_CACHE_LINE_SIZE - 1);
+}
+
+evocore_error_t evocore_population_save_mmap(const evocore_population_t *pop,
+                                         const char *filepath) {
+    if (!pop || !filepath) {
+        return EVOCORE_ERR_NULL_PTR;
+    }
+
+    /* Build the offset table: genomes are laid out after the table,
+     * each at a cache-line-aligned offset */
+    evocore_mmap_entry_t *table = NULL;
+    if (pop->size > 0) {
+        table = (evocore_mmap_entry_t*)evocore_calloc(pop->size,
+                                                    sizeof(evocore_mmap_entry_t));
+        if (!table) {
+            return EVOCORE_ERR_OUT_OF_MEMORY;
+        }
+    }
+
+    size_t table_offset = sizeof(evocore_mmap_header_t);
+    size_t offset = table_offset + pop->size * sizeof(evocore_mmap_entry_t);
+
+    for (size_t i = 0; i < pop->size; i++) {
+        const evocore_genome_t *genome = pop->individuals[i].genome;
+        size_t genome_size = genome ? genome->size : 0;
+
+        offset = mmap_align_offset(offset);
+        table[i].genome_offset = offset;
+        table[i].genome_size = genome_size;
+        table[i].fitness = pop->individuals[i].fitness;
+        offset += genome_size;
+    }
+
+    evocore_mmap_header_t header;
+    memset(&header, 0, sizeof(header));
+    header.magic = EVOCORE_MAGIC;
+    header.version_major = EVOCORE_VERSION_MAJOR;
+    header.version_minor = EVOCORE_VERSION_MINOR;
+    header.timestamp = (uint64_t)time(NULL);
+    header.population_size = pop->size;
+    header.capacity = pop->capacity;
+    header.generation = pop->generation;
+    header.table_offset = table_offset;
+    header.file_size = offset;
+    header.table_checksum = evocore_checksum(table,
+                                           pop->size * sizeof(evocore_mmap_entry_t));
+
+    FILE *f = fopen(filepath, "wb");
+    if (!f) {
+        evocore_free(table);
+        return EVOCORE_ERR_FILE_NOT_FOUND;
+    }
+
+    bool ok = fwrite(&header, sizeof(header), 1, f) == 1;
+    if (ok && pop->size > 0) {
+        ok = fwrite(table, sizeof(evocore_mmap_entry_t), pop->size, f) ==
+             pop->size;
+    }
+
+    /* Genome bytes, zero-padded up to their aligned offsets */
+    static const unsigned char pad[EVOCORE_CACHE_LINE_SIZE] = {0};
+    size_t written = table_offset + pop->size * sizeof(evocore_mmap_entry_t);
+
+    for (size_t i = 0; ok && i < pop->size; i++) {
+        size_t gap = table[i].genome_offset - written;
+        if (gap > 0) {
+            ok = fwrite(pad, 1, gap, f) == gap;
+        }
+        if (ok && table[i].genome_size > 0) {
+            ok = fwrite(pop->individuals[i].genome->data, 1,
+                        table[i].genome_size, f) == table[i].genome_size;
+        }
+        written = table[i].genome_offset + table[i].genome_size;
+    }
+
+    evocore_free(table);
+    fclose(f);
+
+    return ok ? EVOCORE_OK : EVOCORE_ERR_FILE_WRITE;
+}
+
+evocore_error_t evocore_mmap_checkpoint_open(const char *filepath,
+                                         evocore_mmap_checkpoint_t *ck) {
+    if (!filepath || !ck) {
+        return EVOCORE_ERR_NULL_PTR;
+    }
+
+    memset(ck, 0, sizeof(*ck));
+
+    int fd = open(filepath, O_RDONLY);
+    if (fd < 0) {
+        return EVOCORE_ERR_FILE_NOT_FOUND;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(evocore_mmap_header_t)) {
+        close(fd);
+        return EVOCORE_ERR_FILE_READ;
+    }
+
+    void *map = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);  /* Mapping stays valid after the descriptor is closed */
+    if (map == MAP_FAILED) {
+        return EVOCORE_ERR_FILE_READ;
+    }
+
+    const evocore_mmap_header_t *header = (const evocore_mmap_header_t*)map;
+    size_t map_size = (size_t)st.st_size;
+
+    bool valid = header->magic == EVOCORE_MAGIC &&
+                 header->version_major == EVOCORE_VERSION_MAJOR &&
+                 header->file_size == map_size &&
+                 header->table_offset +
+                     header->population_size * sizeof(evocore_mmap_entry_t) <=
+                     map_size;
+
+    if (valid && header->population_size > 0) {
+        const evocore_mmap_entry_t *table =
+            (const evocore_mmap_entry_t*)((const unsigned char*)map +
+                                         header->table_offset);
+        valid = evocore_checksum_validate(table,
+                                        header->population_size *
+                                            sizeof(evocore_mmap_entry_t),
+                                        header->table_checksum);
+
+        /* Every genome must fall inside the mapping */
+        for (size_t i = 0; valid && i < header->population_size; i++) {
+            valid = table[i].genome_offset + table[i].genome_size <= map_size;
+        }
+    }
+
+    if (!valid) {
+        munmap(map, map_size);
+        return EVOCORE_ERR_FILE_READ;
+    }
+
+    ck->map = map;
+    ck->map_size = map_size;
+    ck->population_size = header->population_size;
+    ck->generation = header->generation;
+
+    return EVOCORE_OK;
+}
+
+evocore_error_t evocore_mmap_checkpoint_restore(const evocore_mmap_checkpoint_t *ck,
+                                            evocore_population_t *pop) {
+    if (!ck || !ck->map || !pop) {
+        return EVOCORE_ERR_NULL_PTR;
+    }
+
+    const evocore_mmap_header_t *header = (const evocore_mmap_header_t*)ck->map;
+    const evocore_mmap_entry_t *table =
+        (const evocore_mmap_entry_t*)((const unsigned char*)ck->map +
+                                     header->table_offset);
+
+    size_t capacity = header->capacity > header->population_size
+                          ? header->capacity
+                          : header->population_size;
+    EVOCORE_CHECK(evocore_population_init(pop, capacity > 0 ? capacity : 1));
+
+    /* Individuals get non-owning views straight into the mapping, so no
+     * genome bytes are copied */
+    for (size_t i = 0; i < header->population_size; i++) {
+        evocore_genome_t *genome = evocore_malloc(sizeof(evocore_genome_t));
+        if (!genome) {
+            evocore_population_cleanup(pop);
+            return EVOCORE_ERR_OUT_OF_MEMORY;
+        }
+
+        evocore_error_t err = evocore_genome_view(genome,
+                                              (const unsigned char*)ck->map +
+                                                  table[i].genome_offset,
+                                              table[i].genome_size);
+        if (err != EVOCORE_OK) {
+            evocore_free(genome);
+            evocore_population_cleanup(pop);
+            return err;
+        }
+
+        pop->individuals[pop->size].genome = genome;
+        pop->individuals[pop->size].fitness = table[i].fitness;
+        pop->size++;
+    }
+
+    pop->generation = header->generation;
+
+    return evocore_population_update_stats(pop);
+}
+
+void evocore_mmap_checkpoint_close(evocore_mmap_checkpoint_t *ck) {
+    if (!ck || !ck->map) return;
+
+    munmap(ck->map, ck->map_size);
+    ck->map = NULL;
+    ck->map_size = 0;
+    ck->population_size = 0;
+    ck->generation = 0;
+}
+
+/*========================================================================
+ * Delta Checkpoints
+ *========================================================================*/
+
+#define EVOCORE_DELTA_FLAG 0x0001
+
+/**
+ * Fixed header for delta checkpoint files
+ *
+ * Followed by changed_count record-table entries, then the changed
+ * genomes' bytes back to back in table order. Shares the evocore magic
+ * with the mmap format; the flags field tells the two apart.
+ */
+typedef struct __attribute__((packed)) {
+    uint32_t magic;
+    uint8_t version_major;
+    uint8_t version_minor;
+    uint16_t flags;           /* EVOCORE_DELTA_FLAG marks delta files */
+    uint64_t timestamp;
+    uint64_t generation;
+    uint64_t population_size; /* Population size after applying */
+    uint64_t changed_count;
+    uint32_t table_checksum;  /* CRC32 over the record table */
+} evocore_delta_header_t;
+
+/**
+ * Per-changed-individual entry in the record table
+ */
+typedef struct __attribute__((packed)) {
+    uint64_t index;           /* Position in the population */
+    uint64_t genome_size;     /* Genome size in bytes */
+    double fitness;
+} evocore_delta_record_t;
+
+evocore_error_t evocore_population_save_delta(const evocore_population_t *pop,
+                                          const uint64_t *base_hashes,
+                                          size_t base_count,
+                                          const char *filepath) {
+    if (!pop || !filepath) {
+        return EVOCORE_ERR_NULL_PTR;
+    }
+    if (base_count > 0 && !base_hashes) {
+        return EVOCORE_ERR_NULL_PTR;
+    }
+
+    /* Collect the individuals whose genome hash moved since the base.
+     * Anything past the base (population grew) is changed by definition. */
+    evocore_delta_record_t *table = NULL;
+    size_t changed = 0;
+
+    if (pop->size > 0) {
+        table = (evocore_delta_record_t*)evocore_calloc(pop->size,
+                                                      sizeof(evocore_delta_record_t));
+        if (!table) {
+            return EVOCORE_ERR_OUT_OF_MEMORY;
+        }
+
+        for (size_t i = 0; i < pop->size; i++) {
+            const evocore_genome_t *genome = pop->individuals[i].genome;
+            if (i < base_count &&
+                evocore_genome_hash(genome) == base_hashes[i]) {
+                continue;
+            }
+            table[changed].index = i;
+            table[changed].genome_size = genome ? genome->size : 0;
+            table[changed].fitness = pop->individuals[i].fitness;
+            changed++;
+        }
+    }
+
+    evocore_delta_header_t header;
+    memset(&header, 0, sizeof(header));
+    header.magic = EVOCORE_MAGIC;
+    header.version_major = EVOCORE_VERSION_MAJOR;
+    header.version_minor = EVOCORE_VERSION_MINOR;
+    header.flags = EVOCORE_DELTA_FLAG;
+    header.timestamp = (uint64_t)time(NULL);
+    header.generation = pop->generation;
+    header.population_size = pop->size;
+    header.changed_count = changed;
+    header.table_checksum = evocore_checksum(table,
+                                           changed * sizeof(evocore_delta_record_t));
+
+    FILE *f = fopen(filepath, "wb");
+    if (!f) {
+        evocore_free(table);
+        return EVOCORE_ERR_FILE_NOT_FOUND;
+    }
+
+    bool ok = fwrite(&header, sizeof(header), 1, f) == 1;
+    if (ok && changed > 0) {
+        ok = fwrite(table, sizeof(evocore_delta_record_t), changed, f) == changed;
+    }
+
+    for (size_t i = 0; ok && i < changed; i++) {
+        if (table[i].genome_size > 0) {
+            const evocore_genome_t *genome =
+                pop->individuals[table[i].index].genome;
+            ok = fwrite(genome->data, 1, table[i].genome_size, f) ==
+                 table[i].genome_size;
+        }
+    }
+
+    evocore_free(table);
+    fclose(f);
+
+    return ok ? EVOCORE_OK : EVOCORE_ERR_FILE_WRITE;
+}
+
+evocore_error_t evocore_population_apply_delta(evocore_population_t *pop,
+                                           const char *filepath) {
+    if (!pop || !filepath) {
+        return EVOCORE_ERR_NULL_PTR;
+    }
+
+    FILE *f = fopen(filepath, "rb");
+    if (!f) {
+        return EVOCORE_ERR_FILE_NOT_FOUND;
+    }
+
+    evocore_delta_header_t header;
+    if (fread(&header, sizeof(header), 1, f) != 1 ||
+        header.magic != EVOCORE_MAGIC ||
+        header.version_major != EVOCORE_VERSION_MAJOR ||
+        !(header.flags & EVOCORE_DELTA_FLAG)) {
+        fclose(f);
+        return EVOCORE_ERR_FILE_READ;
+    }
+
+    size_t changed = header.changed_count;
+    evocore_delta_record_t *table = NULL;
+    if (changed > 0) {
+        table = (evocore_delta_record_t*)evocore_calloc(changed,
+                                                      sizeof(evocore_delta_record_t));
+        if (!table) {
+            fclose(f);
+            return EVOCORE_ERR_OUT_OF_MEMORY;
+        }
+        if (fread(table, sizeof(evocore_delta_record_t), changed, f) != changed ||
+            !evocore_checksum_validate(table,
+                                     changed * sizeof(evocore_delta_record_t),
+                                     header.table_checksum)) {
+            evocore_free(table);
+            fclose(f);
+            return EVOCORE_ERR_FILE_READ;
+        }
+    }
+
+    evocore_error_t err = EVOCORE_OK;
+    void *buf = NULL;
+    size_t buf_cap = 0;
+
+    for (size_t i = 0; i < changed && err == EVOCORE_OK; i++) {
+        size_t genome_size = table[i].genome_size;
+
+        if (genome_size > buf_cap) {
+            void *grown = evocore_realloc(buf, genome_size);
+            if (!grown) {
+                err = EVOCORE_ERR_OUT_OF_MEMORY;
+                break;
+            }
+            buf = grown;
+            buf_cap = genome_size;
+        }
+        if (genome_size > 0 && fread(buf, 1, genome_size, f) != genome_size) {
+            err = EVOCORE_ERR_FILE_READ;
+            break;
+        }
+
+        /* Deltas may only extend the population one slot at a time */
+        if (table[i].index > pop->size) {
+            err = EVOCORE_ERR_FILE_READ;
+            break;
+        }
+
+        evocore_genome_t view;
+        err = evocore_genome_view(&view, buf, genome_size);
+        if (err != EVOCORE_OK) {
+            break;
+        }
+
+        if (table[i].index == pop->size) {
+            err = evocore_population_add(pop, &view, table[i].fitness);
+        } else {
+            err = evocore_population_replace(pop, table[i].index, &view,
+                                           table[i].fitness);
+        }
+    }
+
+    evocore_free(buf);
+    evocore_free(table);
+    fclose(f);
+
+    if (err == EVOCORE_OK) {
+        pop->generation = header.generation;
+    }
+
+    return err;
+}
+
+evocore_error_t evocore_population_load_chain(const char *base_path,
+                                          const char *const *delta_paths,
+                                          size_t delta_count,
+                                          evocore_population_t *pop) {
+    if (!base_path || !pop) {
+        return EVOCORE_ERR_NULL_PTR;
+    }
+    if (delta_count > 0 && !delta_paths) {
+        return EVOCORE_ERR_NULL_PTR;
+    }
+
+    evocore_mmap_checkpoint_t ck;
+    EVOCORE_CHECK(evocore_mmap_checkpoint_open(base_path, &ck));
+
+    /* Restore gives views into the mapping; deep-copy them into owned
+     * genomes so the mapping can be closed and deltas applied in place */
+    evocore_population_t mapped;
+    evocore_error_t err = evocore_mmap_checkpoint_restore(&ck, &mapped);
+    if (err != EVOCORE_OK) {
+        evocore_mmap_checkpoint_close(&ck);
+        return err;
+    }
+
+    err = evocore_population_init(pop, mapped.capacity > 0 ? mapped.capacity : 1);
+    if (err == EVOCORE_OK) {
+        for (size_t i = 0; i < mapped.size && err == EVOCORE_OK; i++) {
+            err = evocore_population_add(pop, mapped.individuals[i].genome,
+                                       mapped.individuals[i].fitness);
+        }
+        if (err == EVOCORE_OK) {
+            pop->generation = mapped.generation;
+        }
+    }
+
+    evocore_population_cleanup(&mapped);
+    evocore_mmap_checkpoint_close(&ck);
+
+    for (size_t i = 0; i < delta_count && err == EVOCORE_OK; i++) {
+        err = evocore_population_apply_delta(pop, delta_paths[i]);
+    }
+
+    if (err != EVOCORE_OK) {
+        evocore_population_cleanup(pop);
+    }
+
+    return err;
+}
+
 /*========================================================================
  * Utility Functions
  *========================================================================*/
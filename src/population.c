@@ -1,5 +1,7 @@
 #define _GNU_SOURCE
 #include "evocore/population.h"
+#include "evocore/random.h"
+#include "evocore/stats.h"
 #include "internal.h"
 #include "evocore/log.h"
 #include <string.h>
@@ -12,6 +14,41 @@
  * Internal Helpers
  *========================================================================*/
 
+/* Fold a new fitness value into the running aggregates in O(1) */
+static void population_stats_include(evocore_population_t *pop,
+                                     size_t index, double fitness) {
+    if (isnan(fitness)) return;
+
+    pop->fitness_sum += fitness;
+    pop->valid_count++;
+    pop->avg_fitness = pop->fitness_sum / pop->valid_count;
+
+    if (fitness > pop->best_fitness || pop->valid_count == 1) {
+        pop->best_fitness = fitness;
+        pop->best_index = index;
+    }
+    if (fitness < pop->worst_fitness || pop->valid_count == 1) {
+        pop->worst_fitness = fitness;
+    }
+}
+
+/* Drop a fitness value from the running aggregates. Marks the stats
+ * dirty when the eviction invalidates a tracked extremum. */
+static void population_stats_exclude(evocore_population_t *pop,
+                                     size_t index, double fitness) {
+    if (isnan(fitness)) return;
+
+    pop->fitness_sum -= fitness;
+    pop->valid_count--;
+    pop->avg_fitness = (pop->valid_count > 0)
+                       ? pop->fitness_sum / pop->valid_count : NAN;
+
+    if (index == pop->best_index || fitness >= pop->best_fitness ||
+        fitness <= pop->worst_fitness) {
+        pop->stats_dirty = true;
+    }
+}
+
 static int compare_individuals_desc(const void *a, const void *b) {
     const evocore_individual_t *ia = (const evocore_individual_t*)a;
     const evocore_individual_t *ib = (const evocore_individual_t*)b;
@@ -25,6 +62,53 @@ static int compare_individuals_desc(const void *a, const void *b) {
     return 0;
 }
 
+static void swap_individuals(evocore_individual_t *a, evocore_individual_t *b) {
+    evocore_individual_t tmp = *a;
+    *a = *b;
+    *b = tmp;
+}
+
+/* Quickselect with median-of-three pivots: after the call the k best
+ * individuals (by compare_individuals_desc) occupy [0, k) in arbitrary
+ * order. O(n) expected, versus O(n log n) for a full sort. */
+static void individuals_select_top(evocore_individual_t *arr, size_t n,
+                                   size_t k) {
+    if (k == 0 || k >= n) return;
+
+    size_t lo = 0, hi = n - 1;
+    while (lo < hi) {
+        /* Median of lo/mid/hi, parked at hi as the pivot */
+        size_t mid = lo + (hi - lo) / 2;
+        if (compare_individuals_desc(&arr[mid], &arr[lo]) < 0) {
+            swap_individuals(&arr[lo], &arr[mid]);
+        }
+        if (compare_individuals_desc(&arr[hi], &arr[lo]) < 0) {
+            swap_individuals(&arr[lo], &arr[hi]);
+        }
+        if (compare_individuals_desc(&arr[hi], &arr[mid]) < 0) {
+            swap_individuals(&arr[mid], &arr[hi]);
+        }
+        swap_individuals(&arr[mid], &arr[hi]);
+
+        const evocore_individual_t pivot = arr[hi];
+        size_t store = lo;
+        for (size_t i = lo; i < hi; i++) {
+            if (compare_individuals_desc(&arr[i], &pivot) < 0) {
+                swap_individuals(&arr[i], &arr[store]);
+                store++;
+            }
+        }
+        swap_individuals(&arr[store], &arr[hi]);
+
+        if (store >= k) {
+            if (store == k) break;
+            hi = store - 1;
+        } else {
+            lo = store + 1;
+        }
+    }
+}
+
 /*========================================================================
  * Population Lifecycle
  *========================================================================*/
@@ -78,6 +162,126 @@ void evocore_population_clear(evocore_population_t *pop) {
     pop->worst_fitness = INFINITY;
     pop->avg_fitness = NAN;
     pop->best_index = 0;
+    pop->fitness_sum = 0.0;
+    pop->valid_count = 0;
+    pop->stats_dirty = false;
+}
+
+/*========================================================================
+ * Packed Population (Structure of Arrays)
+ *========================================================================*/
+
+evocore_error_t evocore_packed_population_init(evocore_packed_population_t *pop,
+                                           size_t capacity,
+                                           size_t genome_size) {
+    if (!pop) return EVOCORE_ERR_NULL_PTR;
+    if (capacity == 0) return EVOCORE_ERR_POP_SIZE;
+    if (genome_size == 0) return EVOCORE_ERR_GENOME_EMPTY;
+
+    memset(pop, 0, sizeof(evocore_packed_population_t));
+
+    /* Round stride up to a cache line so no two slots share a line */
+    size_t stride = (genome_size + EVOCORE_CACHE_LINE_SIZE - 1)
+                    & ~((size_t)EVOCORE_CACHE_LINE_SIZE - 1);
+
+    void *slab = NULL;
+    if (posix_memalign(&slab, EVOCORE_CACHE_LINE_SIZE, capacity * stride) != 0) {
+        return EVOCORE_ERR_OUT_OF_MEMORY;
+    }
+    memset(slab, 0, capacity * stride);
+
+    pop->fitness = evocore_malloc(capacity * sizeof(double));
+    if (!pop->fitness) {
+        free(slab);
+        return EVOCORE_ERR_OUT_OF_MEMORY;
+    }
+    for (size_t i = 0; i < capacity; i++) {
+        pop->fitness[i] = NAN;
+    }
+
+    pop->genome_data = (unsigned char*)slab;
+    pop->genome_size = genome_size;
+    pop->genome_stride = stride;
+    pop->capacity = capacity;
+    pop->size = 0;
+    pop->generation = 0;
+
+    return EVOCORE_OK;
+}
+
+void evocore_packed_population_cleanup(evocore_packed_population_t *pop) {
+    if (!pop) return;
+
+    free(pop->genome_data);
+    evocore_free(pop->fitness);
+
+    memset(pop, 0, sizeof(evocore_packed_population_t));
+}
+
+unsigned char* evocore_packed_population_genome(const evocore_packed_population_t *pop,
+                                              size_t index) {
+    if (!pop || !pop->genome_data || index >= pop->capacity) return NULL;
+    return pop->genome_data + index * pop->genome_stride;
+}
+
+evocore_error_t evocore_packed_population_view(const evocore_packed_population_t *pop,
+                                           size_t index,
+                                           evocore_genome_t *view) {
+    if (!pop || !view) return EVOCORE_ERR_NULL_PTR;
+    if (index >= pop->capacity) return EVOCORE_ERR_INVALID_ARG;
+
+    return evocore_genome_view(view,
+                               pop->genome_data + index * pop->genome_stride,
+                               pop->genome_size);
+}
+
+evocore_error_t evocore_packed_population_pack(evocore_packed_population_t *dst,
+                                           const evocore_population_t *src) {
+    if (!dst || !src) return EVOCORE_ERR_NULL_PTR;
+    if (src->size > dst->capacity) return EVOCORE_ERR_POP_FULL;
+
+    for (size_t i = 0; i < src->size; i++) {
+        const evocore_genome_t *genome = src->individuals[i].genome;
+        unsigned char *slot = dst->genome_data + i * dst->genome_stride;
+
+        if (genome && genome->data) {
+            if (genome->size > dst->genome_size) {
+                return EVOCORE_ERR_GENOME_TOO_LARGE;
+            }
+            memcpy(slot, genome->data, genome->size);
+            if (genome->size < dst->genome_size) {
+                memset(slot + genome->size, 0, dst->genome_size - genome->size);
+            }
+        } else {
+            memset(slot, 0, dst->genome_size);
+        }
+
+        dst->fitness[i] = src->individuals[i].fitness;
+    }
+
+    dst->size = src->size;
+    dst->generation = src->generation;
+
+    return EVOCORE_OK;
+}
+
+evocore_error_t evocore_packed_population_unpack(const evocore_packed_population_t *src,
+                                             evocore_population_t *dst) {
+    if (!src || !dst) return EVOCORE_ERR_NULL_PTR;
+    if (src->size > dst->capacity) return EVOCORE_ERR_POP_FULL;
+
+    evocore_population_clear(dst);
+
+    for (size_t i = 0; i < src->size; i++) {
+        evocore_genome_t view;
+        EVOCORE_CHECK(evocore_packed_population_view(src, i, &view));
+        EVOCORE_CHECK(evocore_population_add(dst, &view, src->fitness[i]));
+    }
+
+    dst->generation = src->generation;
+    evocore_population_update_stats(dst);
+
+    return EVOCORE_OK;
 }
 
 /*========================================================================
@@ -107,11 +311,159 @@ evocore_error_t evocore_population_add(evocore_population_t *pop,
 
     pop->individuals[pop->size].genome = new_genome;
     pop->individuals[pop->size].fitness = fitness;
+    population_stats_include(pop, pop->size, fitness);
     pop->size++;
 
     return EVOCORE_OK;
 }
 
+/* Move an owning genome into a fresh heap-allocated genome struct,
+ * emptying the source; clones when the source doesn't own its bytes
+ * (stealing a borrowed buffer would dangle) */
+static evocore_genome_t* genome_take(evocore_genome_t *genome,
+                                     evocore_error_t *err) {
+    evocore_genome_t *new_genome = evocore_malloc(sizeof(evocore_genome_t));
+    if (!new_genome) {
+        *err = EVOCORE_ERR_OUT_OF_MEMORY;
+        return NULL;
+    }
+
+    if (genome->owns_memory) {
+        *new_genome = *genome;
+        genome->data = NULL;
+        genome->size = 0;
+        genome->capacity = 0;
+        genome->owns_memory = false;
+    } else {
+        *err = evocore_genome_clone(genome, new_genome);
+        if (*err != EVOCORE_OK) {
+            evocore_free(new_genome);
+            return NULL;
+        }
+    }
+
+    *err = EVOCORE_OK;
+    return new_genome;
+}
+
+evocore_error_t evocore_population_add_move(evocore_population_t *pop,
+                                        evocore_genome_t *genome,
+                                        double fitness) {
+    if (!pop || !genome) return EVOCORE_ERR_NULL_PTR;
+
+    if (pop->size >= pop->capacity) {
+        return EVOCORE_ERR_POP_FULL;
+    }
+
+    evocore_error_t err;
+    evocore_genome_t *new_genome = genome_take(genome, &err);
+    if (!new_genome) return err;
+
+    pop->individuals[pop->size].genome = new_genome;
+    pop->individuals[pop->size].fitness = fitness;
+    population_stats_include(pop, pop->size, fitness);
+    pop->size++;
+
+    return EVOCORE_OK;
+}
+
+evocore_error_t evocore_population_replace(evocore_population_t *pop,
+                                       size_t index,
+                                       const evocore_genome_t *genome,
+                                       double fitness) {
+    if (!pop || !genome) return EVOCORE_ERR_NULL_PTR;
+    if (index >= pop->size) return EVOCORE_ERR_INVALID_ARG;
+
+    evocore_genome_t *new_genome = evocore_malloc(sizeof(evocore_genome_t));
+    if (!new_genome) {
+        return EVOCORE_ERR_OUT_OF_MEMORY;
+    }
+
+    evocore_error_t err = evocore_genome_clone(genome, new_genome);
+    if (err != EVOCORE_OK) {
+        evocore_free(new_genome);
+        return err;
+    }
+
+    /* Free old genome */
+    if (pop->individuals[index].genome) {
+        evocore_genome_cleanup(pop->individuals[index].genome);
+        evocore_free(pop->individuals[index].genome);
+    }
+
+    population_stats_exclude(pop, index, pop->individuals[index].fitness);
+
+    pop->individuals[index].genome = new_genome;
+    pop->individuals[index].fitness = fitness;
+    population_stats_include(pop, index, fitness);
+
+    return EVOCORE_OK;
+}
+
+evocore_error_t evocore_population_replace_move(evocore_population_t *pop,
+                                            size_t index,
+                                            evocore_genome_t *genome,
+                                            double fitness) {
+    if (!pop || !genome) return EVOCORE_ERR_NULL_PTR;
+    if (index >= pop->size) return EVOCORE_ERR_INVALID_ARG;
+
+    evocore_error_t err;
+    evocore_genome_t *new_genome = genome_take(genome, &err);
+    if (!new_genome) return err;
+
+    /* Free old genome */
+    if (pop->individuals[index].genome) {
+        evocore_genome_cleanup(pop->individuals[index].genome);
+        evocore_free(pop->individuals[index].genome);
+    }
+
+    population_stats_exclude(pop, index, pop->individuals[index].fitness);
+
+    pop->individuals[index].genome = new_genome;
+    pop->individuals[index].fitness = fitness;
+    population_stats_include(pop, index, fitness);
+
+    return EVOCORE_OK;
+}
+
+evocore_error_t evocore_population_replace_swap(evocore_population_t *pop,
+                                            size_t index,
+                                            evocore_genome_t *genome,
+                                            double fitness) {
+    if (!pop || !genome) return EVOCORE_ERR_NULL_PTR;
+    if (index >= pop->size) return EVOCORE_ERR_INVALID_ARG;
+
+    evocore_genome_t *victim = pop->individuals[index].genome;
+    if (!victim || !victim->owns_memory || !genome->owns_memory) {
+        /* Views can't trade buffers - fall back to the cloning path */
+        return evocore_population_replace(pop, index, genome, fitness);
+    }
+
+    /* Trade buffers: the caller's genome becomes the individual and the
+     * evicted genome's storage is handed back for reuse, so steady-state
+     * loops replace individuals with zero allocations */
+    evocore_genome_t evicted = *victim;
+    *victim = *genome;
+    *genome = evicted;
+
+    population_stats_exclude(pop, index, pop->individuals[index].fitness);
+    pop->individuals[index].fitness = fitness;
+    population_stats_include(pop, index, fitness);
+
+    return EVOCORE_OK;
+}
+
+evocore_error_t evocore_population_swap(evocore_population_t *a,
+                                    evocore_population_t *b) {
+    if (!a || !b) return EVOCORE_ERR_NULL_PTR;
+
+    evocore_population_t tmp = *a;
+    *a = *b;
+    *b = tmp;
+
+    return EVOCORE_OK;
+}
+
 evocore_error_t evocore_population_remove(evocore_population_t *pop,
                                        size_t index) {
     if (!pop) return EVOCORE_ERR_NULL_PTR;
@@ -123,11 +475,18 @@ evocore_error_t evocore_population_remove(evocore_population_t *pop,
         evocore_free(pop->individuals[index].genome);
     }
 
+    population_stats_exclude(pop, index, pop->individuals[index].fitness);
+
     /* Shift remaining individuals */
     for (size_t i = index; i < pop->size - 1; i++) {
         pop->individuals[i] = pop->individuals[i + 1];
     }
 
+    /* Tracked best shifts down with the removal */
+    if (pop->best_index > index) {
+        pop->best_index--;
+    }
+
     pop->size--;
     pop->individuals[pop->size].genome = NULL;
     pop->individuals[pop->size].fitness = NAN;
@@ -178,6 +537,7 @@ evocore_error_t evocore_population_set_size(evocore_population_t *pop,
     if (!pop) return EVOCORE_ERR_NULL_PTR;
     if (size > pop->capacity) return EVOCORE_ERR_INVALID_ARG;
     pop->size = size;
+    pop->stats_dirty = true;
     return EVOCORE_OK;
 }
 
@@ -226,6 +586,9 @@ evocore_error_t evocore_population_update_stats(evocore_population_t *pop) {
         pop->worst_fitness = INFINITY;
         pop->avg_fitness = NAN;
         pop->best_index = 0;
+        pop->fitness_sum = 0.0;
+        pop->valid_count = 0;
+        pop->stats_dirty = false;
         return EVOCORE_OK;
     }
 
@@ -265,20 +628,55 @@ evocore_error_t evocore_population_update_stats(evocore_population_t *pop) {
     }
 
     pop->avg_fitness = (valid_count > 0) ? (sum / valid_count) : NAN;
+    pop->fitness_sum = sum;
+    pop->valid_count = valid_count;
+    pop->stats_dirty = false;
 
     return EVOCORE_OK;
 }
 
+evocore_error_t evocore_population_refresh_stats(evocore_population_t *pop) {
+    if (!pop) return EVOCORE_ERR_NULL_PTR;
+    if (!pop->stats_dirty) return EVOCORE_OK;
+    return evocore_population_update_stats(pop);
+}
+
 evocore_error_t evocore_population_sort(evocore_population_t *pop) {
     if (!pop) return EVOCORE_ERR_NULL_PTR;
     if (pop->size < 2) return EVOCORE_OK;
 
+    EVOCORE_PHASE_BEGIN(phase_start);
+
     qsort(pop->individuals, pop->size,
           sizeof(evocore_individual_t), compare_individuals_desc);
 
     /* Update best index after sort */
     evocore_population_update_stats(pop);
 
+    EVOCORE_PHASE_END(phase_start, EVOCORE_PHASE_SELECTION);
+
+    return EVOCORE_OK;
+}
+
+evocore_error_t evocore_population_select_top(evocore_population_t *pop,
+                                          size_t k) {
+    if (!pop) return EVOCORE_ERR_NULL_PTR;
+    if (pop->size < 2 || k == 0) return EVOCORE_OK;
+    if (k >= pop->size) return evocore_population_sort(pop);
+
+    EVOCORE_PHASE_BEGIN(phase_start);
+
+    individuals_select_top(pop->individuals, pop->size, k);
+
+    /* Order just the selected prefix for elitism */
+    qsort(pop->individuals, k,
+          sizeof(evocore_individual_t), compare_individuals_desc);
+
+    /* Update best index after the shuffle */
+    evocore_population_update_stats(pop);
+
+    EVOCORE_PHASE_END(phase_start, EVOCORE_PHASE_SELECTION);
+
     return EVOCORE_OK;
 }
 
@@ -289,10 +687,15 @@ evocore_error_t evocore_population_sort(evocore_population_t *pop) {
 size_t evocore_population_tournament_select(const evocore_population_t *pop,
                                           size_t tournament_size,
                                           unsigned int *seed) {
-    if (!pop || !seed) return SIZE_MAX;
+    if (!pop) return SIZE_MAX;
     if (pop->size == 0) return SIZE_MAX;
 
-    size_t best_idx = rand_r(seed) % pop->size;
+    EVOCORE_PHASE_BEGIN(phase_start);
+
+    /* NULL seed draws from the thread-local PRNG service, which is
+     * faster than rand_r and contention-free under OpenMP */
+    size_t best_idx = seed ? (size_t)(rand_r(seed) % pop->size)
+                           : evocore_random_range(pop->size);
     double best_fitness = pop->individuals[best_idx].fitness;
 
     /* Adjust tournament size if population is smaller */
@@ -301,7 +704,8 @@ size_t evocore_population_tournament_select(const evocore_population_t *pop,
     }
 
     for (size_t i = 1; i < tournament_size; i++) {
-        size_t idx = rand_r(seed) % pop->size;
+        size_t idx = seed ? (size_t)(rand_r(seed) % pop->size)
+                          : evocore_random_range(pop->size);
         double f = pop->individuals[idx].fitness;
 
         if (!isnan(f) && (isnan(best_fitness) || f > best_fitness)) {
@@ -310,6 +714,8 @@ size_t evocore_population_tournament_select(const evocore_population_t *pop,
         }
     }
 
+    EVOCORE_PHASE_END(phase_start, EVOCORE_PHASE_SELECTION);
+
     return best_idx;
 }
 
@@ -318,6 +724,12 @@ evocore_error_t evocore_population_truncate(evocore_population_t *pop,
     if (!pop) return EVOCORE_ERR_NULL_PTR;
     if (n > pop->capacity) n = pop->capacity;
 
+    /* Partial selection moves the survivors to the front, so the
+     * population doesn't need to be pre-sorted and no full sort is paid */
+    if (n < pop->size) {
+        EVOCORE_CHECK(evocore_population_select_top(pop, n));
+    }
+
     /* Remove individuals from n to size */
     while (pop->size > n) {
         EVOCORE_CHECK(evocore_population_remove(pop, pop->size - 1));
@@ -390,14 +802,24 @@ evocore_error_t evocore_genome_crossover(const evocore_genome_t *parent1,
 evocore_error_t evocore_genome_mutate(evocore_genome_t *genome,
                                    double rate,
                                    unsigned int *seed) {
-    if (!genome || !seed) return EVOCORE_ERR_NULL_PTR;
+    if (!genome) return EVOCORE_ERR_NULL_PTR;
     if (!genome->data) return EVOCORE_ERR_GENOME_EMPTY;
 
     unsigned char *data = (unsigned char*)genome->data;
-    for (size_t i = 0; i < genome->size; i++) {
-        double r = (double)rand_r(seed) / (double)RAND_MAX;
-        if (r < rate) {
-            data[i] = (unsigned char)rand_r(seed);
+
+    if (seed) {
+        for (size_t i = 0; i < genome->size; i++) {
+            double r = (double)rand_r(seed) / (double)RAND_MAX;
+            if (r < rate) {
+                data[i] = (unsigned char)rand_r(seed);
+            }
+        }
+    } else {
+        /* Thread-local PRNG service */
+        for (size_t i = 0; i < genome->size; i++) {
+            if (evocore_random_double() < rate) {
+                data[i] = (unsigned char)evocore_random_u64();
+            }
         }
     }
 
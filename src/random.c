@@ -0,0 +1,177 @@
+#define _GNU_SOURCE
+#include "evocore/random.h"
+#include <stdbool.h>
+#include <string.h>
+#include <time.h>
+
+/*========================================================================
+ * Global Seeding
+ *========================================================================*/
+
+/* Bumped by evocore_random_seed; threads re-derive their stream when
+ * their cached epoch falls behind */
+static uint64_t g_random_epoch = 1;
+static uint64_t g_random_seed = 0;     /* 0 = seed from the clock on first use */
+static uint64_t g_random_stream = 0;   /* Next per-thread stream number */
+
+/* Per-thread generator, padded to a cache line out of habit - TLS is
+ * already thread-private, but keeps adjacent TLS variables off the
+ * same line */
+typedef struct {
+    evocore_random_state_t state;
+    uint64_t epoch;                    /* 0 = not yet initialized */
+} __attribute__((aligned(64))) random_tls_t;
+
+static __thread random_tls_t t_rng;
+
+/*========================================================================
+ * Generators
+ *========================================================================*/
+
+static inline uint64_t rotl64(uint64_t x, int k) {
+    return (x << k) | (x >> (64 - k));
+}
+
+static uint64_t splitmix64(uint64_t *x) {
+    uint64_t z = (*x += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+void evocore_random_state_init(evocore_random_state_t *state, uint64_t seed) {
+    if (!state) return;
+
+    for (int i = 0; i < 4; i++) {
+        state->s[i] = splitmix64(&seed);
+    }
+}
+
+uint64_t evocore_random_state_next(evocore_random_state_t *state) {
+    uint64_t *s = state->s;
+    uint64_t result = rotl64(s[0] + s[3], 23) + s[0];
+
+    uint64_t t = s[1] << 17;
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = rotl64(s[3], 45);
+
+    return result;
+}
+
+/*========================================================================
+ * Thread-Local Service
+ *========================================================================*/
+
+static evocore_random_state_t* random_tls(void) {
+    uint64_t epoch = __atomic_load_n(&g_random_epoch, __ATOMIC_ACQUIRE);
+    if (t_rng.epoch != epoch) {
+        uint64_t base = __atomic_load_n(&g_random_seed, __ATOMIC_ACQUIRE);
+        if (base == 0) {
+            /* First use without an explicit seed: derive one from the
+             * clock, shared by all threads via CAS so streams stay
+             * distinct */
+            struct timespec ts;
+            clock_gettime(CLOCK_MONOTONIC, &ts);
+            uint64_t derived = (uint64_t)ts.tv_sec * 1000000000ULL +
+                               (uint64_t)ts.tv_nsec;
+            derived |= 1;  /* Keep 0 reserved for "unseeded" */
+            if (__atomic_compare_exchange_n(&g_random_seed, &base, derived,
+                                            false, __ATOMIC_ACQ_REL,
+                                            __ATOMIC_ACQUIRE)) {
+                base = derived;
+            }
+            /* On CAS failure, base holds the seed another thread won with */
+        }
+
+        uint64_t stream = __atomic_fetch_add(&g_random_stream, 1,
+                                             __ATOMIC_RELAXED);
+        evocore_random_state_init(&t_rng.state,
+                                  base + stream * 0x9E3779B97F4A7C15ULL);
+        t_rng.epoch = epoch;
+    }
+
+    return &t_rng.state;
+}
+
+void evocore_random_seed(uint64_t seed) {
+    __atomic_store_n(&g_random_seed, seed, __ATOMIC_RELEASE);
+    __atomic_store_n(&g_random_stream, 0, __ATOMIC_RELAXED);
+    __atomic_add_fetch(&g_random_epoch, 1, __ATOMIC_ACQ_REL);
+}
+
+uint64_t evocore_random_u64(void) {
+    return evocore_random_state_next(random_tls());
+}
+
+double evocore_random_double(void) {
+    /* Top 53 bits scaled into [0, 1) */
+    return (double)(evocore_random_state_next(random_tls()) >> 11) *
+           (1.0 / 9007199254740992.0);
+}
+
+size_t evocore_random_range(size_t bound) {
+    if (bound == 0) return 0;
+
+    /* Fixed-point multiply: maps the 64-bit draw into [0, bound)
+     * without modulo bias for bounds far below 2^64 */
+    return (size_t)(((unsigned __int128)evocore_random_state_next(random_tls()) *
+                     bound) >> 64);
+}
+
+/*========================================================================
+ * Bulk Generation
+ *========================================================================*/
+
+void evocore_random_fill_u64(uint64_t *out, size_t count) {
+    if (!out || count == 0) return;
+
+    /* Keep the state in registers across the loop instead of reloading
+     * TLS per draw */
+    evocore_random_state_t *tls = random_tls();
+    evocore_random_state_t local = *tls;
+
+    for (size_t i = 0; i < count; i++) {
+        out[i] = evocore_random_state_next(&local);
+    }
+
+    *tls = local;
+}
+
+void evocore_random_fill_double(double *out, size_t count) {
+    if (!out || count == 0) return;
+
+    evocore_random_state_t *tls = random_tls();
+    evocore_random_state_t local = *tls;
+
+    for (size_t i = 0; i < count; i++) {
+        out[i] = (double)(evocore_random_state_next(&local) >> 11) *
+                 (1.0 / 9007199254740992.0);
+    }
+
+    *tls = local;
+}
+
+void evocore_random_fill_bytes(void *out, size_t size) {
+    if (!out || size == 0) return;
+
+    evocore_random_state_t *tls = random_tls();
+    evocore_random_state_t local = *tls;
+    unsigned char *p = (unsigned char*)out;
+
+    while (size >= sizeof(uint64_t)) {
+        uint64_t v = evocore_random_state_next(&local);
+        memcpy(p, &v, sizeof(v));
+        p += sizeof(v);
+        size -= sizeof(v);
+    }
+    if (size > 0) {
+        uint64_t v = evocore_random_state_next(&local);
+        memcpy(p, &v, size);
+    }
+
+    *tls = local;
+}
@@ -9,6 +9,7 @@
 #include "internal.h"
 #include <stdio.h>
 #include <stdlib.h>
+#include <stdint.h>
 #include <string.h>
 #include <math.h>
 #include <time.h>
@@ -20,6 +21,268 @@
 #include <omp.h>
 #endif
 
+/*========================================================================
+ * Per-Phase Instrumentation
+ *======================================================================== */
+
+/* Global aggregator: instrumented paths run on arbitrary threads
+ * (OpenMP workers, the pthread eval pool), so updates use relaxed
+ * atomics. Aggregates, not ordering, are all that matters here. */
+static evocore_phase_timing_t g_phase_timing[EVOCORE_PHASE_COUNT];
+
+const char* evocore_phase_name(evocore_phase_t phase) {
+    switch (phase) {
+        case EVOCORE_PHASE_SELECTION:      return "selection";
+        case EVOCORE_PHASE_MUTATION:       return "mutation";
+        case EVOCORE_PHASE_EVALUATION:     return "evaluation";
+        case EVOCORE_PHASE_CONTEXT_LEARN:  return "context_learn";
+        case EVOCORE_PHASE_TEMPORAL_LEARN: return "temporal_learn";
+        default:                           return "unknown";
+    }
+}
+
+void evocore_phase_timing_record(evocore_phase_t phase, uint64_t elapsed_ns) {
+#ifdef EVOCORE_PHASE_TIMING
+    if (phase >= EVOCORE_PHASE_COUNT) return;
+
+    evocore_phase_timing_t *timing = &g_phase_timing[phase];
+
+    /* ilog2 of the duration picks the bucket */
+    int bucket = 63 - __builtin_clzll(elapsed_ns | 1);
+    if (bucket >= EVOCORE_PHASE_HIST_BUCKETS) {
+        bucket = EVOCORE_PHASE_HIST_BUCKETS - 1;
+    }
+
+    __atomic_fetch_add(&timing->count, 1, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&timing->total_ns, elapsed_ns, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&timing->buckets[bucket], 1, __ATOMIC_RELAXED);
+#else
+    (void)phase;
+    (void)elapsed_ns;
+#endif
+}
+
+void evocore_phase_timing_snapshot(evocore_phase_timing_t out[EVOCORE_PHASE_COUNT]) {
+    if (!out) return;
+    memcpy(out, g_phase_timing, sizeof(g_phase_timing));
+}
+
+void evocore_phase_timing_reset(void) {
+    memset(g_phase_timing, 0, sizeof(g_phase_timing));
+}
+
+double evocore_phase_timing_percentile(const evocore_phase_timing_t *timing,
+                                      double percentile) {
+    if (!timing || timing->count == 0) return 0.0;
+
+    if (percentile < 0.0) percentile = 0.0;
+    if (percentile > 100.0) percentile = 100.0;
+
+    uint64_t rank = (uint64_t)((percentile / 100.0) * (double)(timing->count - 1));
+    uint64_t seen = 0;
+
+    for (int i = 0; i < EVOCORE_PHASE_HIST_BUCKETS; i++) {
+        seen += timing->buckets[i];
+        if (seen > rank) {
+            /* Geometric midpoint of [2^i, 2^(i+1)) */
+            return (double)(1ull << i) * 1.5;
+        }
+    }
+
+    return 0.0;
+}
+
+/*========================================================================
+ * Trace Timeline Export
+ *======================================================================== */
+
+#define TRACE_DEFAULT_RING_CAPACITY 8192
+
+typedef struct {
+    uint64_t begin_ns;
+    uint64_t end_ns;
+    uint64_t generation;
+    const char *name;        /* Static string, stored by pointer */
+} trace_event_t;
+
+/* One ring per recording thread; rings live until process exit so the
+ * dump path never races a thread teardown. Memory is bounded at
+ * (threads that ever recorded) * capacity. */
+typedef struct trace_ring {
+    trace_event_t *events;
+    size_t capacity;
+    size_t head;             /* Events written; slot = head % capacity */
+    unsigned long tid;       /* Small stable id for the trace output */
+    struct trace_ring *next;
+} trace_ring_t;
+
+static int g_trace_enabled = 0;  /* One relaxed load on the record path */
+static size_t g_trace_capacity = TRACE_DEFAULT_RING_CAPACITY;
+static size_t g_trace_generation = 0;
+static trace_ring_t *g_trace_rings = NULL;
+static unsigned long g_trace_next_tid = 0;
+
+#ifdef EVOCORE_HAVE_PTHREADS
+#include <pthread.h>
+
+static pthread_mutex_t g_trace_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_key_t g_trace_key;
+static pthread_once_t g_trace_once = PTHREAD_ONCE_INIT;
+
+static void trace_key_init(void) {
+    /* No destructor: rings outlive their threads on purpose */
+    pthread_key_create(&g_trace_key, NULL);
+}
+#endif
+
+/* Get (or lazily create and register) the calling thread's ring */
+static trace_ring_t* trace_get_ring(void) {
+#ifdef EVOCORE_HAVE_PTHREADS
+    pthread_once(&g_trace_once, trace_key_init);
+
+    trace_ring_t *ring = (trace_ring_t*)pthread_getspecific(g_trace_key);
+    if (!ring) {
+        ring = (trace_ring_t*)evocore_calloc(1, sizeof(trace_ring_t));
+        if (!ring) return NULL;
+        ring->events = (trace_event_t*)evocore_calloc(g_trace_capacity,
+                                                      sizeof(trace_event_t));
+        if (!ring->events) {
+            evocore_free(ring);
+            return NULL;
+        }
+        ring->capacity = g_trace_capacity;
+
+        pthread_mutex_lock(&g_trace_lock);
+        ring->tid = ++g_trace_next_tid;
+        ring->next = g_trace_rings;
+        g_trace_rings = ring;
+        pthread_mutex_unlock(&g_trace_lock);
+
+        pthread_setspecific(g_trace_key, ring);
+    }
+    return ring;
+#else
+    static trace_ring_t *ring = NULL;
+    if (!ring) {
+        ring = (trace_ring_t*)evocore_calloc(1, sizeof(trace_ring_t));
+        if (!ring) return NULL;
+        ring->events = (trace_event_t*)evocore_calloc(g_trace_capacity,
+                                                      sizeof(trace_event_t));
+        if (!ring->events) {
+            evocore_free(ring);
+            ring = NULL;
+            return NULL;
+        }
+        ring->capacity = g_trace_capacity;
+        ring->tid = ++g_trace_next_tid;
+        g_trace_rings = ring;
+    }
+    return ring;
+#endif
+}
+
+evocore_error_t evocore_trace_start(size_t events_per_thread) {
+#ifdef EVOCORE_HAVE_PTHREADS
+    pthread_mutex_lock(&g_trace_lock);
+#endif
+    /* Capacity is fixed by the first start; existing rings keep theirs */
+    if (!g_trace_rings && events_per_thread > 0) {
+        g_trace_capacity = events_per_thread;
+    }
+    for (trace_ring_t *ring = g_trace_rings; ring; ring = ring->next) {
+        ring->head = 0;
+    }
+#ifdef EVOCORE_HAVE_PTHREADS
+    pthread_mutex_unlock(&g_trace_lock);
+#endif
+
+    __atomic_store_n(&g_trace_enabled, 1, __ATOMIC_RELEASE);
+    return EVOCORE_OK;
+}
+
+void evocore_trace_stop(void) {
+    __atomic_store_n(&g_trace_enabled, 0, __ATOMIC_RELAXED);
+}
+
+bool evocore_trace_enabled(void) {
+    return __atomic_load_n(&g_trace_enabled, __ATOMIC_RELAXED) != 0;
+}
+
+void evocore_trace_set_generation(size_t generation) {
+    __atomic_store_n(&g_trace_generation, generation, __ATOMIC_RELAXED);
+}
+
+void evocore_trace_record(const char *name, uint64_t begin_ns,
+                          uint64_t end_ns) {
+    if (!__atomic_load_n(&g_trace_enabled, __ATOMIC_RELAXED)) {
+        return;
+    }
+    if (!name || end_ns < begin_ns) {
+        return;
+    }
+
+    trace_ring_t *ring = trace_get_ring();
+    if (!ring) {
+        return;
+    }
+
+    trace_event_t *ev = &ring->events[ring->head % ring->capacity];
+    ev->begin_ns = begin_ns;
+    ev->end_ns = end_ns;
+    ev->generation = __atomic_load_n(&g_trace_generation, __ATOMIC_RELAXED);
+    ev->name = name;
+    ring->head++;  /* Ring is thread-private; plain store is enough */
+}
+
+evocore_error_t evocore_trace_dump(const char *filepath) {
+    if (!filepath) {
+        return EVOCORE_ERR_NULL_PTR;
+    }
+
+    FILE *file = fopen(filepath, "w");
+    if (!file) {
+        return EVOCORE_ERR_FILE_WRITE;
+    }
+
+    fprintf(file, "{\"traceEvents\":[");
+
+#ifdef EVOCORE_HAVE_PTHREADS
+    pthread_mutex_lock(&g_trace_lock);
+#endif
+
+    bool first = true;
+    int pid = (int)getpid();
+    for (trace_ring_t *ring = g_trace_rings; ring; ring = ring->next) {
+        size_t count = ring->head < ring->capacity ? ring->head
+                                                   : ring->capacity;
+        size_t start = ring->head - count;
+        for (size_t k = 0; k < count; k++) {
+            const trace_event_t *ev =
+                &ring->events[(start + k) % ring->capacity];
+            /* Trace Event Format "X": complete event, timestamps in us */
+            fprintf(file,
+                    "%s\n{\"name\":\"%s\",\"ph\":\"X\",\"pid\":%d,"
+                    "\"tid\":%lu,\"ts\":%.3f,\"dur\":%.3f,"
+                    "\"args\":{\"generation\":%llu}}",
+                    first ? "" : ",",
+                    ev->name, pid, ring->tid,
+                    (double)ev->begin_ns / 1000.0,
+                    (double)(ev->end_ns - ev->begin_ns) / 1000.0,
+                    (unsigned long long)ev->generation);
+            first = false;
+        }
+    }
+
+#ifdef EVOCORE_HAVE_PTHREADS
+    pthread_mutex_unlock(&g_trace_lock);
+#endif
+
+    fprintf(file, "\n]}\n");
+    fclose(file);
+
+    return EVOCORE_OK;
+}
+
 /*========================================================================
  * Internal Helpers
  *======================================================================== */
@@ -114,9 +377,82 @@ evocore_error_t evocore_stats_update(evocore_stats_t *stats,
         stats->memory_usage_bytes = mem_stats.current_allocated;
     }
 
+    /* Snapshot per-phase timing if enabled */
+    if (stats->track_timing) {
+        evocore_phase_timing_snapshot(stats->phase_timing);
+    }
+
     return EVOCORE_OK;
 }
 
+/*========================================================================
+ * Published Statistics Snapshots
+ *======================================================================== */
+
+/* Classic seqlock: sequence is odd while a publish is in flight.
+ * Readers copy the buffer and retry when the sequence moved (or was
+ * odd) around their copy; the writer never waits for anyone. */
+struct evocore_stats_publisher_t {
+    unsigned long sequence;       /* Even = stable, odd = publish in flight */
+    evocore_stats_t snapshot;
+};
+
+evocore_stats_publisher_t* evocore_stats_publisher_create(void) {
+    /* Zeroed: sequence 0 means "nothing published yet" */
+    return (evocore_stats_publisher_t*)
+        evocore_calloc(1, sizeof(evocore_stats_publisher_t));
+}
+
+void evocore_stats_publisher_destroy(evocore_stats_publisher_t *pub) {
+    if (pub) {
+        evocore_free(pub);
+    }
+}
+
+evocore_error_t evocore_stats_publish(evocore_stats_publisher_t *pub,
+                                      const evocore_stats_t *stats) {
+    if (!pub || !stats) {
+        return EVOCORE_ERR_NULL_PTR;
+    }
+
+    /* Odd sequence tells readers a write is in flight; release ordering
+     * on the closing increment makes the copied bytes visible before
+     * the even value */
+    __atomic_fetch_add(&pub->sequence, 1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+
+    memcpy(&pub->snapshot, stats, sizeof(evocore_stats_t));
+
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    __atomic_fetch_add(&pub->sequence, 1, __ATOMIC_RELEASE);
+
+    return EVOCORE_OK;
+}
+
+evocore_error_t evocore_stats_read(const evocore_stats_publisher_t *pub,
+                                   evocore_stats_t *out) {
+    if (!pub || !out) {
+        return EVOCORE_ERR_NULL_PTR;
+    }
+
+    for (;;) {
+        unsigned long seq1 = __atomic_load_n(&pub->sequence, __ATOMIC_ACQUIRE);
+        if (seq1 == 0) {
+            return EVOCORE_ERR_UNKNOWN;  /* Nothing published yet */
+        }
+        if (seq1 & 1) {
+            continue;  /* Publish in flight, retry */
+        }
+
+        memcpy(out, &pub->snapshot, sizeof(evocore_stats_t));
+
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        if (__atomic_load_n(&pub->sequence, __ATOMIC_RELAXED) == seq1) {
+            return EVOCORE_OK;
+        }
+    }
+}
+
 evocore_error_t evocore_stats_record_operations(evocore_stats_t *stats,
                                           long long eval_count,
                                           long long mutations,
@@ -147,45 +483,125 @@ bool evocore_stats_is_stagnant(const evocore_stats_t *stats) {
     return stats->convergence_streak > 20;
 }
 
-double evocore_stats_diversity(const evocore_population_t *pop) {
-    if (!pop || pop->size == 0) {
+/**
+ * Count differing bytes between two buffers
+ *
+ * Word-wide XOR + popcount fast path; the per-byte set/unset trick
+ * ((w | (w >> 4)) style folding) collapses each differing byte to a
+ * single counted bit.
+ */
+static size_t bytewise_distance(const unsigned char *a,
+                                const unsigned char *b,
+                                size_t size) {
+    size_t distance = 0;
+    size_t i = 0;
+
+    for (; i + 8 <= size; i += 8) {
+        uint64_t wa, wb;
+        memcpy(&wa, a + i, 8);
+        memcpy(&wb, b + i, 8);
+        uint64_t x = wa ^ wb;
+        /* Fold each nonzero byte of x down to its low bit */
+        x |= x >> 4;
+        x |= x >> 2;
+        x |= x >> 1;
+        x &= 0x0101010101010101ULL;
+        distance += (size_t)__builtin_popcountll(x);
+    }
+
+    for (; i < size; i++) {
+        if (a[i] != b[i]) distance++;
+    }
+
+    return distance;
+}
+
+/**
+ * Normalized distance between one sampled pair, or -1 if the pair
+ * cannot be compared
+ */
+static double sampled_pair_distance(const evocore_population_t *pop,
+                                    unsigned int *seed) {
+    size_t i = (size_t)rand_r(seed) % pop->size;
+    size_t j = (size_t)rand_r(seed) % pop->size;
+    if (i == j) {
+        j = (j + 1) % pop->size;
+    }
+
+    const evocore_genome_t *g1 = pop->individuals[i].genome;
+    const evocore_genome_t *g2 = pop->individuals[j].genome;
+    if (!g1 || !g1->data || !g2 || !g2->data) {
+        return -1.0;
+    }
+
+    size_t min_size = g1->size < g2->size ? g1->size : g2->size;
+    size_t max_size = g1->size > g2->size ? g1->size : g2->size;
+    if (max_size == 0) {
         return 0.0;
     }
 
-    /* Calculate normalized diversity score */
-    /* Based on average pairwise Hamming distance */
+    size_t distance = bytewise_distance((const unsigned char*)g1->data,
+                                        (const unsigned char*)g2->data,
+                                        min_size);
+    /* Bytes only present in the longer genome count as different */
+    distance += max_size - min_size;
 
-    /* For efficiency, sample pairs instead of checking all */
-    const int samples = 100;
-    double total_distance = 0.0;
-    int sample_count = 0;
+    return (double)distance / (double)max_size;
+}
 
-    unsigned int seed = (unsigned int)time(NULL);
+double evocore_stats_diversity_estimate(const evocore_population_t *pop,
+                                       double target_stderr,
+                                       unsigned int *seed,
+                                       double *out_stderr) {
+    if (out_stderr) *out_stderr = 0.0;
+    if (!pop || pop->size < 2 || !seed) {
+        return 0.0;
+    }
+
+    if (target_stderr <= 0.0) {
+        target_stderr = 0.01;
+    }
 
-    for (int i = 0; i < samples && (size_t)i < pop->size; i++) {
-        int j = (int)((size_t)i + rand_r(&seed)) % pop->size;
-        if (i != j) {
-            const evocore_genome_t *g1 = pop->individuals[i].genome;
-            const evocore_genome_t *g2 = pop->individuals[j].genome;
-
-            if (g1 && g1->data && g2 && g2->data) {
-                size_t min_size = g1->size < g2->size ? g1->size : g2->size;
-                size_t distance = 0;
-                for (size_t k = 0; k < min_size; k++) {
-                    unsigned char b1 = ((unsigned char*)g1->data)[k];
-                    unsigned char b2 = ((unsigned char*)g2->data)[k];
-                    if (b1 != b2) distance++;
-                }
-
-                /* Normalize by genome size */
-                total_distance += (double)distance / (double)g1->capacity;
-                sample_count++;
+    /* Welford running mean/variance over sampled pair distances; stop
+     * once the standard error meets the confidence target */
+    const size_t min_samples = 32;
+    const size_t max_samples = 4096;
+    double mean = 0.0;
+    double m2 = 0.0;
+    size_t count = 0;
+
+    for (size_t s = 0; s < max_samples; s++) {
+        double d = sampled_pair_distance(pop, seed);
+        if (d < 0.0) continue;
+
+        count++;
+        double delta = d - mean;
+        mean += delta / (double)count;
+        m2 += delta * (d - mean);
+
+        if (count >= min_samples) {
+            double stderr_est = sqrt(m2 / (double)(count - 1) / (double)count);
+            if (stderr_est <= target_stderr) {
+                if (out_stderr) *out_stderr = stderr_est;
+                return mean;
             }
         }
     }
 
-    if (sample_count == 0) return 0.0;
-    return total_distance / (double)sample_count;
+    if (count == 0) return 0.0;
+    if (out_stderr && count > 1) {
+        *out_stderr = sqrt(m2 / (double)(count - 1) / (double)count);
+    }
+    return mean;
+}
+
+double evocore_stats_diversity(const evocore_population_t *pop) {
+    if (!pop || pop->size == 0) {
+        return 0.0;
+    }
+
+    unsigned int seed = (unsigned int)time(NULL);
+    return evocore_stats_diversity_estimate(pop, 0.01, &seed, NULL);
 }
 
 evocore_error_t evocore_stats_fitness_distribution(const evocore_population_t *pop,
@@ -0,0 +1,245 @@
+#define _GNU_SOURCE
+#include "evocore/steady_state.h"
+#include "evocore/log.h"
+#include "internal.h"
+#include <string.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+
+/*========================================================================
+ * Engine State
+ *========================================================================*/
+
+#define STEADY_STATE_DEFAULT_TOURNAMENT 3
+
+struct evocore_steady_state_t {
+    evocore_population_t *pop;
+    const evocore_domain_t *domain;
+    evocore_steady_state_config_t config;
+    unsigned int seed;
+
+    /* Offspring buffers, recycled across steps: the step swap-replaces
+     * the victim, which hands its storage back into child */
+    evocore_genome_t child;
+    evocore_genome_t scratch;   /* Second crossover child, discarded */
+
+    uint64_t steps;
+    uint64_t improved;
+};
+
+/*========================================================================
+ * Internal Helpers
+ *========================================================================*/
+
+/**
+ * Index of the replacement victim: the first unevaluated individual if
+ * any, otherwise the one with the lowest fitness
+ */
+static size_t steady_state_worst_index(const evocore_population_t *pop) {
+    size_t worst = 0;
+    double worst_fitness = INFINITY;
+
+    for (size_t i = 0; i < pop->size; i++) {
+        double f = pop->individuals[i].fitness;
+        if (isnan(f)) {
+            return i;
+        }
+        if (f < worst_fitness) {
+            worst_fitness = f;
+            worst = i;
+        }
+    }
+
+    return worst;
+}
+
+/**
+ * Make sure a reused offspring buffer can hold size bytes
+ */
+static evocore_error_t steady_state_reserve(evocore_genome_t *genome,
+                                        size_t size) {
+    if (size > genome->capacity) {
+        EVOCORE_CHECK(evocore_genome_resize(genome, size));
+    }
+    return evocore_genome_set_size(genome, size);
+}
+
+/**
+ * Build the offspring into engine->child without allocating
+ */
+static evocore_error_t steady_state_produce(evocore_steady_state_t *engine,
+                                        const evocore_genome_t *p1,
+                                        const evocore_genome_t *p2,
+                                        bool crossover) {
+    const evocore_domain_t *domain = engine->domain;
+
+    if (crossover && domain->genome_ops.crossover) {
+        EVOCORE_CHECK(steady_state_reserve(&engine->child, p1->size));
+        EVOCORE_CHECK(steady_state_reserve(&engine->scratch, p2->size));
+        domain->genome_ops.crossover(p1, p2, &engine->child, &engine->scratch,
+                                     domain->user_context);
+        return EVOCORE_OK;
+    }
+
+    if (crossover) {
+        /* Uniform byte crossover into the reused buffer (the shared
+         * evocore_genome_crossover allocates its children, which would
+         * defeat buffer recycling) */
+        size_t size = p1->size < p2->size ? p1->size : p2->size;
+        EVOCORE_CHECK(steady_state_reserve(&engine->child, size));
+
+        const unsigned char *a = (const unsigned char*)p1->data;
+        const unsigned char *b = (const unsigned char*)p2->data;
+        unsigned char *out = (unsigned char*)engine->child.data;
+        for (size_t i = 0; i < size; i++) {
+            out[i] = (rand_r(&engine->seed) & 1) ? a[i] : b[i];
+        }
+        return EVOCORE_OK;
+    }
+
+    /* Mutated copy of the first parent */
+    EVOCORE_CHECK(steady_state_reserve(&engine->child, p1->size));
+    memcpy(engine->child.data, p1->data, p1->size);
+    return EVOCORE_OK;
+}
+
+/*========================================================================
+ * Public API
+ *========================================================================*/
+
+evocore_steady_state_t* evocore_steady_state_create(
+    evocore_population_t *pop,
+    const evocore_domain_t *domain,
+    const evocore_steady_state_config_t *config) {
+
+    if (!pop || !domain) {
+        return NULL;
+    }
+
+    evocore_steady_state_t *engine = (evocore_steady_state_t*)
+        evocore_calloc(1, sizeof(evocore_steady_state_t));
+    if (!engine) {
+        return NULL;
+    }
+
+    if (config) {
+        engine->config = *config;
+    } else {
+        evocore_steady_state_config_t defaults = EVOCORE_STEADY_STATE_DEFAULTS;
+        engine->config = defaults;
+    }
+    if (engine->config.tournament_size == 0) {
+        engine->config.tournament_size = STEADY_STATE_DEFAULT_TOURNAMENT;
+    }
+
+    engine->pop = pop;
+    engine->domain = domain;
+    engine->seed = engine->config.seed ? engine->config.seed
+                                       : (unsigned int)time(NULL);
+
+    size_t capacity = domain->genome_size > 0 ? domain->genome_size
+                                              : EVOCORE_MIN_CAPACITY;
+    if (evocore_genome_init(&engine->child, capacity) != EVOCORE_OK ||
+        evocore_genome_init(&engine->scratch, capacity) != EVOCORE_OK) {
+        evocore_genome_cleanup(&engine->child);
+        evocore_free(engine);
+        return NULL;
+    }
+
+    return engine;
+}
+
+evocore_error_t evocore_steady_state_step(evocore_steady_state_t *engine) {
+    if (!engine) {
+        return EVOCORE_ERR_NULL_PTR;
+    }
+
+    evocore_population_t *pop = engine->pop;
+    if (pop->size < 2) {
+        return EVOCORE_ERR_INVALID_ARG;  /* Nothing to select between */
+    }
+
+    size_t p1 = evocore_population_tournament_select(
+        pop, engine->config.tournament_size, &engine->seed);
+    size_t p2 = evocore_population_tournament_select(
+        pop, engine->config.tournament_size, &engine->seed);
+    if (p1 == SIZE_MAX || p2 == SIZE_MAX) {
+        return EVOCORE_ERR_INVALID_ARG;
+    }
+
+    const evocore_genome_t *g1 = pop->individuals[p1].genome;
+    const evocore_genome_t *g2 = pop->individuals[p2].genome;
+    if (!g1 || !g2) {
+        return EVOCORE_ERR_GENOME_EMPTY;
+    }
+
+    bool crossover = p1 != p2 &&
+                     (double)rand_r(&engine->seed) / RAND_MAX <
+                         engine->config.crossover_rate;
+    EVOCORE_CHECK(steady_state_produce(engine, g1, g2, crossover));
+
+    if (engine->domain->genome_ops.mutate) {
+        engine->domain->genome_ops.mutate(&engine->child,
+                                          engine->config.mutation_rate,
+                                          engine->domain->user_context);
+    } else {
+        EVOCORE_CHECK(evocore_genome_mutate(&engine->child,
+                                          engine->config.mutation_rate,
+                                          &engine->seed));
+    }
+
+    double fitness = evocore_domain_evaluate_fitness(&engine->child,
+                                                   engine->domain);
+
+    size_t victim = steady_state_worst_index(pop);
+    double old_fitness = pop->individuals[victim].fitness;
+
+    /* Swap-replace: the victim's buffer comes back into child for the
+     * next step, so the loop never allocates */
+    EVOCORE_CHECK(evocore_population_replace_swap(pop, victim, &engine->child,
+                                                fitness));
+
+    engine->steps++;
+    if (isnan(old_fitness) || fitness > old_fitness) {
+        engine->improved++;
+    }
+
+    /* One generation-equivalent per population of offspring keeps
+     * generation-based cadence meaningful */
+    if (engine->steps % pop->size == 0) {
+        pop->generation++;
+    }
+
+    return EVOCORE_OK;
+}
+
+evocore_error_t evocore_steady_state_run(evocore_steady_state_t *engine,
+                                     size_t steps) {
+    if (!engine) {
+        return EVOCORE_ERR_NULL_PTR;
+    }
+
+    for (size_t i = 0; i < steps; i++) {
+        EVOCORE_CHECK(evocore_steady_state_step(engine));
+    }
+
+    return EVOCORE_OK;
+}
+
+void evocore_steady_state_get_stats(const evocore_steady_state_t *engine,
+                                uint64_t *steps,
+                                uint64_t *improved) {
+    if (!engine) return;
+
+    if (steps) *steps = engine->steps;
+    if (improved) *improved = engine->improved;
+}
+
+void evocore_steady_state_destroy(evocore_steady_state_t *engine) {
+    if (!engine) return;
+
+    evocore_genome_cleanup(&engine->child);
+    evocore_genome_cleanup(&engine->scratch);
+    evocore_free(engine);
+}
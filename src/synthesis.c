@@ -6,6 +6,7 @@
 
 #define _GNU_SOURCE
 #include "evocore/synthesis.h"
+#include "evocore/vptree.h"
 #include "evocore/log.h"
 #include <stdlib.h>
 #include <string.h>
@@ -245,6 +246,56 @@ bool evocore_synthesis_weighted(
     return true;
 }
 
+bool evocore_synthesis_weighted_similarity(
+    const evocore_synthesis_request_t *request,
+    evocore_similarity_matrix_t *matrix,
+    const char *target_context,
+    double *out_parameters
+) {
+    if (!request || !out_parameters) return false;
+    if (!matrix || !target_context) {
+        return evocore_synthesis_weighted(request, out_parameters);
+    }
+
+    /* Per-source weight: confidence scaled by cached similarity to the
+     * target; sources the matrix does not know get the similarity
+     * floor rather than being dropped outright */
+    double weight_sum = 0.0;
+    for (size_t s = 0; s < request->source_count; s++) {
+        const evocore_param_source_t *source = &request->sources[s];
+        if (!source->parameters) continue;
+
+        double similarity = evocore_similarity_get(matrix, target_context,
+                                                   source->context_id);
+        if (similarity <= 0.0) similarity = MIN_SIMILARITY;
+        weight_sum += source->confidence * similarity;
+    }
+
+    if (weight_sum < 0.0001) {
+        /* Nothing usable, fall back to plain confidence weighting */
+        return evocore_synthesis_weighted(request, out_parameters);
+    }
+
+    for (size_t i = 0; i < request->target_param_count; i++) {
+        out_parameters[i] = 0.0;
+    }
+    for (size_t s = 0; s < request->source_count; s++) {
+        const evocore_param_source_t *source = &request->sources[s];
+        if (!source->parameters) continue;
+
+        double similarity = evocore_similarity_get(matrix, target_context,
+                                                   source->context_id);
+        if (similarity <= 0.0) similarity = MIN_SIMILARITY;
+        double weight = source->confidence * similarity / weight_sum;
+
+        for (size_t i = 0; i < request->target_param_count; i++) {
+            out_parameters[i] += weight * source->parameters[i];
+        }
+    }
+
+    return true;
+}
+
 bool evocore_synthesis_trend(
     const evocore_synthesis_request_t *request,
     double *out_parameters,
@@ -371,14 +422,47 @@ bool evocore_synthesis_nearest(
     if (!request || !out_parameters) return false;
     if (request->source_count == 0) return false;
 
-    /* For now, just return the first source */
-    const evocore_param_source_t *source = &request->sources[0];
-    if (!source->parameters) return false;
+    /* Target point: confidence-weighted consensus of the sources. The
+     * returned parameters are the single source nearest to it, i.e. the
+     * most representative actually-observed configuration rather than a
+     * blend that may never have been evaluated. */
+    double *target = calloc(request->target_param_count, sizeof(double));
+    if (!target) return false;
 
-    memcpy(out_parameters, source->parameters,
-           request->target_param_count * sizeof(double));
+    if (!evocore_synthesis_weighted(request, target)) {
+        free(target);
+        return false;
+    }
 
-    return true;
+    evocore_vptree_t *index = evocore_vptree_create(request->target_param_count);
+    if (!index) {
+        free(target);
+        return false;
+    }
+
+    for (size_t s = 0; s < request->source_count; s++) {
+        const evocore_param_source_t *source = &request->sources[s];
+        if (!source->parameters) continue;
+
+        if (!evocore_vptree_insert(index, source->parameters,
+                                   (void*)source->parameters)) {
+            evocore_vptree_free(index);
+            free(target);
+            return false;
+        }
+    }
+
+    const double *nearest = NULL;
+    bool found = evocore_vptree_nearest(index, target, &nearest, NULL, NULL);
+    if (found) {
+        memcpy(out_parameters, nearest,
+               request->target_param_count * sizeof(double));
+    }
+
+    evocore_vptree_free(index);
+    free(target);
+
+    return found;
 }
 
 /*========================================================================
@@ -397,28 +481,39 @@ evocore_similarity_matrix_t* evocore_similarity_matrix_create(
     matrix->context_count = context_count;
     matrix->context_ids = context_ids;
     matrix->last_update = time(NULL);
+    matrix->max_distance = MAX_DISTANCE;
 
     matrix->similarity_matrix = calloc(context_count, sizeof(double*));
-    if (!matrix->similarity_matrix) {
+    matrix->valid = calloc(context_count, sizeof(unsigned char*));
+    matrix->params = calloc(context_count, sizeof(double*));
+    if (!matrix->similarity_matrix || !matrix->valid || !matrix->params) {
+        free(matrix->similarity_matrix);
+        free(matrix->valid);
+        free(matrix->params);
         free(matrix);
         return NULL;
     }
 
     for (size_t i = 0; i < context_count; i++) {
         matrix->similarity_matrix[i] = calloc(context_count, sizeof(double));
-        if (!matrix->similarity_matrix[i]) {
-            for (size_t j = 0; j < i; j++) {
+        matrix->valid[i] = calloc(context_count, sizeof(unsigned char));
+        if (!matrix->similarity_matrix[i] || !matrix->valid[i]) {
+            for (size_t j = 0; j <= i; j++) {
                 free(matrix->similarity_matrix[j]);
+                free(matrix->valid[j]);
             }
             free(matrix->similarity_matrix);
+            free(matrix->valid);
+            free(matrix->params);
             free(matrix);
             return NULL;
         }
     }
 
-    /* Initialize diagonal to 1.0 (self-similarity) */
+    /* Initialize diagonal to 1.0 (self-similarity, always current) */
     for (size_t i = 0; i < context_count; i++) {
         matrix->similarity_matrix[i][i] = 1.0;
+        matrix->valid[i][i] = 1;
     }
 
     return matrix;
@@ -427,50 +522,148 @@ evocore_similarity_matrix_t* evocore_similarity_matrix_create(
 void evocore_similarity_matrix_free(evocore_similarity_matrix_t *matrix) {
     if (!matrix) return;
 
-    if (matrix->similarity_matrix) {
-        for (size_t i = 0; i < matrix->context_count; i++) {
-            free(matrix->similarity_matrix[i]);
-        }
-        free(matrix->similarity_matrix);
+    for (size_t i = 0; i < matrix->context_count; i++) {
+        if (matrix->similarity_matrix) free(matrix->similarity_matrix[i]);
+        if (matrix->valid) free(matrix->valid[i]);
+        if (matrix->params) free(matrix->params[i]);
     }
+    free(matrix->similarity_matrix);
+    free(matrix->valid);
+    free(matrix->params);
 
     free(matrix);
 }
 
+/**
+ * Resolve a context ID to its matrix index, or -1 if unknown
+ */
+static long similarity_index_of(
+    const evocore_similarity_matrix_t *matrix,
+    const char *context_id
+) {
+    if (!context_id) return -1;
+
+    for (size_t i = 0; i < matrix->context_count; i++) {
+        if (matrix->context_ids[i] &&
+            strcmp(matrix->context_ids[i], context_id) == 0) {
+            return (long)i;
+        }
+    }
+    return -1;
+}
+
+bool evocore_similarity_set_params(
+    evocore_similarity_matrix_t *matrix,
+    const char *context_id,
+    const double *parameters,
+    size_t param_count
+) {
+    if (!matrix || !parameters || param_count == 0) return false;
+
+    long idx = similarity_index_of(matrix, context_id);
+    if (idx < 0) return false;
+
+    /* First registration fixes the snapshot length */
+    if (matrix->param_count == 0) {
+        matrix->param_count = param_count;
+    } else if (param_count != matrix->param_count) {
+        return false;
+    }
+
+    size_t i = (size_t)idx;
+    if (!matrix->params[i]) {
+        matrix->params[i] = calloc(param_count, sizeof(double));
+        if (!matrix->params[i]) return false;
+    }
+    memcpy(matrix->params[i], parameters, param_count * sizeof(double));
+
+    /* The context moved: everything cached against it is stale */
+    for (size_t j = 0; j < matrix->context_count; j++) {
+        if (j == i) continue;
+        matrix->valid[i][j] = 0;
+        matrix->valid[j][i] = 0;
+    }
+
+    matrix->last_update = time(NULL);
+    return true;
+}
+
 bool evocore_similarity_update(
     evocore_similarity_matrix_t *matrix,
     const char *context_a,
     const char *context_b,
     double similarity
 ) {
-    (void)matrix;
-    (void)context_a;
-    (void)context_b;
-    (void)similarity;
-    /* TODO: implement context ID lookup */
-    return false;
+    if (!matrix) return false;
+
+    long a = similarity_index_of(matrix, context_a);
+    long b = similarity_index_of(matrix, context_b);
+    if (a < 0 || b < 0) return false;
+
+    if (similarity < 0.0) similarity = 0.0;
+    if (similarity > 1.0) similarity = 1.0;
+
+    matrix->similarity_matrix[a][b] = similarity;
+    matrix->similarity_matrix[b][a] = similarity;
+    matrix->valid[a][b] = 1;
+    matrix->valid[b][a] = 1;
+    matrix->last_update = time(NULL);
+    return true;
 }
 
 double evocore_similarity_get(
-    const evocore_similarity_matrix_t *matrix,
+    evocore_similarity_matrix_t *matrix,
     const char *context_a,
     const char *context_b
 ) {
-    (void)matrix;
-    (void)context_a;
-    (void)context_b;
-    /* TODO: implement */
-    return 0.5;
+    if (!matrix) return 0.0;
+
+    long a = similarity_index_of(matrix, context_a);
+    long b = similarity_index_of(matrix, context_b);
+    if (a < 0 || b < 0) return 0.0;
+
+    if (matrix->valid[a][b]) {
+        return matrix->similarity_matrix[a][b];
+    }
+
+    /* Stale or never computed: fill the pair from the snapshots */
+    if (!matrix->params[a] || !matrix->params[b]) return 0.0;
+
+    double similarity = evocore_param_similarity(matrix->params[a],
+                                                 matrix->params[b],
+                                                 matrix->param_count,
+                                                 matrix->max_distance);
+    matrix->similarity_matrix[a][b] = similarity;
+    matrix->similarity_matrix[b][a] = similarity;
+    matrix->valid[a][b] = 1;
+    matrix->valid[b][a] = 1;
+    return similarity;
 }
 
 const char* evocore_similarity_find_nearest(
-    const evocore_similarity_matrix_t *matrix,
+    evocore_similarity_matrix_t *matrix,
     const char *target_context
 ) {
-    (void)matrix;
-    (void)target_context;
-    /* TODO: implement */
-    return NULL;
+    if (!matrix) return NULL;
+
+    long target = similarity_index_of(matrix, target_context);
+    if (target < 0) return NULL;
+
+    const char *best = NULL;
+    double best_similarity = -1.0;
+
+    for (size_t i = 0; i < matrix->context_count; i++) {
+        if ((long)i == target || !matrix->context_ids[i]) continue;
+
+        double similarity = evocore_similarity_get(matrix, target_context,
+                                                   matrix->context_ids[i]);
+        if (similarity > best_similarity) {
+            best_similarity = similarity;
+            best = matrix->context_ids[i];
+        }
+    }
+
+    return best;
 }
 
 double evocore_param_distance(
@@ -511,19 +704,23 @@ bool evocore_transfer_params(
     const double *source_params,
     const char *source_context,
     const char *target_context,
-    const evocore_similarity_matrix_t *similarity_matrix,
+    evocore_similarity_matrix_t *similarity_matrix,
     size_t param_count,
     double *out_params,
     double adjustment_factor
 ) {
-    (void)source_context;
-    (void)target_context;
-    (void)similarity_matrix;
-
     if (!source_params || !out_params) return false;
     if (param_count == 0) return false;
 
-    /* Simple copy with adjustment */
+    /* Similar contexts need less adjustment; without a matrix the full
+     * adjustment applies */
+    if (similarity_matrix && source_context && target_context) {
+        double similarity = evocore_similarity_get(similarity_matrix,
+                                                   source_context,
+                                                   target_context);
+        adjustment_factor *= 1.0 - similarity;
+    }
+
     for (size_t i = 0; i < param_count; i++) {
         out_params[i] = source_params[i] * (1.0 - adjustment_factor);
     }
@@ -533,18 +730,29 @@ bool evocore_transfer_params(
 
 size_t evocore_find_transferable_contexts(
     const char *target_context,
-    const evocore_similarity_matrix_t *similarity_matrix,
+    evocore_similarity_matrix_t *similarity_matrix,
     double min_similarity,
     const char **out_contexts,
     size_t max_contexts
 ) {
-    (void)target_context;
-    (void)similarity_matrix;
-    (void)min_similarity;
-    (void)out_contexts;
-    (void)max_contexts;
-    /* TODO: implement */
-    return 0;
+    if (!similarity_matrix || !out_contexts || max_contexts == 0) return 0;
+
+    size_t found = 0;
+    for (size_t i = 0; i < similarity_matrix->context_count &&
+                       found < max_contexts; i++) {
+        const char *candidate = similarity_matrix->context_ids[i];
+        if (!candidate || (target_context &&
+                           strcmp(candidate, target_context) == 0)) {
+            continue;
+        }
+
+        if (evocore_similarity_get(similarity_matrix, target_context,
+                                   candidate) >= min_similarity) {
+            out_contexts[found++] = candidate;
+        }
+    }
+
+    return found;
 }
 
 /*========================================================================
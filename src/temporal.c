@@ -6,6 +6,7 @@
 
 #define _GNU_SOURCE
 #include "evocore/temporal.h"
+#include "evocore/stats.h"
 #include "evocore/log.h"
 #include "internal.h"
 #include <stdlib.h>
@@ -37,13 +38,66 @@
  * Internal Hash Table
  *========================================================================*/
 
+/*
+ * Each context keeps running regression sums alongside its bucket ring
+ * so trend queries are O(param_count) reads instead of re-running a
+ * regression over the whole bucket history. For the regression
+ *     y_j = mean of bucket j (chronological index j)
+ * we maintain sum_y[i] = Σy and sum_xy[i] = Σj*y per parameter;
+ * Σj and Σj² depend only on the bucket count and have closed forms.
+ * mean_cache holds the bucket means as last folded into the sums
+ * (indexed by ring slot * param_count), so updating a bucket adjusts
+ * the sums by the mean's delta and evicting the oldest re-bases the
+ * indices with one subtraction.
+ */
 typedef struct hash_entry {
     char *key;
     evocore_temporal_list_t *list;
+    double *sum_y;          /* Σ bucket means, per parameter */
+    double *sum_xy;         /* Σ index * bucket mean, per parameter */
+    double *mean_cache;     /* capacity * param_count cached bucket means */
+    size_t param_count;
     uint32_t hash;
     struct hash_entry *next;
+
+    /* Incremental regime detector: two-sided CUSUM over the fitness
+     * stream, updated per observation in evocore_temporal_learn so
+     * regime queries are O(1) state reads. Mean/variance are Welford
+     * running estimates of the in-regime fitness level. */
+    double cusum_mean;      /* Running fitness mean */
+    double cusum_m2;        /* Welford sum of squared deviations */
+    size_t cusum_n;         /* Observations since last regime reset */
+    double cusum_pos;       /* Upward-shift statistic */
+    double cusum_neg;       /* Downward-shift statistic */
 } hash_entry_t;
 
+/* Shifts smaller than CUSUM_SLACK standard deviations accumulate no
+ * evidence; CUSUM_WARMUP observations establish the baseline before
+ * the statistics start moving */
+#define CUSUM_SLACK 0.5
+#define CUSUM_WARMUP 10
+
+static void cusum_observe(hash_entry_t *entry, double fitness) {
+    entry->cusum_n++;
+    double delta = fitness - entry->cusum_mean;
+    entry->cusum_mean += delta / (double)entry->cusum_n;
+    entry->cusum_m2 += delta * (fitness - entry->cusum_mean);
+
+    if (entry->cusum_n < CUSUM_WARMUP) {
+        return;
+    }
+
+    double variance = entry->cusum_m2 / (double)(entry->cusum_n - 1);
+    double sd = sqrt(variance);
+    if (sd < 1e-12) {
+        return;  /* Constant stream carries no shift evidence */
+    }
+
+    double z = delta / sd;  /* Deviation from the pre-update mean */
+    entry->cusum_pos = fmax(0.0, entry->cusum_pos + z - CUSUM_SLACK);
+    entry->cusum_neg = fmax(0.0, entry->cusum_neg - z - CUSUM_SLACK);
+}
+
 typedef struct {
     hash_entry_t **entries;
     size_t capacity;
@@ -87,7 +141,7 @@ static void hash_free(hash_table_t *table) {
             free(entry->key);
             if (entry->list) {
                 if (entry->list->buckets) {
-                    for (size_t j = 0; j < entry->list->count; j++) {
+                    for (size_t j = 0; j < entry->list->capacity; j++) {
                         if (entry->list->buckets[j].stats) {
                             evocore_weighted_array_free(entry->list->buckets[j].stats);
                         }
@@ -96,6 +150,9 @@ static void hash_free(hash_table_t *table) {
                 }
                 free(entry->list);
             }
+            free(entry->sum_y);
+            free(entry->sum_xy);
+            free(entry->mean_cache);
             free(entry);
             entry = next;
         }
@@ -161,6 +218,21 @@ static hash_entry_t* hash_set(hash_table_t *table, const char *key, size_t param
         return NULL;
     }
 
+    new_entry->param_count = param_count;
+    new_entry->sum_y = calloc(param_count, sizeof(double));
+    new_entry->sum_xy = calloc(param_count, sizeof(double));
+    new_entry->mean_cache = calloc(retention * param_count, sizeof(double));
+    if (!new_entry->sum_y || !new_entry->sum_xy || !new_entry->mean_cache) {
+        free(new_entry->sum_y);
+        free(new_entry->sum_xy);
+        free(new_entry->mean_cache);
+        free(new_entry->list->buckets);
+        free(new_entry->list);
+        free(new_entry->key);
+        free(new_entry);
+        return NULL;
+    }
+
     new_entry->hash = hash;
 
     /* Insert at head */
@@ -171,6 +243,61 @@ static hash_entry_t* hash_set(hash_table_t *table, const char *key, size_t param
     return new_entry;
 }
 
+/*========================================================================
+ * Ring Buffer and Trend Sums
+ *========================================================================*/
+
+evocore_temporal_bucket_t* evocore_temporal_list_bucket(
+    const evocore_temporal_list_t *list,
+    size_t index
+) {
+    if (!list || index >= list->count) return NULL;
+    return &list->buckets[(list->head + index) % list->capacity];
+}
+
+/* Ring slot for a chronological index (no bounds check, internal) */
+static size_t ring_slot(const evocore_temporal_list_t *list, size_t index) {
+    return (list->head + index) % list->capacity;
+}
+
+/* Fold a bucket's current means into the regression sums.
+ * `slot` is the ring slot, `pos` the chronological index. */
+static void trend_sums_update(hash_entry_t *entry, size_t slot, size_t pos) {
+    evocore_temporal_bucket_t *bucket = &entry->list->buckets[slot];
+    double *cached = &entry->mean_cache[slot * entry->param_count];
+
+    for (size_t i = 0; i < entry->param_count; i++) {
+        double mean = evocore_weighted_array_mean(bucket->stats, i);
+        double delta = mean - cached[i];
+        entry->sum_y[i] += delta;
+        entry->sum_xy[i] += (double)pos * delta;
+        cached[i] = mean;
+    }
+}
+
+/* Drop the oldest bucket and re-base the regression indices.
+ * Removing index 0 contributes nothing to Σx*y; the remaining indices
+ * all shift down by one, so Σx*y loses one Σy. */
+static void trend_sums_evict_oldest(hash_entry_t *entry) {
+    evocore_temporal_list_t *list = entry->list;
+    size_t slot = list->head;
+    double *cached = &entry->mean_cache[slot * entry->param_count];
+
+    for (size_t i = 0; i < entry->param_count; i++) {
+        entry->sum_y[i] -= cached[i];
+        entry->sum_xy[i] -= entry->sum_y[i];
+        cached[i] = 0.0;
+    }
+
+    if (list->buckets[slot].stats) {
+        evocore_weighted_array_free(list->buckets[slot].stats);
+    }
+    memset(&list->buckets[slot], 0, sizeof(evocore_temporal_bucket_t));
+
+    list->head = (list->head + 1) % list->capacity;
+    list->count--;
+}
+
 /*========================================================================
  * System Management
  *========================================================================*/
@@ -279,45 +406,46 @@ bool evocore_temporal_learn(
     if (!system || !context_key || !parameters) return false;
     if (param_count != system->param_count) return false;
 
+    EVOCORE_PHASE_BEGIN(phase_start);
+
     hash_table_t *table = (hash_table_t*)system->internal;
     hash_entry_t *entry = hash_set(table, context_key, param_count, system->retention_count);
     if (!entry) return false;
 
     evocore_temporal_list_t *list = entry->list;
 
-    /* Find or create bucket */
+    /* Find or create bucket. The newest bucket is checked first since
+     * samples almost always land in the current period. */
     time_t bucket_start = get_bucket_start(system->bucket_type, timestamp);
     evocore_temporal_bucket_t *bucket = NULL;
     size_t bucket_index = 0;
 
-    for (size_t i = 0; i < list->count; i++) {
-        if (list->buckets[i].start_time == bucket_start) {
-            bucket = &list->buckets[i];
-            bucket_index = i;
-            break;
+    if (list->count > 0) {
+        size_t newest = list->count - 1;
+        if (list->buckets[ring_slot(list, newest)].start_time == bucket_start) {
+            bucket = &list->buckets[ring_slot(list, newest)];
+            bucket_index = newest;
+        } else {
+            /* Out-of-order timestamp: scan the rest of the ring */
+            for (size_t i = 0; i < newest; i++) {
+                if (list->buckets[ring_slot(list, i)].start_time == bucket_start) {
+                    bucket = &list->buckets[ring_slot(list, i)];
+                    bucket_index = i;
+                    break;
+                }
+            }
         }
     }
 
-    /* Create new bucket if needed */
+    /* Create new bucket if needed: O(1) ring append, overwriting the
+     * oldest bucket when the ring is full instead of shifting */
     if (!bucket) {
-        /* Check if at capacity */
         if (list->count >= list->capacity) {
-            /* Remove oldest bucket */
-            if (list->count > 0) {
-                if (list->buckets[0].stats) {
-                    evocore_weighted_array_free(list->buckets[0].stats);
-                }
-                /* Shift buckets */
-                for (size_t i = 0; i < list->count - 1; i++) {
-                    list->buckets[i] = list->buckets[i + 1];
-                }
-                list->count--;
-            }
+            trend_sums_evict_oldest(entry);
         }
 
-        /* Add new bucket at end */
         bucket_index = list->count;
-        bucket = &list->buckets[list->count];
+        bucket = &list->buckets[ring_slot(list, bucket_index)];
         list->count++;
 
         bucket->start_time = bucket_start;
@@ -340,15 +468,26 @@ bool evocore_temporal_learn(
         bucket->best_fitness = fitness;
     }
 
-    /* Mark older buckets as complete */
+    /* Fold the new bucket mean into the running regression sums */
+    trend_sums_update(entry, ring_slot(list, bucket_index), bucket_index);
+
+    /* Feed the incremental regime detector */
+    cusum_observe(entry, fitness);
+
+    /* Mark the previous bucket complete once time has moved past it */
     time_t now = time(NULL);
+    time_t duration = evocore_temporal_bucket_duration(system->bucket_type);
     for (size_t i = 0; i < list->count; i++) {
-        if (list->buckets[i].end_time < now - evocore_temporal_bucket_duration(system->bucket_type)) {
-            list->buckets[i].is_complete = true;
+        evocore_temporal_bucket_t *b = &list->buckets[ring_slot(list, i)];
+        if (!b->is_complete && b->end_time < now - duration) {
+            b->is_complete = true;
         }
     }
 
     system->last_update = now;
+
+    EVOCORE_PHASE_END(phase_start, EVOCORE_PHASE_TEMPORAL_LEARN);
+
     return true;
 }
 
@@ -384,14 +523,10 @@ bool evocore_temporal_get_organic_mean(
 
     evocore_temporal_list_t *list = entry->list;
 
-    /* Compute organic mean: average of bucket means (equal weight per bucket) */
+    /* Organic mean: average of bucket means (equal weight per bucket),
+     * read straight from the running Σy sums */
     for (size_t i = 0; i < param_count; i++) {
-        double sum = 0.0;
-        for (size_t j = 0; j < list->count; j++) {
-            double mean = evocore_weighted_mean(&list->buckets[j].stats->stats[i]);
-            sum += mean;
-        }
-        out_parameters[i] = sum / list->count;
+        out_parameters[i] = entry->sum_y[i] / list->count;
     }
 
     /* Confidence based on bucket count */
@@ -425,10 +560,11 @@ bool evocore_temporal_get_weighted_mean(
     if (!combined) return false;
 
     for (size_t j = 0; j < list->count; j++) {
+        evocore_temporal_bucket_t *bucket = evocore_temporal_list_bucket(list, j);
         for (size_t i = 0; i < param_count; i++) {
-            double mean = evocore_weighted_mean(&list->buckets[j].stats->stats[i]);
-            double count = (double)list->buckets[j].sample_count;
-            evocore_weighted_update(&combined->stats[i], mean, count);
+            double mean = evocore_weighted_array_mean(bucket->stats, i);
+            double count = (double)bucket->sample_count;
+            evocore_weighted_array_update_one(combined, i, mean, count);
         }
     }
 
@@ -458,33 +594,21 @@ bool evocore_temporal_get_trend(
         return false;
     }
 
-    evocore_temporal_list_t *list = entry->list;
+    /* Constant-time linear regression from the running sums.
+     * x is the chronological bucket index, so Σx and Σx² only depend
+     * on the bucket count: Σx = n(n-1)/2, Σx² = n(n-1)(2n-1)/6. */
+    double n = (double)entry->list->count;
+    double sum_x = n * (n - 1.0) / 2.0;
+    double sum_xx = n * (n - 1.0) * (2.0 * n - 1.0) / 6.0;
+    double denominator = n * sum_xx - sum_x * sum_x;
 
-    /* Linear regression for each parameter */
     for (size_t i = 0; i < param_count; i++) {
-        double sum_x = 0.0;  /* Sum of bucket indices */
-        double sum_y = 0.0;  /* Sum of bucket means */
-        double sum_xy = 0.0; /* Sum of x*y */
-        double sum_xx = 0.0; /* Sum of x^2 */
-
-        size_t n = list->count;
-
-        for (size_t j = 0; j < n; j++) {
-            double y = evocore_weighted_mean(&list->buckets[j].stats->stats[i]);
-            double x = (double)j;
-
-            sum_x += x;
-            sum_y += y;
-            sum_xy += x * y;
-            sum_xx += x * x;
-        }
-
         /* Slope = (n*sum_xy - sum_x*sum_y) / (n*sum_xx - sum_x*sum_x) */
-        double denominator = n * sum_xx - sum_x * sum_x;
         if (fabs(denominator) < 0.0001) {
             out_slopes[i] = 0.0;  /* No trend */
         } else {
-            out_slopes[i] = (n * sum_xy - sum_x * sum_y) / denominator;
+            out_slopes[i] = (n * entry->sum_xy[i] - sum_x * entry->sum_y[i])
+                            / denominator;
         }
     }
 
@@ -521,29 +645,23 @@ bool evocore_temporal_compare_recent(
 
     evocore_temporal_list_t *list = entry->list;
     size_t total = list->count;
-
-    /* Compute recent means */
-    double recent_means[64];  /* Max 64 parameters */
     size_t recent_start = total - recent_buckets;
 
+    /* Sum the recent window from the cached bucket means; the
+     * historical sum then falls out of the running Σy total, so the
+     * cost is O(recent_buckets) instead of a walk over all history */
     for (size_t i = 0; i < param_count; i++) {
-        recent_means[i] = 0.0;
+        double recent_sum = 0.0;
         for (size_t j = recent_start; j < total; j++) {
-            recent_means[i] += evocore_weighted_mean(&list->buckets[j].stats->stats[i]);
+            size_t slot = ring_slot(list, j);
+            recent_sum += entry->mean_cache[slot * entry->param_count + i];
         }
-        recent_means[i] /= recent_buckets;
-    }
 
-    /* Compute historical means (excluding recent) */
-    for (size_t i = 0; i < param_count; i++) {
-        double historical_mean = 0.0;
-        for (size_t j = 0; j < recent_start; j++) {
-            historical_mean += evocore_weighted_mean(&list->buckets[j].stats->stats[i]);
-        }
-        historical_mean /= recent_start;
+        double recent_mean = recent_sum / recent_buckets;
+        double historical_mean = (entry->sum_y[i] - recent_sum) / recent_start;
 
         /* Drift = difference between recent and historical */
-        out_drift[i] = recent_means[i] - historical_mean;
+        out_drift[i] = recent_mean - historical_mean;
     }
 
     return true;
@@ -573,6 +691,55 @@ bool evocore_temporal_detect_regime_change(
     return false;
 }
 
+bool evocore_temporal_regime_changed(
+    const evocore_temporal_system_t *system,
+    const char *context_key,
+    double threshold
+) {
+    if (!system || !context_key || threshold <= 0.0) return false;
+
+    hash_table_t *table = (hash_table_t*)system->internal;
+    hash_entry_t *entry = hash_get(table, context_key);
+    if (!entry) return false;
+
+    return entry->cusum_pos > threshold || entry->cusum_neg > threshold;
+}
+
+bool evocore_temporal_regime_state(
+    const evocore_temporal_system_t *system,
+    const char *context_key,
+    double *out_positive,
+    double *out_negative
+) {
+    if (!system || !context_key) return false;
+
+    hash_table_t *table = (hash_table_t*)system->internal;
+    hash_entry_t *entry = hash_get(table, context_key);
+    if (!entry) return false;
+
+    if (out_positive) *out_positive = entry->cusum_pos;
+    if (out_negative) *out_negative = entry->cusum_neg;
+    return true;
+}
+
+bool evocore_temporal_regime_reset(
+    evocore_temporal_system_t *system,
+    const char *context_key
+) {
+    if (!system || !context_key) return false;
+
+    hash_table_t *table = (hash_table_t*)system->internal;
+    hash_entry_t *entry = hash_get(table, context_key);
+    if (!entry) return false;
+
+    entry->cusum_mean = 0.0;
+    entry->cusum_m2 = 0.0;
+    entry->cusum_n = 0;
+    entry->cusum_pos = 0.0;
+    entry->cusum_neg = 0.0;
+    return true;
+}
+
 /*========================================================================
  * Bucket Management
  *========================================================================*/
@@ -593,8 +760,9 @@ bool evocore_temporal_get_bucket_at(
     time_t bucket_start = get_bucket_start(system->bucket_type, timestamp);
 
     for (size_t i = 0; i < list->count; i++) {
-        if (list->buckets[i].start_time == bucket_start) {
-            *out_bucket = &list->buckets[i];
+        evocore_temporal_bucket_t *bucket = evocore_temporal_list_bucket(list, i);
+        if (bucket->start_time == bucket_start) {
+            *out_bucket = bucket;
             return true;
         }
     }
@@ -673,14 +841,16 @@ bool evocore_temporal_sample_organic(
         /* Calculate std from bucket means */
         double variance = 0.0;
         for (size_t j = 0; j < list->count; j++) {
-            double bucket_mean = evocore_weighted_mean(&list->buckets[j].stats->stats[i]);
+            evocore_temporal_bucket_t *bucket = evocore_temporal_list_bucket(list, j);
+            double bucket_mean = evocore_weighted_array_mean(bucket->stats, i);
             variance += (bucket_mean - mean) * (bucket_mean - mean);
         }
         variance /= list->count;
         double std = sqrt(variance);
 
-        /* Add sample variance */
-        std += evocore_weighted_std(&list->buckets[0].stats->stats[i]);
+        /* Add sample variance from the oldest bucket */
+        std += evocore_weighted_array_std(
+            evocore_temporal_list_bucket(list, 0)->stats, i);
 
         /* Sample from distribution */
         if (exploration_factor >= 1.0) {
@@ -740,8 +910,9 @@ bool evocore_temporal_sample_trend(
     evocore_temporal_list_t *list = entry->list;
 
     for (size_t i = 0; i < param_count; i++) {
-        /* Get std from first bucket */
-        double std = evocore_weighted_std(&list->buckets[0].stats->stats[i]);
+        /* Get std from the oldest bucket */
+        double std = evocore_weighted_array_std(
+            evocore_temporal_list_bucket(list, 0)->stats, i);
 
         /* Bias mean by trend */
         double biased_mean = means[i] + slopes[i] * trend_strength;
@@ -771,6 +942,9 @@ bool evocore_temporal_save_json(
     FILE *f = fopen(filepath, "w");
     if (!f) return false;
 
+    /* Big stdio buffer: large stores write millions of short pieces */
+    setvbuf(f, NULL, _IOFBF, 1 << 20);
+
     fprintf(f, "{\n");
     fprintf(f, "  \"bucket_type\": %d,\n", system->bucket_type);
     fprintf(f, "  \"param_count\": %zu,\n", system->param_count);
@@ -788,20 +962,35 @@ bool evocore_temporal_save_json(
             fprintf(f, "    \"%s\": {\n", entry->key);
             fprintf(f, "      \"bucket_count\": %zu,\n", list->count);
 
-            /* Write bucket data */
+            /* Write bucket data in chronological order */
             fprintf(f, "      \"buckets\": [\n");
             for (size_t j = 0; j < list->count; j++) {
-                evocore_temporal_bucket_t *bucket = &list->buckets[j];
+                evocore_temporal_bucket_t *bucket = evocore_temporal_list_bucket(list, j);
 
-                fprintf(f, "        {\"start_time\": %ld, \"end_time\": %ld, \"samples\": %zu, \"means\": [",
-                        (long)bucket->start_time, (long)bucket->end_time, bucket->sample_count);
+                /* Batch the bucket into one chunk: per-value fprintf
+                 * dominates save time on large stores */
+                char chunk[4096];
+                size_t clen = (size_t)snprintf(chunk, sizeof(chunk),
+                    "        {\"start_time\": %ld, \"end_time\": %ld, \"samples\": %zu, \"means\": [",
+                    (long)bucket->start_time, (long)bucket->end_time,
+                    bucket->sample_count);
 
                 for (size_t k = 0; k < system->param_count; k++) {
-                    double mean = evocore_weighted_mean(&bucket->stats->stats[k]);
-                    fprintf(f, "%.6g%s", mean, k + 1 < system->param_count ? ", " : "");
+                    if (clen > sizeof(chunk) - 40) {
+                        fwrite(chunk, 1, clen, f);
+                        clen = 0;
+                    }
+                    clen += evocore_format_double(chunk + clen,
+                        evocore_weighted_array_mean(bucket->stats, k));
+                    if (k + 1 < system->param_count) {
+                        chunk[clen++] = ',';
+                        chunk[clen++] = ' ';
+                    }
                 }
 
-                fprintf(f, "] }%s\n", j + 1 < list->count ? "," : "");
+                clen += (size_t)snprintf(chunk + clen, sizeof(chunk) - clen,
+                    "] }%s\n", j + 1 < list->count ? "," : "");
+                fwrite(chunk, 1, clen, f);
             }
 
             fprintf(f, "      ]\n");
@@ -819,13 +1008,227 @@ bool evocore_temporal_save_json(
     return true;
 }
 
+/* Parse one bucket object and append it to the entry's ring. The
+ * caller rewinds the arena per bucket. */
+static bool load_json_bucket(evocore_json_reader_t *reader,
+                             evocore_temporal_system_t *system,
+                             hash_entry_t *entry,
+                             evocore_arena_t *arena) {
+    double start_time = 0;
+    double end_time = 0;
+    double samples = 0;
+    double *means = evocore_arena_alloc(arena,
+                                        system->param_count * sizeof(double));
+    size_t means_count = 0;
+    if (!means) return false;
+
+    if (!evocore_json_expect(reader, '{')) return false;
+    if (!evocore_json_try(reader, '}')) {
+        for (;;) {
+            char *field = evocore_json_read_string(reader);
+            if (!field || !evocore_json_expect(reader, ':')) return false;
+
+            if (strcmp(field, "start_time") == 0) {
+                if (!evocore_json_read_number(reader, &start_time)) return false;
+            } else if (strcmp(field, "end_time") == 0) {
+                if (!evocore_json_read_number(reader, &end_time)) return false;
+            } else if (strcmp(field, "samples") == 0) {
+                if (!evocore_json_read_number(reader, &samples)) return false;
+            } else if (strcmp(field, "means") == 0) {
+                if (!evocore_json_expect(reader, '[')) return false;
+                if (!evocore_json_try(reader, ']')) {
+                    for (;;) {
+                        double v;
+                        if (!evocore_json_read_number(reader, &v)) return false;
+                        if (means_count >= system->param_count) return false;
+                        means[means_count++] = v;
+                        if (evocore_json_try(reader, ']')) break;
+                        if (!evocore_json_expect(reader, ',')) return false;
+                    }
+                }
+            } else {
+                if (!evocore_json_skip_value(reader)) return false;
+            }
+
+            if (evocore_json_try(reader, '}')) break;
+            if (!evocore_json_expect(reader, ',')) return false;
+        }
+    }
+
+    if (means_count != system->param_count) return false;
+
+    /* Append to the ring the same way evocore_temporal_learn does */
+    evocore_temporal_list_t *list = entry->list;
+    if (list->count >= list->capacity) {
+        trend_sums_evict_oldest(entry);
+    }
+
+    size_t bucket_index = list->count;
+    evocore_temporal_bucket_t *bucket =
+        &list->buckets[ring_slot(list, bucket_index)];
+    list->count++;
+
+    bucket->start_time = (time_t)start_time;
+    bucket->end_time = (time_t)end_time;
+    bucket->is_complete = bucket->end_time < time(NULL);
+    bucket->stats = evocore_weighted_array_create(system->param_count);
+    if (!bucket->stats) {
+        list->count--;
+        return false;
+    }
+    bucket->param_count = system->param_count;
+    bucket->sample_count = (size_t)samples;
+    bucket->avg_fitness = 0.0;
+    bucket->best_fitness = 0.0;
+
+    /* Only bucket means survive the JSON round trip; rebuild the
+     * weighted accumulators with the samples as total weight */
+    double weight = samples > 0 ? samples : 1;
+    for (size_t k = 0; k < system->param_count; k++) {
+        evocore_weighted_stats_t ws;
+        memset(&ws, 0, sizeof(ws));
+        ws.mean = means[k];
+        ws.sum_weights = weight;
+        ws.count = (size_t)samples;
+        ws.min_value = means[k];
+        ws.max_value = means[k];
+        ws.sum_weighted_x = means[k] * weight;
+        evocore_weighted_array_set(bucket->stats, k, &ws);
+    }
+
+    trend_sums_update(entry, ring_slot(list, bucket_index), bucket_index);
+    return true;
+}
+
 bool evocore_temporal_load_json(
     const char *filepath,
     evocore_temporal_system_t **out_system
 ) {
-    /* TODO: Implement JSON loading */
-    (void)filepath;
-    (void)out_system;
+    if (!filepath || !out_system) return false;
+
+    FILE *f = fopen(filepath, "rb");
+    if (!f) return false;
+
+    /* Streaming parse mirroring evocore_context_load_json: fixed
+     * chunk reads with a per-entry arena bound peak memory on large
+     * state files */
+    evocore_arena_t arena;
+    if (evocore_arena_init(&arena, 1 << 20) != EVOCORE_OK) {
+        fclose(f);
+        return false;
+    }
+
+    evocore_json_reader_t reader;
+    if (!evocore_json_reader_init(&reader, f, &arena, 1 << 18)) {
+        evocore_arena_cleanup(&arena);
+        fclose(f);
+        return false;
+    }
+
+    evocore_temporal_system_t *system = NULL;
+    double bucket_type = 0;
+    double param_count = 0;
+    double retention_count = 0;
+
+    if (!evocore_json_expect(&reader, '{')) goto error;
+    if (!evocore_json_try(&reader, '}')) {
+        for (;;) {
+            size_t mark = evocore_arena_snapshot(&arena);
+            char *section = evocore_json_read_string(&reader);
+            if (!section || !evocore_json_expect(&reader, ':')) goto error;
+
+            if (strcmp(section, "bucket_type") == 0) {
+                if (!evocore_json_read_number(&reader, &bucket_type)) goto error;
+            } else if (strcmp(section, "param_count") == 0) {
+                if (!evocore_json_read_number(&reader, &param_count)) goto error;
+            } else if (strcmp(section, "retention_count") == 0) {
+                if (!evocore_json_read_number(&reader, &retention_count)) goto error;
+            } else if (strcmp(section, "contexts") == 0) {
+                /* The saver writes the scalar header first */
+                if (param_count < 1 || retention_count < 1) goto error;
+                system = evocore_temporal_create(
+                    (evocore_temporal_bucket_type_t)bucket_type,
+                    (size_t)param_count, (size_t)retention_count);
+                if (!system) goto error;
+
+                hash_table_t *table = (hash_table_t*)system->internal;
+
+                if (!evocore_json_expect(&reader, '{')) goto error;
+                if (!evocore_json_try(&reader, '}')) {
+                    for (;;) {
+                        char *key = evocore_json_read_string(&reader);
+                        if (!key || !evocore_json_expect(&reader, ':')) goto error;
+
+                        hash_entry_t *entry =
+                            hash_set(table, key, system->param_count,
+                                     system->retention_count);
+                        if (!entry) goto error;
+
+                        if (!evocore_json_expect(&reader, '{')) goto error;
+                        for (;;) {
+                            char *field = evocore_json_read_string(&reader);
+                            if (!field ||
+                                !evocore_json_expect(&reader, ':')) goto error;
+
+                            if (strcmp(field, "buckets") == 0) {
+                                if (!evocore_json_expect(&reader, '[')) goto error;
+                                if (!evocore_json_try(&reader, ']')) {
+                                    for (;;) {
+                                        size_t bucket_mark =
+                                            evocore_arena_snapshot(&arena);
+                                        if (!load_json_bucket(&reader, system,
+                                                              entry, &arena)) {
+                                            goto error;
+                                        }
+                                        evocore_arena_rewind(&arena,
+                                                             bucket_mark);
+                                        if (evocore_json_try(&reader, ']')) break;
+                                        if (!evocore_json_expect(&reader, ',')) goto error;
+                                    }
+                                }
+                            } else {
+                                /* bucket_count is redundant with the
+                                 * array length */
+                                if (!evocore_json_skip_value(&reader)) goto error;
+                            }
+                            if (evocore_json_try(&reader, '}')) break;
+                            if (!evocore_json_expect(&reader, ',')) goto error;
+                        }
+
+                        if (evocore_json_try(&reader, '}')) break;
+                        if (!evocore_json_expect(&reader, ',')) goto error;
+                    }
+                }
+            } else {
+                if (!evocore_json_skip_value(&reader)) goto error;
+            }
+
+            evocore_arena_rewind(&arena, mark);
+            if (evocore_json_try(&reader, '}')) break;
+            if (!evocore_json_expect(&reader, ',')) goto error;
+        }
+    }
+
+    if (!system) {
+        /* Header-only file: still construct an empty system */
+        if (param_count < 1 || retention_count < 1) goto error;
+        system = evocore_temporal_create(
+            (evocore_temporal_bucket_type_t)bucket_type,
+            (size_t)param_count, (size_t)retention_count);
+        if (!system) goto error;
+    }
+
+    evocore_json_reader_cleanup(&reader);
+    evocore_arena_cleanup(&arena);
+    fclose(f);
+    *out_system = system;
+    return true;
+
+error:
+    if (system) evocore_temporal_free(system);
+    evocore_json_reader_cleanup(&reader);
+    evocore_arena_cleanup(&arena);
+    fclose(f);
     return false;
 }
 
@@ -867,24 +1270,14 @@ size_t evocore_temporal_prune_old(evocore_temporal_system_t *system) {
     for (size_t i = 0; i < table->capacity; i++) {
         hash_entry_t *entry = table->entries[i];
         while (entry) {
+            /* Buckets are chronological, so expired ones form a prefix:
+             * advance the ring head until the oldest bucket is fresh */
             evocore_temporal_list_t *list = entry->list;
-            size_t write_idx = 0;
-
-            for (size_t j = 0; j < list->count; j++) {
-                if (list->buckets[j].end_time >= cutoff) {
-                    if (write_idx != j) {
-                        list->buckets[write_idx] = list->buckets[j];
-                    }
-                    write_idx++;
-                } else {
-                    if (list->buckets[j].stats) {
-                        evocore_weighted_array_free(list->buckets[j].stats);
-                    }
-                    pruned++;
-                }
+            while (list->count > 0 &&
+                   list->buckets[list->head].end_time < cutoff) {
+                trend_sums_evict_oldest(entry);
+                pruned++;
             }
-
-            list->count = write_idx;
             entry = entry->next;
         }
     }
@@ -903,13 +1296,21 @@ bool evocore_temporal_reset_context(
     if (!entry || !entry->list) return false;
 
     /* Free all buckets */
-    for (size_t j = 0; j < entry->list->count; j++) {
+    for (size_t j = 0; j < entry->list->capacity; j++) {
         if (entry->list->buckets[j].stats) {
             evocore_weighted_array_free(entry->list->buckets[j].stats);
+            memset(&entry->list->buckets[j], 0, sizeof(evocore_temporal_bucket_t));
         }
     }
 
     entry->list->count = 0;
+    entry->list->head = 0;
+
+    /* Clear the regression sums along with the buckets */
+    memset(entry->sum_y, 0, entry->param_count * sizeof(double));
+    memset(entry->sum_xy, 0, entry->param_count * sizeof(double));
+    memset(entry->mean_cache, 0,
+           entry->list->capacity * entry->param_count * sizeof(double));
     return true;
 }
 
@@ -0,0 +1,279 @@
+#define _GNU_SOURCE
+#include "evocore/vector_ops.h"
+#include "internal.h"
+#include <math.h>
+#include <string.h>
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+/*========================================================================
+ * Block Random Number Generation
+ *========================================================================*/
+
+/**
+ * Number of doubles generated per block
+ *
+ * Blocks live on the stack, so keep this modest.
+ */
+#define VECTOR_RNG_BLOCK 256
+
+/**
+ * splitmix64 step - cheap, well-distributed 64-bit generator
+ */
+static inline uint64_t vector_rng_next(uint64_t *state) {
+    uint64_t z = (*state += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+void evocore_vector_fill_uniform(double *dst, size_t count,
+                                 uint64_t *rng_state) {
+    if (!dst || !rng_state) return;
+
+    for (size_t i = 0; i < count; i++) {
+        /* Top 53 bits -> [0, 1) */
+        dst[i] = (double)(vector_rng_next(rng_state) >> 11) *
+                 (1.0 / 9007199254740992.0);
+    }
+}
+
+void evocore_vector_fill_gaussian(double *dst, size_t count,
+                                  uint64_t *rng_state) {
+    if (!dst || !rng_state) return;
+
+    /* Box-Muller on pairs of uniforms */
+    size_t i = 0;
+    while (i + 1 < count) {
+        double u1 = (double)((vector_rng_next(rng_state) >> 11) + 1) *
+                    (1.0 / 9007199254740993.0);  /* (0, 1] - avoids log(0) */
+        double u2 = (double)(vector_rng_next(rng_state) >> 11) *
+                    (1.0 / 9007199254740992.0);
+        double r = sqrt(-2.0 * log(u1));
+        double theta = 2.0 * M_PI * u2;
+        dst[i++] = r * cos(theta);
+        dst[i++] = r * sin(theta);
+    }
+
+    if (i < count) {
+        double u1 = (double)((vector_rng_next(rng_state) >> 11) + 1) *
+                    (1.0 / 9007199254740993.0);
+        double u2 = (double)(vector_rng_next(rng_state) >> 11) *
+                    (1.0 / 9007199254740992.0);
+        dst[i] = sqrt(-2.0 * log(u1)) * cos(2.0 * M_PI * u2);
+    }
+}
+
+/*========================================================================
+ * Array-Level Operators
+ *========================================================================*/
+
+void evocore_vector_gaussian_mutate(double *values, size_t count,
+                                    double rate, double sigma,
+                                    uint64_t *rng_state) {
+    if (!values || !rng_state || count == 0) return;
+
+    double uniforms[VECTOR_RNG_BLOCK];
+    double gaussians[VECTOR_RNG_BLOCK];
+
+    for (size_t start = 0; start < count; start += VECTOR_RNG_BLOCK) {
+        size_t n = count - start;
+        if (n > VECTOR_RNG_BLOCK) n = VECTOR_RNG_BLOCK;
+
+        evocore_vector_fill_uniform(uniforms, n, rng_state);
+        evocore_vector_fill_gaussian(gaussians, n, rng_state);
+
+        double *block = values + start;
+        size_t i = 0;
+
+#ifdef __AVX2__
+        __m256d rate_v = _mm256_set1_pd(rate);
+        __m256d sigma_v = _mm256_set1_pd(sigma);
+
+        for (; i + 4 <= n; i += 4) {
+            __m256d u = _mm256_loadu_pd(uniforms + i);
+            __m256d g = _mm256_loadu_pd(gaussians + i);
+            __m256d v = _mm256_loadu_pd(block + i);
+            /* Perturbation is zeroed where u >= rate */
+            __m256d mask = _mm256_cmp_pd(u, rate_v, _CMP_LT_OQ);
+            __m256d delta = _mm256_and_pd(_mm256_mul_pd(g, sigma_v), mask);
+            _mm256_storeu_pd(block + i, _mm256_add_pd(v, delta));
+        }
+#endif
+
+        for (; i < n; i++) {
+            if (uniforms[i] < rate) {
+                block[i] += gaussians[i] * sigma;
+            }
+        }
+    }
+}
+
+void evocore_vector_uniform_crossover(const double *p1, const double *p2,
+                                      double *c1, double *c2, size_t count,
+                                      uint64_t *rng_state) {
+    if (!p1 || !p2 || !c1 || !c2 || !rng_state || count == 0) return;
+
+    double uniforms[VECTOR_RNG_BLOCK];
+    const double half = 0.5;
+
+    for (size_t start = 0; start < count; start += VECTOR_RNG_BLOCK) {
+        size_t n = count - start;
+        if (n > VECTOR_RNG_BLOCK) n = VECTOR_RNG_BLOCK;
+
+        evocore_vector_fill_uniform(uniforms, n, rng_state);
+
+        const double *a = p1 + start;
+        const double *b = p2 + start;
+        double *x = c1 + start;
+        double *y = c2 + start;
+        size_t i = 0;
+
+#ifdef __AVX2__
+        __m256d half_v = _mm256_set1_pd(half);
+
+        for (; i + 4 <= n; i += 4) {
+            __m256d u = _mm256_cmp_pd(_mm256_loadu_pd(uniforms + i),
+                                      half_v, _CMP_LT_OQ);
+            __m256d av = _mm256_loadu_pd(a + i);
+            __m256d bv = _mm256_loadu_pd(b + i);
+            _mm256_storeu_pd(x + i, _mm256_blendv_pd(av, bv, u));
+            _mm256_storeu_pd(y + i, _mm256_blendv_pd(bv, av, u));
+        }
+#endif
+
+        for (; i < n; i++) {
+            if (uniforms[i] < half) {
+                x[i] = b[i];
+                y[i] = a[i];
+            } else {
+                x[i] = a[i];
+                y[i] = b[i];
+            }
+        }
+    }
+}
+
+void evocore_vector_blend_crossover(const double *p1, const double *p2,
+                                    double *c1, double *c2, size_t count,
+                                    double alpha, uint64_t *rng_state) {
+    if (!p1 || !p2 || !c1 || !c2 || !rng_state || count == 0) return;
+
+    double u1[VECTOR_RNG_BLOCK];
+    double u2[VECTOR_RNG_BLOCK];
+    double span = 1.0 + 2.0 * alpha;
+
+    for (size_t start = 0; start < count; start += VECTOR_RNG_BLOCK) {
+        size_t n = count - start;
+        if (n > VECTOR_RNG_BLOCK) n = VECTOR_RNG_BLOCK;
+
+        evocore_vector_fill_uniform(u1, n, rng_state);
+        evocore_vector_fill_uniform(u2, n, rng_state);
+
+        const double *a = p1 + start;
+        const double *b = p2 + start;
+        double *x = c1 + start;
+        double *y = c2 + start;
+
+        /* gamma in [-alpha, 1+alpha]; plain enough that the compiler
+         * vectorizes this loop on its own */
+        for (size_t i = 0; i < n; i++) {
+            double g1 = span * u1[i] - alpha;
+            double g2 = span * u2[i] - alpha;
+            x[i] = g1 * a[i] + (1.0 - g1) * b[i];
+            y[i] = g2 * a[i] + (1.0 - g2) * b[i];
+        }
+    }
+}
+
+/*========================================================================
+ * Genome-Level Wrappers
+ *========================================================================*/
+
+evocore_error_t evocore_vector_genome_mutate(evocore_genome_t *genome,
+                                         double rate, double sigma,
+                                         uint64_t *rng_state) {
+    if (!genome || !rng_state) return EVOCORE_ERR_NULL_PTR;
+    if (genome->size % sizeof(double) != 0) {
+        return EVOCORE_ERR_GENOME_INVALID;
+    }
+
+    evocore_vector_gaussian_mutate((double*)genome->data,
+                                   genome->size / sizeof(double),
+                                   rate, sigma, rng_state);
+    return EVOCORE_OK;
+}
+
+/**
+ * Shared validation and child setup for the crossover wrappers
+ */
+static evocore_error_t vector_crossover_prepare(
+    const evocore_genome_t *parent1,
+    const evocore_genome_t *parent2,
+    evocore_genome_t *child1,
+    evocore_genome_t *child2,
+    size_t *count) {
+
+    if (!parent1 || !parent2 || !child1 || !child2) {
+        return EVOCORE_ERR_NULL_PTR;
+    }
+
+    size_t size = parent1->size < parent2->size ?
+                  parent1->size : parent2->size;
+    if (size % sizeof(double) != 0) {
+        return EVOCORE_ERR_GENOME_INVALID;
+    }
+
+    EVOCORE_CHECK(evocore_genome_init(child1, size));
+    EVOCORE_CHECK(evocore_genome_set_size(child1, size));
+    EVOCORE_CHECK(evocore_genome_init(child2, size));
+    EVOCORE_CHECK(evocore_genome_set_size(child2, size));
+
+    *count = size / sizeof(double);
+    return EVOCORE_OK;
+}
+
+evocore_error_t evocore_vector_genome_crossover_uniform(
+    const evocore_genome_t *parent1,
+    const evocore_genome_t *parent2,
+    evocore_genome_t *child1,
+    evocore_genome_t *child2,
+    uint64_t *rng_state) {
+
+    if (!rng_state) return EVOCORE_ERR_NULL_PTR;
+
+    size_t count = 0;
+    EVOCORE_CHECK(vector_crossover_prepare(parent1, parent2,
+                                           child1, child2, &count));
+
+    evocore_vector_uniform_crossover((const double*)parent1->data,
+                                     (const double*)parent2->data,
+                                     (double*)child1->data,
+                                     (double*)child2->data,
+                                     count, rng_state);
+    return EVOCORE_OK;
+}
+
+evocore_error_t evocore_vector_genome_crossover_blend(
+    const evocore_genome_t *parent1,
+    const evocore_genome_t *parent2,
+    evocore_genome_t *child1,
+    evocore_genome_t *child2,
+    double alpha,
+    uint64_t *rng_state) {
+
+    if (!rng_state) return EVOCORE_ERR_NULL_PTR;
+
+    size_t count = 0;
+    EVOCORE_CHECK(vector_crossover_prepare(parent1, parent2,
+                                           child1, child2, &count));
+
+    evocore_vector_blend_crossover((const double*)parent1->data,
+                                   (const double*)parent2->data,
+                                   (double*)child1->data,
+                                   (double*)child2->data,
+                                   count, alpha, rng_state);
+    return EVOCORE_OK;
+}
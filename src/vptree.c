@@ -0,0 +1,253 @@
+/**
+ * Evocore Metric Index Implementation
+ *
+ * Incremental vantage-point tree over parameter vectors.
+ */
+
+#define _GNU_SOURCE
+#include "evocore/vptree.h"
+#include "evocore/synthesis.h"
+#include "internal.h"
+#include <string.h>
+#include <math.h>
+
+/*========================================================================
+ * Data Structures
+ *========================================================================*/
+
+/**
+ * Tree node
+ *
+ * Each node is both a data point and a partition: points at distance
+ * <= threshold from this node's vector live in the inside subtree,
+ * the rest in the outside subtree. The threshold is fixed by the first
+ * point routed through the node, which keeps insertion incremental and
+ * yields balanced trees in expectation on well-distributed data.
+ */
+typedef struct vp_node {
+    double *parameters;        /* Owned copy of the indexed vector */
+    void *user_data;           /* Caller's handle, returned by queries */
+    double threshold;          /* Partition radius (valid if has_threshold) */
+    bool has_threshold;        /* False until a point has been routed through */
+    struct vp_node *inside;    /* Subtree with distance <= threshold */
+    struct vp_node *outside;   /* Subtree with distance > threshold */
+} vp_node_t;
+
+struct evocore_vptree_t {
+    vp_node_t *root;
+    size_t param_count;
+    size_t count;
+};
+
+/*========================================================================
+ * Internal Helpers
+ *========================================================================*/
+
+static vp_node_t* node_create(
+    size_t param_count,
+    const double *parameters,
+    void *user_data
+) {
+    vp_node_t *node = evocore_calloc(1, sizeof(vp_node_t));
+    if (!node) return NULL;
+
+    node->parameters = evocore_calloc(param_count, sizeof(double));
+    if (!node->parameters) {
+        evocore_free(node);
+        return NULL;
+    }
+
+    memcpy(node->parameters, parameters, param_count * sizeof(double));
+    node->user_data = user_data;
+
+    return node;
+}
+
+static void node_free(vp_node_t *node) {
+    if (!node) return;
+
+    node_free(node->inside);
+    node_free(node->outside);
+    evocore_free(node->parameters);
+    evocore_free(node);
+}
+
+/**
+ * Branch-and-bound nearest-neighbor search
+ *
+ * A subtree can be skipped when the query's distance to the partition
+ * boundary already exceeds the best distance found so far (triangle
+ * inequality). Searching the nearer side first tightens the bound early.
+ */
+static void nearest_search(
+    const vp_node_t *node,
+    const double *query,
+    size_t param_count,
+    const vp_node_t **best,
+    double *best_distance
+) {
+    if (!node) return;
+
+    double d = evocore_param_distance(query, node->parameters, param_count);
+    if (d < *best_distance) {
+        *best_distance = d;
+        *best = node;
+    }
+
+    if (!node->has_threshold) return;  /* Leaf: no children yet */
+
+    if (d <= node->threshold) {
+        nearest_search(node->inside, query, param_count, best, best_distance);
+        if (node->threshold - d < *best_distance) {
+            nearest_search(node->outside, query, param_count, best, best_distance);
+        }
+    } else {
+        nearest_search(node->outside, query, param_count, best, best_distance);
+        if (d - node->threshold < *best_distance) {
+            nearest_search(node->inside, query, param_count, best, best_distance);
+        }
+    }
+}
+
+static void radius_search(
+    const vp_node_t *node,
+    const double *query,
+    size_t param_count,
+    double radius,
+    void **out_user_data,
+    size_t max_results,
+    size_t *found
+) {
+    if (!node) return;
+
+    double d = evocore_param_distance(query, node->parameters, param_count);
+    if (d <= radius) {
+        if (out_user_data && *found < max_results) {
+            out_user_data[*found] = node->user_data;
+        }
+        (*found)++;
+    }
+
+    if (!node->has_threshold) return;
+
+    if (d - radius <= node->threshold) {
+        radius_search(node->inside, query, param_count, radius,
+                      out_user_data, max_results, found);
+    }
+    if (d + radius > node->threshold) {
+        radius_search(node->outside, query, param_count, radius,
+                      out_user_data, max_results, found);
+    }
+}
+
+/*========================================================================
+ * Lifecycle
+ *========================================================================*/
+
+evocore_vptree_t* evocore_vptree_create(size_t param_count) {
+    if (param_count == 0) return NULL;
+
+    evocore_vptree_t *tree = evocore_calloc(1, sizeof(evocore_vptree_t));
+    if (!tree) return NULL;
+
+    tree->param_count = param_count;
+
+    return tree;
+}
+
+void evocore_vptree_free(evocore_vptree_t *tree) {
+    if (!tree) return;
+
+    node_free(tree->root);
+    evocore_free(tree);
+}
+
+/*========================================================================
+ * Insertion and Queries
+ *========================================================================*/
+
+bool evocore_vptree_insert(
+    evocore_vptree_t *tree,
+    const double *parameters,
+    void *user_data
+) {
+    if (!tree || !parameters) return false;
+
+    vp_node_t *node = node_create(tree->param_count, parameters, user_data);
+    if (!node) return false;
+
+    if (!tree->root) {
+        tree->root = node;
+        tree->count++;
+        return true;
+    }
+
+    /* Route down the tree; the first point through a node fixes its
+     * partition radius to their mutual distance */
+    vp_node_t *current = tree->root;
+    for (;;) {
+        double d = evocore_param_distance(parameters, current->parameters,
+                                          tree->param_count);
+
+        if (!current->has_threshold) {
+            current->threshold = d;
+            current->has_threshold = true;
+            current->inside = node;
+            break;
+        }
+
+        vp_node_t **next = (d <= current->threshold) ? &current->inside
+                                                     : &current->outside;
+        if (!*next) {
+            *next = node;
+            break;
+        }
+        current = *next;
+    }
+
+    tree->count++;
+    return true;
+}
+
+bool evocore_vptree_nearest(
+    const evocore_vptree_t *tree,
+    const double *query,
+    const double **out_parameters,
+    void **out_user_data,
+    double *out_distance
+) {
+    if (!tree || !query || !tree->root) return false;
+
+    const vp_node_t *best = NULL;
+    double best_distance = INFINITY;
+
+    nearest_search(tree->root, query, tree->param_count, &best, &best_distance);
+
+    if (!best) return false;
+
+    if (out_parameters) *out_parameters = best->parameters;
+    if (out_user_data) *out_user_data = best->user_data;
+    if (out_distance) *out_distance = best_distance;
+
+    return true;
+}
+
+size_t evocore_vptree_radius(
+    const evocore_vptree_t *tree,
+    const double *query,
+    double radius,
+    void **out_user_data,
+    size_t max_results
+) {
+    if (!tree || !query || radius < 0.0) return 0;
+
+    size_t found = 0;
+    radius_search(tree->root, query, tree->param_count, radius,
+                  out_user_data, max_results, &found);
+
+    return found;
+}
+
+size_t evocore_vptree_count(const evocore_vptree_t *tree) {
+    return tree ? tree->count : 0;
+}
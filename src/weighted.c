@@ -7,6 +7,7 @@
 
 #define _GNU_SOURCE
 #include "evocore/weighted.h"
+#include "evocore/random.h"
 #include "evocore/log.h"
 #include "internal.h"
 #include <stdlib.h>
@@ -14,6 +15,10 @@
 #include <math.h>
 #include <stdio.h>
 
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
 /*========================================================================
  * Constants
  *========================================================================*/
@@ -120,9 +125,12 @@ double evocore_weighted_sample(
         return mean;
     }
 
-    /* Generate two uniform random variables */
-    double u1 = (double)rand_r(seed) / (double)RAND_MAX;
-    double u2 = (double)rand_r(seed) / (double)RAND_MAX;
+    /* Generate two uniform random variables; NULL seed draws from the
+     * thread-local PRNG service */
+    double u1 = seed ? (double)rand_r(seed) / (double)RAND_MAX
+                     : evocore_random_double();
+    double u2 = seed ? (double)rand_r(seed) / (double)RAND_MAX
+                     : evocore_random_double();
 
     /* Avoid log(0) */
     if (u1 < 0.0001) u1 = 0.0001;
@@ -163,23 +171,42 @@ double evocore_weighted_confidence(
  * Array Statistics - Implementation
  *========================================================================*/
 
+/**
+ * Uniforms drawn per block in the sample path; blocks live on the
+ * stack, so keep this modest
+ */
+#define WEIGHTED_SAMPLE_BLOCK 256
+
 evocore_weighted_array_t* evocore_weighted_array_create(size_t count) {
     if (count == 0) return NULL;
 
     evocore_weighted_array_t *array = malloc(sizeof(evocore_weighted_array_t));
     if (!array) return NULL;
 
-    array->stats = calloc(count, sizeof(evocore_weighted_stats_t));
-    if (!array->stats) {
+    /* One slab for the seven double lanes; the accessors hand out
+     * views into it */
+    double *lanes = calloc(count * 7, sizeof(double));
+    size_t *counts = calloc(count, sizeof(size_t));
+    if (!lanes || !counts) {
+        free(lanes);
+        free(counts);
         free(array);
         return NULL;
     }
 
     array->count = count;
+    array->mean = lanes;
+    array->variance = lanes + count;
+    array->sum_weights = lanes + 2 * count;
+    array->m2 = lanes + 3 * count;
+    array->sum_weighted_x = lanes + 4 * count;
+    array->min_value = lanes + 5 * count;
+    array->max_value = lanes + 6 * count;
+    array->counts = counts;
 
-    /* Initialize all stats */
     for (size_t i = 0; i < count; i++) {
-        evocore_weighted_init(&array->stats[i]);
+        array->min_value[i] = INFINITY;
+        array->max_value[i] = -INFINITY;
     }
 
     return array;
@@ -187,10 +214,41 @@ evocore_weighted_array_t* evocore_weighted_array_create(size_t count) {
 
 void evocore_weighted_array_free(evocore_weighted_array_t *array) {
     if (!array) return;
-    free(array->stats);
+    free(array->mean);  /* Slab base */
+    free(array->counts);
     free(array);
 }
 
+/**
+ * West's update for one lane
+ *
+ * The count == 0 special case of the scalar path is unnecessary here:
+ * with all-zero state the general recurrence reduces to exactly the
+ * first-observation assignments, which is what lets the bulk path run
+ * branch-free.
+ */
+static inline void weighted_array_update_lane(
+    evocore_weighted_array_t *array,
+    size_t i,
+    double value,
+    double weight
+) {
+    if (weight < MIN_WEIGHT) weight = MIN_WEIGHT;
+
+    if (value < array->min_value[i]) array->min_value[i] = value;
+    if (value > array->max_value[i]) array->max_value[i] = value;
+
+    double prev = array->sum_weights[i];
+    double new_sum = prev + weight;
+    double delta = value - array->mean[i];
+
+    array->mean[i] += (weight / new_sum) * delta;
+    array->m2[i] += prev * weight * delta * delta / new_sum;
+    array->sum_weights[i] = new_sum;
+    array->sum_weighted_x[i] += value * weight;
+    array->variance[i] = array->m2[i] / new_sum;
+}
+
 bool evocore_weighted_array_update(
     evocore_weighted_array_t *array,
     const double *values,
@@ -201,12 +259,57 @@ bool evocore_weighted_array_update(
     if (!array || !values) return false;
     if (count != array->count) return false;
 
-    for (size_t i = 0; i < count; i++) {
+    size_t i = 0;
+
+#ifdef __AVX2__
+    __m256d gw = _mm256_set1_pd(global_weight);
+    __m256d min_w = _mm256_set1_pd(MIN_WEIGHT);
+
+    for (; i + 4 <= count; i += 4) {
+        __m256d v = _mm256_loadu_pd(values + i);
+        __m256d w = weights
+                  ? _mm256_mul_pd(gw, _mm256_loadu_pd(weights + i))
+                  : gw;
+        w = _mm256_max_pd(w, min_w);
+
+        __m256d mn = _mm256_loadu_pd(array->min_value + i);
+        __m256d mx = _mm256_loadu_pd(array->max_value + i);
+        _mm256_storeu_pd(array->min_value + i, _mm256_min_pd(mn, v));
+        _mm256_storeu_pd(array->max_value + i, _mm256_max_pd(mx, v));
+
+        __m256d prev = _mm256_loadu_pd(array->sum_weights + i);
+        __m256d new_sum = _mm256_add_pd(prev, w);
+        __m256d mean = _mm256_loadu_pd(array->mean + i);
+        __m256d delta = _mm256_sub_pd(v, mean);
+        __m256d ratio = _mm256_div_pd(w, new_sum);
+
+        mean = _mm256_add_pd(mean, _mm256_mul_pd(ratio, delta));
+        _mm256_storeu_pd(array->mean + i, mean);
+
+        /* m2 += prev * (w / new_sum) * delta^2 */
+        __m256d m2 = _mm256_loadu_pd(array->m2 + i);
+        m2 = _mm256_add_pd(m2, _mm256_mul_pd(_mm256_mul_pd(prev, ratio),
+                                             _mm256_mul_pd(delta, delta)));
+        _mm256_storeu_pd(array->m2 + i, m2);
+
+        _mm256_storeu_pd(array->sum_weights + i, new_sum);
+        __m256d swx = _mm256_loadu_pd(array->sum_weighted_x + i);
+        _mm256_storeu_pd(array->sum_weighted_x + i,
+                         _mm256_add_pd(swx, _mm256_mul_pd(v, w)));
+        _mm256_storeu_pd(array->variance + i, _mm256_div_pd(m2, new_sum));
+    }
+#endif
+
+    for (; i < count; i++) {
         double weight = global_weight;
         if (weights) {
             weight *= weights[i];
         }
-        evocore_weighted_update(&array->stats[i], values[i], weight);
+        weighted_array_update_lane(array, i, values[i], weight);
+    }
+
+    for (size_t j = 0; j < count; j++) {
+        array->counts[j]++;
     }
 
     return true;
@@ -220,10 +323,9 @@ bool evocore_weighted_array_get_means(
     if (!array || !out_means) return false;
     if (count != array->count) return false;
 
-    for (size_t i = 0; i < count; i++) {
-        out_means[i] = evocore_weighted_mean(&array->stats[i]);
-    }
-
+    /* Lanes with no observations hold 0.0, matching the scalar
+     * convention, so this is a straight copy */
+    memcpy(out_means, array->mean, count * sizeof(double));
     return true;
 }
 
@@ -235,8 +337,25 @@ bool evocore_weighted_array_get_stds(
     if (!array || !out_stds) return false;
     if (count != array->count) return false;
 
-    for (size_t i = 0; i < count; i++) {
-        out_stds[i] = evocore_weighted_std(&array->stats[i]);
+    size_t i = 0;
+
+#ifdef __AVX2__
+    __m256d zero = _mm256_setzero_pd();
+
+    for (; i + 4 <= count; i += 4) {
+        /* max against zero prevents NaN from tiny negative variances */
+        __m256d v = _mm256_max_pd(_mm256_loadu_pd(array->variance + i), zero);
+        _mm256_storeu_pd(out_stds + i, _mm256_sqrt_pd(v));
+    }
+#endif
+
+    for (; i < count; i++) {
+        out_stds[i] = sqrt(fmax(0.0, array->variance[i]));
+    }
+
+    /* Std is only defined from two samples on */
+    for (size_t j = 0; j < count; j++) {
+        if (array->counts[j] < 2) out_stds[j] = 0.0;
     }
 
     return true;
@@ -256,27 +375,57 @@ bool evocore_weighted_array_sample(
     if (exploration_factor < 0.0) exploration_factor = 0.0;
     if (exploration_factor > 1.0) exploration_factor = 1.0;
 
-    for (size_t i = 0; i < count; i++) {
-        const evocore_weighted_stats_t *stat = &array->stats[i];
-
-        if (stat->count < DEFAULT_MIN_SAMPLES) {
-            /* No data yet, random uniform */
-            out_values[i] = (double)rand_r(seed) / (double)RAND_MAX;
+    /* Draw uniforms in bulk per block; the Box-Muller log/cos stays
+     * scalar (no vector libm here), but the RNG and the mixing
+     * arithmetic stream over the contiguous lanes */
+    double u1[WEIGHTED_SAMPLE_BLOCK];
+    double u2[WEIGHTED_SAMPLE_BLOCK];
+    double ur[WEIGHTED_SAMPLE_BLOCK];
+
+    for (size_t start = 0; start < count; start += WEIGHTED_SAMPLE_BLOCK) {
+        size_t n = count - start;
+        if (n > WEIGHTED_SAMPLE_BLOCK) n = WEIGHTED_SAMPLE_BLOCK;
+
+        if (seed) {
+            for (size_t k = 0; k < n; k++) {
+                u1[k] = (double)rand_r(seed) / (double)RAND_MAX;
+                u2[k] = (double)rand_r(seed) / (double)RAND_MAX;
+                ur[k] = (double)rand_r(seed) / (double)RAND_MAX;
+            }
         } else {
-            double mean = evocore_weighted_mean(stat);
-            double std = evocore_weighted_std(stat);
+            evocore_random_fill_double(u1, n);
+            evocore_random_fill_double(u2, n);
+            evocore_random_fill_double(ur, n);
+        }
 
-            /* Mix learned distribution with random based on exploration */
-            if (exploration_factor > 0.0) {
-                double learned_value = evocore_weighted_sample(stat, seed);
-                double random_value = (double)rand_r(seed) / (double)RAND_MAX;
+        for (size_t k = 0; k < n; k++) {
+            size_t i = start + k;
+
+            if (array->counts[i] < DEFAULT_MIN_SAMPLES) {
+                /* No data yet, random uniform */
+                out_values[i] = ur[k];
+                continue;
+            }
 
-                /* Linear interpolation based on exploration factor */
-                out_values[i] = (1.0 - exploration_factor) * learned_value
-                              + exploration_factor * random_value;
+            double mean = array->mean[i];
+            double std = array->counts[i] >= 2
+                       ? sqrt(fmax(0.0, array->variance[i]))
+                       : 0.0;
+
+            double learned_value;
+            if (std < 0.0001) {
+                /* No variance, use the mean */
+                learned_value = mean;
             } else {
-                out_values[i] = evocore_weighted_sample(stat, seed);
+                /* Box-Muller transform; avoid log(0) */
+                double a = u1[k] < 0.0001 ? 0.0001 : u1[k];
+                learned_value = mean + std * sqrt(-2.0 * log(a)) *
+                                cos(2.0 * M_PI * u2[k]);
             }
+
+            /* Linear interpolation based on exploration factor */
+            out_values[i] = (1.0 - exploration_factor) * learned_value
+                          + exploration_factor * ur[k];
         }
     }
 
@@ -286,9 +435,81 @@ bool evocore_weighted_array_sample(
 void evocore_weighted_array_reset(evocore_weighted_array_t *array) {
     if (!array) return;
 
+    memset(array->mean, 0, array->count * 5 * sizeof(double));
+    memset(array->counts, 0, array->count * sizeof(size_t));
     for (size_t i = 0; i < array->count; i++) {
-        evocore_weighted_reset(&array->stats[i]);
+        array->min_value[i] = INFINITY;
+        array->max_value[i] = -INFINITY;
+    }
+}
+
+double evocore_weighted_array_mean(
+    const evocore_weighted_array_t *array,
+    size_t index
+) {
+    if (!array || index >= array->count || array->counts[index] == 0) {
+        return 0.0;
+    }
+    return array->mean[index];
+}
+
+double evocore_weighted_array_std(
+    const evocore_weighted_array_t *array,
+    size_t index
+) {
+    if (!array || index >= array->count || array->counts[index] < 2) {
+        return 0.0;
     }
+    return sqrt(fmax(0.0, array->variance[index]));
+}
+
+bool evocore_weighted_array_update_one(
+    evocore_weighted_array_t *array,
+    size_t index,
+    double value,
+    double weight
+) {
+    if (!array || index >= array->count) return false;
+
+    weighted_array_update_lane(array, index, value, weight);
+    array->counts[index]++;
+    return true;
+}
+
+void evocore_weighted_array_get(
+    const evocore_weighted_array_t *array,
+    size_t index,
+    evocore_weighted_stats_t *out
+) {
+    if (!out) return;
+    evocore_weighted_init(out);
+    if (!array || index >= array->count) return;
+
+    out->mean = array->mean[index];
+    out->variance = array->variance[index];
+    out->sum_weights = array->sum_weights[index];
+    out->m2 = array->m2[index];
+    out->count = array->counts[index];
+    out->min_value = array->min_value[index];
+    out->max_value = array->max_value[index];
+    out->sum_weighted_x = array->sum_weighted_x[index];
+}
+
+void evocore_weighted_array_set(
+    evocore_weighted_array_t *array,
+    size_t index,
+    const evocore_weighted_stats_t *src
+) {
+    if (!array || !src || index >= array->count) return;
+
+    array->mean[index] = src->mean;
+    array->variance[index] = src->variance;
+    array->sum_weights[index] = src->sum_weights;
+    array->m2[index] = src->m2;
+    array->counts[index] = src->count;
+    array->min_value[index] = src->min_value;
+    array->max_value[index] = src->max_value;
+    array->sum_weighted_x[index] = src->sum_weighted_x;
 }
 
 /*========================================================================
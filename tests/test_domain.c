@@ -0,0 +1,116 @@
+/**
+ * Domain registry tests
+ *
+ * Covers the descriptor copy in evocore_register_domain: every
+ * callback set on the caller's descriptor must survive into the
+ * registry handle returned by evocore_get_domain, and population
+ * evaluation through that handle must dispatch to the domain's batch
+ * evaluator rather than the scalar fallback. Guards against the
+ * field-by-field copy regression that dropped gpu_fitness and
+ * evaluate_batch.
+ */
+
+#define _GNU_SOURCE
+#include "evocore/evocore.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+#define CHECK(cond) do { \
+    if (!(cond)) { \
+        fprintf(stderr, "FAIL %s:%d: %s\n", __FILE__, __LINE__, #cond); \
+        exit(1); \
+    } \
+} while (0)
+
+static int g_batch_calls = 0;
+
+static void batch_eval(const evocore_genome_t **genomes,
+                       double *fitnesses, size_t count, void *context) {
+    (void)genomes;
+    (void)context;
+    g_batch_calls++;
+    for (size_t i = 0; i < count; i++) {
+        fitnesses[i] = 42.0;
+    }
+}
+
+static int gpu_launch(const void *d_genomes, void *d_fitnesses,
+                      size_t genome_size, int count, void *stream,
+                      void *context) {
+    (void)d_genomes;
+    (void)d_fitnesses;
+    (void)genome_size;
+    (void)stream;
+    (void)context;
+    return count;
+}
+
+static void rand_init(evocore_genome_t *genome, void *context) {
+    (void)context;
+    double v = 1.0;
+    evocore_genome_write(genome, 0, &v, sizeof(v));
+    evocore_genome_set_size(genome, sizeof(v));
+}
+
+static double scalar_fitness(const evocore_genome_t *genome, void *context) {
+    (void)genome;
+    (void)context;
+    return 1.0;
+}
+
+static void test_registry_copy_retains_callbacks(void) {
+    int marker = 7;
+    evocore_domain_t domain = {
+        .name = "batchy",
+        .version = "1.0.0",
+        .genome_size = sizeof(double),
+        .genome_ops = { .random_init = rand_init },
+        .fitness = scalar_fitness,
+        .gpu_fitness = gpu_launch,
+        .evaluate_batch = batch_eval,
+        .user_context = &marker,
+    };
+    CHECK(evocore_register_domain(&domain) == EVOCORE_OK);
+
+    const evocore_domain_t *handle = evocore_get_domain("batchy");
+    CHECK(handle != NULL);
+    CHECK(handle->evaluate_batch == batch_eval);
+    CHECK(handle->gpu_fitness == gpu_launch);
+    CHECK(handle->user_context == &marker);
+    CHECK(handle->fitness == scalar_fitness);
+}
+
+static void test_population_dispatches_to_batch_eval(void) {
+    const evocore_domain_t *handle = evocore_get_domain("batchy");
+    CHECK(handle != NULL);
+
+    evocore_population_t pop;
+    CHECK(evocore_population_init(&pop, 4) == EVOCORE_OK);
+    for (int i = 0; i < 4; i++) {
+        evocore_genome_t g;
+        CHECK(evocore_genome_init(&g, sizeof(double)) == EVOCORE_OK);
+        rand_init(&g, NULL);
+        CHECK(evocore_population_add(&pop, &g, 0.0) == EVOCORE_OK);
+        evocore_genome_cleanup(&g);
+    }
+
+    g_batch_calls = 0;
+    CHECK(evocore_domain_evaluate_population(NULL, &pop, handle) == EVOCORE_OK);
+    CHECK(g_batch_calls == 1);
+    CHECK(pop.individuals[0].fitness == 42.0);
+    CHECK(pop.individuals[3].fitness == 42.0);
+
+    evocore_population_cleanup(&pop);
+}
+
+int main(void) {
+    evocore_domain_registry_init();
+    evocore_log_set_level(EVOCORE_LOG_WARN);
+
+    test_registry_copy_retains_callbacks();
+    test_population_dispatches_to_batch_eval();
+
+    evocore_domain_registry_shutdown();
+    printf("test_domain: all tests passed\n");
+    return 0;
+}